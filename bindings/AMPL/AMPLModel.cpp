@@ -4,6 +4,7 @@
 #include <array>
 #include <cassert>
 #include <stdexcept>
+#include <vector>
 #include "AMPLModel.hpp"
 #include "optimization/EvaluationErrors.hpp"
 #include "optimization/Iterate.hpp"
@@ -87,6 +88,11 @@ namespace uno {
       return true;
    }
 
+   // the ASL evaluations share the state of the ASL structure
+   bool AMPLModel::has_thread_safe_evaluations() const {
+      return false;
+   }
+
    double AMPLModel::evaluate_objective(const Vector<double>& x) const {
       fint error_flag = 0;
       const double result = this->objective_sign * (*(this->asl)->p.Objval)(this->asl, 0, const_cast<double*>(x.data()), &error_flag);
@@ -127,8 +133,8 @@ namespace uno {
 
    void AMPLModel::compute_constraint_jacobian_sparsity(int* row_indices, int* column_indices, int solver_indexing,
          MatrixOrder matrix_order) const {
-      // by default, AMPLModel computes the Jacobian in a column-wise order (variable by variable).
-      // if a row-wise evaluation is wished, modify the goff fields of the ASL "Cgrad" structures
+      // the goff fields of the ASL "Cgrad" structures determine the position of the Jacobian nonzeros. They are set at
+      // each query, since a previous query may have requested another order
       if (matrix_order == MatrixOrder::ROW_MAJOR) {
          int nonzero_index = 0;
          for (size_t constraint_index: Range(this->number_constraints)) {
@@ -140,6 +146,28 @@ namespace uno {
             }
          }
       }
+      else {
+         // column-wise order (variable by variable, the default order of the ASL): count the nonzeros of each column
+         std::vector<int> column_starts(this->number_variables + 1, 0);
+         for (size_t constraint_index: Range(this->number_constraints)) {
+            cgrad* constraint_gradient = this->asl->i.Cgrad_[constraint_index];
+            while (constraint_gradient != nullptr) {
+               ++column_starts[static_cast<size_t>(constraint_gradient->varno) + 1];
+               constraint_gradient = constraint_gradient->next;
+            }
+         }
+         for (size_t variable_index: Range(this->number_variables)) {
+            column_starts[variable_index + 1] += column_starts[variable_index];
+         }
+         // within a column, the nonzeros are sorted by constraint
+         for (size_t constraint_index: Range(this->number_constraints)) {
+            cgrad* constraint_gradient = this->asl->i.Cgrad_[constraint_index];
+            while (constraint_gradient != nullptr) {
+               constraint_gradient->goff = column_starts[static_cast<size_t>(constraint_gradient->varno)]++;
+               constraint_gradient = constraint_gradient->next;
+            }
+         }
+      }
 
       for (size_t constraint_index: Range(this->number_constraints)) {
          cgrad* constraint_gradient = this->asl->i.Cgrad_[constraint_index];
@@ -3,6 +3,8 @@
 
 #include <string>
 #include "AMPLModel.hpp"
+#include "MultiStart.hpp"
+#include "StrategyPortfolio.hpp"
 #include "optimization/Result.hpp"
 #include "options/DefaultOptions.hpp"
 #include "options/Options.hpp"
@@ -21,11 +23,21 @@ void* operator new(size_t size) {
 */
 
 namespace uno {
-   void run_uno_ampl(const std::string& model_name, const Options& options) {
+   void run_uno_ampl(const std::string& model_name, const Options& options, const Options& user_options) {
       try {
          const AMPLModel model(model_name);
-         Uno uno{};
-         Result result = uno.solve(model, options);
+         Result result = [&]() {
+            if (options.get_string("portfolio_presets") != "none") {
+               const StrategyPortfolio portfolio(options);
+               return portfolio.solve(model, options, user_options);
+            }
+            else if (1 < options.get_unsigned_int("multistart_number_points")) {
+               MultiStart multistart(options);
+               return multistart.solve(model, options);
+            }
+            Uno uno{};
+            return uno.solve(model, options);
+         }();
          if (result.optimization_status == OptimizationStatus::SUCCESS) {
             // check result.solution.status
          }
@@ -73,10 +85,13 @@ int main(int argc, char* argv[]) {
          // get the command line arguments (options start at index offset)
          Options command_line_options = Options::get_command_line_options(argc, argv, offset);
          // possibly set options from an option file
+         // (the user options, i.e. the option file and the command line arguments, are kept for the strategy portfolio)
+         Options user_options;
          const auto optional_option_file = command_line_options.get_string_optional("option_file");
          if (optional_option_file.has_value()) {
             Options file_options = Options::load_option_file(*optional_option_file);
             options.overwrite_with(file_options);
+            user_options.overwrite_with(file_options);
          }
          // possibly set a preset
          const auto optional_preset = command_line_options.get_string_optional("preset");
@@ -84,10 +99,11 @@ int main(int argc, char* argv[]) {
          options.overwrite_with(preset_options);
          // overwrite the options with the command line arguments
          options.overwrite_with(command_line_options);
+         user_options.overwrite_with(command_line_options);
 
          // solve the model
          Logger::set_logger(options.get_string("logger"));
-         run_uno_ampl(model_name, options);
+         run_uno_ampl(model_name, options, user_options);
       }
    }
    catch (std::exception& exception) {
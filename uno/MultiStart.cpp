@@ -0,0 +1,225 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include "MultiStart.hpp"
+#include "Uno.hpp"
+#include "model/InitialPointModel.hpp"
+#include "model/Model.hpp"
+#include "model/SynchronizedModel.hpp"
+#include "optimization/EvaluationErrors.hpp"
+#include "optimization/OptimizationStatus.hpp"
+#include "options/Options.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Infinity.hpp"
+#include "tools/Logger.hpp"
+#include "tools/ThreadPool.hpp"
+#include "tools/UserCallbacks.hpp"
+
+namespace uno {
+   // compares the iterates of a run with the incumbent of the multi-start and terminates the dominated runs.
+   // The primals of the (possibly reformulated) model start with the original variables: the run model is evaluated there
+   class DominanceCallbacks: public UserCallbacks {
+   public:
+      DominanceCallbacks(const Model& model, MultiStart& multistart, double margin, size_t minimum_iterations, double primal_tolerance):
+            UserCallbacks(), model(model), multistart(multistart), margin(margin), minimum_iterations(minimum_iterations),
+            primal_tolerance(primal_tolerance), primals(model.number_variables), constraints(model.number_constraints) {
+      }
+
+      bool notify_acceptable_iterate(const Vector<double>& /*primals*/, const Multipliers& /*multipliers*/, double /*objective_multiplier*/) override {
+         return false;
+      }
+
+      bool notify_new_primals(const Vector<double>& primals) override {
+         ++this->number_iterations;
+         if (this->number_iterations < this->minimum_iterations || !is_finite(this->margin)) {
+            return false;
+         }
+         const double incumbent_objective = this->multistart.get_incumbent_objective();
+         if (!is_finite(incumbent_objective)) {
+            return false;
+         }
+         // original variables
+         std::copy(primals.begin(), primals.begin() + static_cast<std::ptrdiff_t>(this->model.number_variables), this->primals.begin());
+         try {
+            const double objective = this->model.evaluate_objective(this->primals);
+            if (objective <= incumbent_objective + this->margin * std::max(1., std::abs(incumbent_objective))) {
+               return false;
+            }
+            if (this->model.is_constrained()) {
+               this->model.evaluate_constraints(this->primals, this->constraints);
+               if (this->primal_tolerance < this->model.constraint_violation(this->constraints, Norm::INF)) {
+                  return false;
+               }
+            }
+         }
+         catch (const EvaluationError&) {
+            return false;
+         }
+         this->is_dominated = true;
+         return true;
+      }
+
+      bool notify_new_multipliers(const Multipliers& /*multipliers*/) override { return false; }
+
+      bool is_dominated{false};
+
+   protected:
+      const Model& model;
+      MultiStart& multistart;
+      const double margin;
+      const size_t minimum_iterations;
+      const double primal_tolerance;
+      Vector<double> primals;
+      std::vector<double> constraints;
+      size_t number_iterations{0};
+   };
+
+   MultiStart::MultiStart(const Options& options):
+         number_starting_points(std::max(size_t(1), options.get_unsigned_int("multistart_number_points"))),
+         sampling(options.get_string("multistart_sampling")),
+         radius(options.get_double("multistart_radius")),
+         seed(options.get_unsigned_int("multistart_seed")),
+         number_threads(std::max(size_t(1), options.get_unsigned_int("multistart_threads"))),
+         dominance_margin(options.get_double("multistart_dominance_margin")),
+         dominance_iterations(options.get_unsigned_int("multistart_dominance_iterations")),
+         primal_tolerance(options.get_double("primal_tolerance")) {
+      if (this->sampling != "latin_hypercube" && this->sampling != "perturbation") {
+         throw std::invalid_argument("The multi-start sampling " + this->sampling + " is unknown");
+      }
+   }
+
+   Result MultiStart::solve(const Model& model, const Options& options) {
+      const std::vector<Vector<double>> starting_points = this->generate_starting_points(model);
+      this->incumbent_objective = INF<double>;
+      std::vector<std::optional<Result>> results(this->number_starting_points);
+      std::vector<char> is_dominated(this->number_starting_points, false);
+      // the output of each run is buffered: only the output of the best run is printed
+      std::vector<std::ostringstream> outputs(this->number_starting_points);
+      // the evaluations of the model are serialized
+      SynchronizedModel::Lock model_lock{};
+
+      ThreadPool thread_pool(std::min(this->number_threads, this->number_starting_points));
+      thread_pool.parallel_for(this->number_starting_points, [&](size_t start_index, size_t /*thread_index*/) {
+         const SynchronizedModel synchronized_model(model, model_lock);
+         const InitialPointModel start_model(synchronized_model, starting_points[start_index]);
+         DominanceCallbacks user_callbacks(start_model, *this, this->dominance_margin, this->dominance_iterations, this->primal_tolerance);
+         try {
+            const Logger::Redirection redirection(outputs[start_index]);
+            Uno uno{};
+            results[start_index].emplace(uno.solve(start_model, options, user_callbacks));
+            is_dominated[start_index] = user_callbacks.is_dominated;
+            if (!user_callbacks.is_dominated) {
+               this->update_incumbent(*results[start_index]);
+            }
+         }
+         catch (const std::exception& exception) {
+            WARNING << "Multi-start: the run " << start_index << " failed: " << exception.what() << '\n';
+         }
+      });
+
+      // pick the best result (the first one in case of a tie)
+      std::optional<size_t> best_index{};
+      for (size_t start_index: Range(this->number_starting_points)) {
+         if (results[start_index].has_value() && !is_dominated[start_index] &&
+               (!best_index.has_value() || MultiStart::is_better(*results[start_index], *results[*best_index]))) {
+            best_index = start_index;
+         }
+      }
+      if (!best_index.has_value()) {
+         throw std::runtime_error("Multi-start: no run was successful");
+      }
+      Logger::stream() << outputs[*best_index].str();
+
+      DISCRETE << "\nMulti-start: " << this->number_starting_points << " starting points\n";
+      for (size_t start_index: Range(this->number_starting_points)) {
+         DISCRETE << "- start " << start_index << ": ";
+         if (!results[start_index].has_value()) {
+            DISCRETE << "failed\n";
+         }
+         else if (is_dominated[start_index]) {
+            DISCRETE << "dominated\n";
+         }
+         else {
+            DISCRETE << solution_status_to_message(results[start_index]->solution_status) << ", objective " <<
+               results[start_index]->solution_objective << '\n';
+         }
+      }
+      DISCRETE << "Best solution: start " << *best_index << '\n';
+      return std::move(*results[*best_index]);
+   }
+
+   // the user point followed by the sampled points. Along the infinite bounds, the samples lie within a radius of the user point
+   std::vector<Vector<double>> MultiStart::generate_starting_points(const Model& model) const {
+      Vector<double> user_point(model.number_variables);
+      model.initial_primal_point(user_point);
+      model.project_onto_variable_bounds(user_point);
+      std::vector<Vector<double>> starting_points(this->number_starting_points, user_point);
+
+      std::mt19937_64 generator(this->seed);
+      std::uniform_real_distribution<double> uniform_distribution(0., 1.);
+      const size_t number_samples = this->number_starting_points - 1;
+      std::vector<size_t> strata(number_samples);
+      for (size_t variable_index: Range(model.number_variables)) {
+         const double width = this->radius * std::max(1., std::abs(user_point[variable_index]));
+         const double lower_bound = model.variable_lower_bound(variable_index);
+         const double upper_bound = model.variable_upper_bound(variable_index);
+         if (this->sampling == "latin_hypercube") {
+            const double lower = is_finite(lower_bound) ? lower_bound : user_point[variable_index] - width;
+            const double upper = is_finite(upper_bound) ? upper_bound : user_point[variable_index] + width;
+            // each sample falls in a different stratum of [lower, upper]
+            std::iota(strata.begin(), strata.end(), size_t(0));
+            std::shuffle(strata.begin(), strata.end(), generator);
+            for (size_t sample_index: Range(number_samples)) {
+               const double fraction = (static_cast<double>(strata[sample_index]) + uniform_distribution(generator)) /
+                  static_cast<double>(number_samples);
+               starting_points[sample_index + 1][variable_index] = lower + fraction * (upper - lower);
+            }
+         }
+         else { // perturbation
+            for (size_t sample_index: Range(number_samples)) {
+               const double perturbation = width * (2. * uniform_distribution(generator) - 1.);
+               starting_points[sample_index + 1][variable_index] = std::min(std::max(lower_bound, user_point[variable_index] + perturbation),
+                  upper_bound);
+            }
+         }
+      }
+      return starting_points;
+   }
+
+   double MultiStart::get_incumbent_objective() {
+      std::lock_guard<std::mutex> lock(this->incumbent_mutex);
+      return this->incumbent_objective;
+   }
+
+   bool MultiStart::is_feasible(const Result& result) {
+      return result.solution_status == SolutionStatus::FEASIBLE_KKT_POINT || result.solution_status == SolutionStatus::FEASIBLE_FJ_POINT ||
+         result.solution_status == SolutionStatus::FEASIBLE_SMALL_STEP;
+   }
+
+   // a feasible result is better than an infeasible one. Feasible results are compared by objective, infeasible ones by infeasibility
+   bool MultiStart::is_better(const Result& result, const Result& other_result) {
+      if (MultiStart::is_feasible(result) != MultiStart::is_feasible(other_result)) {
+         return MultiStart::is_feasible(result);
+      }
+      if (MultiStart::is_feasible(result)) {
+         return result.solution_objective < other_result.solution_objective;
+      }
+      return result.solution_primal_feasibility < other_result.solution_primal_feasibility;
+   }
+
+   // protected member functions
+
+   void MultiStart::update_incumbent(const Result& result) {
+      if (MultiStart::is_feasible(result)) {
+         std::lock_guard<std::mutex> lock(this->incumbent_mutex);
+         this->incumbent_objective = std::min(this->incumbent_objective, result.solution_objective);
+      }
+   }
+} // namespace
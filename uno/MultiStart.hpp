@@ -0,0 +1,53 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_MULTISTART_H
+#define UNO_MULTISTART_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include "linear_algebra/Vector.hpp"
+#include "optimization/Result.hpp"
+
+namespace uno {
+   // forward declarations
+   class Model;
+   class Options;
+
+   // multi-start driver: the model is solved from the user point and from multistart_number_points - 1 other starting
+   // points (Latin hypercube sampling within the variable bounds or perturbations of the user point). The runs are
+   // independent solves (one Uno object each) executed concurrently by multistart_threads threads, and the best feasible
+   // result is returned (the result with the smallest infeasibility if no run is feasible). The evaluations of the model
+   // are serialized, and only the output of the best run is printed.
+   // A run whose feasible iterates are worse than the best feasible solution found so far is terminated early. Since
+   // this depends on the order in which the runs terminate, the result is deterministic only with a single thread
+   class MultiStart {
+   public:
+      explicit MultiStart(const Options& options);
+
+      [[nodiscard]] Result solve(const Model& model, const Options& options);
+
+      [[nodiscard]] std::vector<Vector<double>> generate_starting_points(const Model& model) const;
+      [[nodiscard]] double get_incumbent_objective();
+
+      [[nodiscard]] static bool is_feasible(const Result& result);
+      [[nodiscard]] static bool is_better(const Result& result, const Result& other_result);
+
+   protected:
+      const size_t number_starting_points;
+      const std::string sampling;
+      const double radius;
+      const size_t seed;
+      const size_t number_threads;
+      const double dominance_margin;
+      const size_t dominance_iterations;
+      const double primal_tolerance;
+      std::mutex incumbent_mutex{};
+      double incumbent_objective{};
+
+      void update_incumbent(const Result& result);
+   };
+} // namespace
+
+#endif // UNO_MULTISTART_H
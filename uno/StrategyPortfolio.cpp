@@ -0,0 +1,114 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include "StrategyPortfolio.hpp"
+#include "MultiStart.hpp"
+#include "Uno.hpp"
+#include "model/SynchronizedModel.hpp"
+#include "options/Options.hpp"
+#include "options/Presets.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/CancellationToken.hpp"
+#include "tools/Logger.hpp"
+#include "tools/UserCallbacks.hpp"
+
+namespace uno {
+   StrategyPortfolio::StrategyPortfolio(const Options& options) {
+      // comma-separated list of presets
+      std::istringstream preset_stream(options.get_string("portfolio_presets"));
+      std::string preset;
+      while (std::getline(preset_stream, preset, ',')) {
+         if (!preset.empty()) {
+            this->presets.push_back(preset);
+         }
+      }
+      if (this->presets.empty()) {
+         throw std::invalid_argument("The strategy portfolio is empty");
+      }
+   }
+
+   Result StrategyPortfolio::solve(const Model& model, const Options& options, const Options& user_options) const {
+      const size_t number_runs = this->presets.size();
+      // each run has its own options: options <- preset <- user options
+      std::vector<Options> run_options(number_runs, options);
+      for (size_t run_index: Range(number_runs)) {
+         run_options[run_index].overwrite_with(Presets::get_preset_options(this->presets[run_index]));
+         run_options[run_index].overwrite_with(user_options);
+      }
+      std::vector<CancellationToken> cancellation_tokens(number_runs);
+      std::vector<std::optional<Result>> results(number_runs);
+      std::optional<size_t> winner_index{};
+      std::mutex winner_mutex{};
+      // the output of each run is buffered: only the output of the winner (or of the best run) is printed
+      std::vector<std::ostringstream> outputs(number_runs);
+      // the evaluations of the model are serialized
+      SynchronizedModel::Lock model_lock{};
+
+      const auto run = [&](size_t run_index) {
+         try {
+            const Logger::Redirection redirection(outputs[run_index]);
+            const SynchronizedModel synchronized_model(model, model_lock);
+            NoUserCallbacks user_callbacks{};
+            Uno uno{};
+            results[run_index].emplace(uno.solve(synchronized_model, run_options[run_index], user_callbacks, cancellation_tokens[run_index]));
+            if (results[run_index]->solution_status == SolutionStatus::FEASIBLE_KKT_POINT) {
+               std::lock_guard<std::mutex> lock(winner_mutex);
+               if (!winner_index.has_value()) {
+                  winner_index = run_index;
+                  // cancel the other runs
+                  for (size_t other_run_index: Range(number_runs)) {
+                     if (other_run_index != run_index) {
+                        cancellation_tokens[other_run_index].cancel();
+                     }
+                  }
+               }
+            }
+         }
+         catch (const std::exception& exception) {
+            WARNING << "Strategy portfolio: the run " << this->presets[run_index] << " failed: " << exception.what() << '\n';
+         }
+      };
+      // the runs race: one thread each
+      std::vector<std::thread> threads{};
+      for (size_t run_index: Range(number_runs)) {
+         threads.emplace_back(run, run_index);
+      }
+      for (std::thread& thread: threads) {
+         thread.join();
+      }
+
+      // pick the winner, or the best result if no run found a KKT point
+      std::optional<size_t> best_index = winner_index;
+      if (!winner_index.has_value()) {
+         for (size_t run_index: Range(number_runs)) {
+            if (results[run_index].has_value() && (!best_index.has_value() || MultiStart::is_better(*results[run_index], *results[*best_index]))) {
+               best_index = run_index;
+            }
+         }
+      }
+      if (!best_index.has_value()) {
+         throw std::runtime_error("Strategy portfolio: no run was successful");
+      }
+      Logger::stream() << outputs[*best_index].str();
+
+      DISCRETE << "\nStrategy portfolio: " << number_runs << " runs\n";
+      for (size_t run_index: Range(number_runs)) {
+         DISCRETE << "- " << this->presets[run_index] << ": ";
+         if (!results[run_index].has_value()) {
+            DISCRETE << "failed\n";
+            continue;
+         }
+         const Result& result = *results[run_index];
+         DISCRETE << optimization_status_to_message(result.optimization_status) << ", " <<
+            solution_status_to_message(result.solution_status) << ", objective " << result.solution_objective << '\n';
+      }
+      DISCRETE << (winner_index.has_value() ? "Winner: " : "Best result: ") << this->presets[*best_index] << " (" <<
+         results[*best_index]->strategy_combination << ")\n";
+      return std::move(*results[*best_index]);
+   }
+} // namespace
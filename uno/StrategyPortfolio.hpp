@@ -0,0 +1,33 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_STRATEGYPORTFOLIO_H
+#define UNO_STRATEGYPORTFOLIO_H
+
+#include <string>
+#include <vector>
+#include "optimization/Result.hpp"
+
+namespace uno {
+   // forward declarations
+   class Model;
+   class Options;
+
+   // strategy portfolio: the model is solved concurrently (one thread per run) with each preset of portfolio_presets
+   // (e.g. "ipopt,filtersqp"). The model is shared by the runs and its evaluations are serialized. As in uno_ampl, the
+   // options of a run are the options overwritten with the preset, then with the user options (option file and command
+   // line), so that the user settings (e.g. the tolerances) apply to all the runs. The first run that finds a feasible KKT point wins and the other runs are
+   // cancelled cooperatively. If no run finds a KKT point, the best result is returned. Only the output of the returned
+   // run is printed
+   class StrategyPortfolio {
+   public:
+      explicit StrategyPortfolio(const Options& options);
+
+      [[nodiscard]] Result solve(const Model& model, const Options& options, const Options& user_options) const;
+
+   protected:
+      std::vector<std::string> presets{};
+   };
+} // namespace
+
+#endif // UNO_STRATEGYPORTFOLIO_H
@@ -10,16 +10,20 @@
 #include "ingredients/subproblem_solvers/QPSolverFactory.hpp"
 #include "ingredients/subproblem_solvers/LPSolverFactory.hpp"
 #include "ingredients/subproblem_solvers/SymmetricIndefiniteLinearSolverFactory.hpp"
+#include "ingredients/subproblem_solvers/preconditioners/PreconditionerFactory.hpp"
 #include "linear_algebra/Vector.hpp"
 #include "model/BoundRelaxedModel.hpp"
+#include "model/CachedModel.hpp"
 #include "model/FixedBoundsConstraintsModel.hpp"
 #include "model/HomogeneousEqualityConstrainedModel.hpp"
 #include "model/Model.hpp"
+#include "model/ScaledModel.hpp"
 #include "optimization/Iterate.hpp"
 #include "optimization/WarmstartInformation.hpp"
 #include "tools/Logger.hpp"
 #include "optimization/OptimizationStatus.hpp"
 #include "options/Options.hpp"
+#include "tools/CancellationToken.hpp"
 #include "tools/Statistics.hpp"
 #include "tools/Timer.hpp"
 #include "tools/UserCallbacks.hpp"
@@ -36,10 +40,44 @@ namespace uno {
 
    // solve with user callbacks
    Result Uno::solve(const Model& model, const Options& options, UserCallbacks& user_callbacks) {
+      // pass a token that is never cancelled
+      const CancellationToken cancellation_token{};
+      return this->solve(model, options, user_callbacks, cancellation_token);
+   }
+
+   // solve with user callbacks and a cancellation token
+   Result Uno::solve(const Model& model, const Options& options, UserCallbacks& user_callbacks, const CancellationToken& cancellation_token) {
+      const CancellationToken::Scope cancellation_scope(cancellation_token);
+      this->used_options.clear();
+      const UsedOptions::Scope used_options_scope(this->used_options);
       DISCRETE << "Original model " << model.name << '\n' << model.number_variables << " variables, " <<
          model.number_constraints << " constraints (" << model.get_equality_constraints().size() <<
          " equality, " << model.get_inequality_constraints().size() << " inequality)\n";
 
+      // cache the evaluations of the original model
+      if (0 < options.get_unsigned_int("evaluation_cache_capacity")) {
+         const CachedModel cached_model(model, options);
+         Result result = this->scale_and_solve(cached_model, options, user_callbacks);
+         cached_model.print_hit_rates();
+         return result;
+      }
+      else {
+         return this->scale_and_solve(model, options, user_callbacks);
+      }
+   }
+
+   Result Uno::scale_and_solve(const Model& model, const Options& options, UserCallbacks& user_callbacks) {
+      // scale the objective and constraints based on their gradients at the initial point
+      if (options.get_bool("scale_functions")) {
+         const ScaledModel scaled_model(model, options);
+         return this->reformulate_and_solve(scaled_model, options, user_callbacks);
+      }
+      else {
+         return this->reformulate_and_solve(model, options, user_callbacks);
+      }
+   }
+
+   Result Uno::reformulate_and_solve(const Model& model, const Options& options, UserCallbacks& user_callbacks) {
       // reformulate the model if it is to be solved with an interior-point method
       if (options.get_string("inequality_handling_method") == "primal_dual_interior_point") {
          // move the fixed variables to the set of general constraints
@@ -54,6 +92,15 @@ namespace uno {
             " equality, " << bound_relaxed_model.get_inequality_constraints().size() << " inequality)\n";
          return uno_solve(bound_relaxed_model, options, user_callbacks);
       }
+      // the matrix-free truncated CG solver handles equality constraints only: reformulate the model with slacks
+      else if (options.get_string("inequality_handling_method") == "inequality_constrained" &&
+            options.get_string_optional("QP_solver") == "TruncatedCG") {
+         const HomogeneousEqualityConstrainedModel homogeneous_model(model);
+         DISCRETE << "Reformulated model " << homogeneous_model.name << '\n' << homogeneous_model.number_variables << " variables, " <<
+            homogeneous_model.number_constraints << " constraints (" << homogeneous_model.get_equality_constraints().size() <<
+            " equality, " << homogeneous_model.get_inequality_constraints().size() << " inequality)\n";
+         return uno_solve(homogeneous_model, options, user_callbacks);
+      }
       else {
          return uno_solve(model, options, user_callbacks);
       }
@@ -62,6 +109,7 @@ namespace uno {
    // protected solve function
    Result Uno::uno_solve(const Model& model, const Options& options, UserCallbacks& user_callbacks) {
       const Timer timer{};
+      Iterate::reset_evaluation_counters();
       // pick the ingredients based on the user-defined options
       Uno::pick_ingredients(model, options);
       Statistics statistics = Uno::create_statistics(model, options);
@@ -87,9 +135,10 @@ namespace uno {
             bool termination = false;
             // check for termination
             while (!termination) {
+               CancellationToken::check();
                ++major_iterations;
                statistics.start_new_line();
-               statistics.set("iter", major_iterations);
+               statistics.set(statistics.iteration_column, major_iterations);
                DEBUG << "\n### Outer iteration " << major_iterations << '\n';
 
                // compute an acceptable iterate by solving a subproblem at the current point
@@ -100,16 +149,28 @@ namespace uno {
                GlobalizationMechanism::set_dual_residuals_statistics(statistics, trial_iterate);
                termination = Uno::termination_criteria(trial_iterate.status, major_iterations, max_iterations,
                   timer.get_duration(), time_limit, optimization_status);
-               user_callbacks.notify_new_primals(trial_iterate.primals);
-               user_callbacks.notify_new_multipliers(trial_iterate.multipliers);
+               const bool acceptance_termination_request = this->constraint_relaxation_strategy->user_termination_requested();
+               const bool primals_termination_request = user_callbacks.notify_new_primals(trial_iterate.primals);
+               const bool multipliers_termination_request = user_callbacks.notify_new_multipliers(trial_iterate.multipliers);
+               if (!termination && (acceptance_termination_request || primals_termination_request || multipliers_termination_request)) {
+                  optimization_status = OptimizationStatus::USER_TERMINATION;
+                  termination = true;
+               }
 
                // the trial iterate becomes the current iterate for the next iteration
                std::swap(current_iterate, trial_iterate);
             }
          }
+         catch (const CancellationRequest& exception) {
+            statistics.start_new_line();
+            statistics.set(statistics.status_column, "cancelled");
+            if (Logger::level == INFO) statistics.print_current_line();
+            DEBUG << exception.what() << '\n';
+            optimization_status = OptimizationStatus::USER_TERMINATION;
+         }
          catch (std::exception& exception) {
             statistics.start_new_line();
-            statistics.set("status", exception.what());
+            statistics.set(statistics.status_column, exception.what());
             if (Logger::level == INFO) statistics.print_current_line();
             DEBUG << exception.what() << '\n';
             optimization_status = OptimizationStatus::ALGORITHMIC_ERROR;
@@ -118,6 +179,10 @@ namespace uno {
 
          Uno::postprocess_iterate(model, current_iterate);
       }
+      catch (const CancellationRequest& exception) {
+         DISCRETE << exception.what() << " at the initial iterate\n";
+         optimization_status = OptimizationStatus::USER_TERMINATION;
+      }
       catch (const std::exception& e) {
          DISCRETE  << "An error occurred at the initial iterate: " << e.what()  << '\n';
          optimization_status = OptimizationStatus::EVALUATION_ERROR;
@@ -137,9 +202,12 @@ namespace uno {
       std::cout << "- Globalization mechanisms: " << join(GlobalizationMechanismFactory::available_strategies, ", ") << '\n';
       std::cout << "- Globalization strategies: " << join(GlobalizationStrategyFactory::available_strategies, ", ") << '\n';
       std::cout << "- Inequality handling methods: " << join(InequalityHandlingMethodFactory::available_strategies(), ", ") << '\n';
-      std::cout << "- QP solvers: " << join(QPSolverFactory::available_solvers, ", ") << '\n';
+      std::cout << "- QP solvers: " << join(QPSolverFactory::available_solvers, ", ") << " (matrix-free: " <<
+         join(QPSolverFactory::matrix_free_solvers, ", ") << ")\n";
       std::cout << "- LP solvers: " << join(LPSolverFactory::available_solvers, ", ") << '\n';
-      std::cout << "- Linear solvers: " << join(SymmetricIndefiniteLinearSolverFactory::available_solvers(), ", ") << '\n';
+      std::cout << "- Linear solvers: " << join(SymmetricIndefiniteLinearSolverFactory::available_solvers(), ", ") << " (matrix-free: " <<
+         join(SymmetricIndefiniteLinearSolverFactory::matrix_free_solvers, ", ") << ")\n";
+      std::cout << "- MINRES preconditioners: " << join(PreconditionerFactory::available_preconditioners, ", ") << '\n';
       std::cout << "- Presets: filtersqp, ipopt\n";
    }
 
@@ -152,8 +220,8 @@ namespace uno {
 
    void Uno::initialize(Statistics& statistics, const Model& model, Iterate& current_iterate, const Options& options) {
       statistics.start_new_line();
-      statistics.set("iter", 0);
-      statistics.set("status", "initial point");
+      statistics.set(statistics.iteration_column, 0);
+      statistics.set(statistics.status_column, "initial point");
 
       model.project_onto_variable_bounds(current_iterate.primals);
       // TODO here we don't know if there's a trust-region radius yet!
@@ -163,7 +231,7 @@ namespace uno {
       this->globalization_strategy->initialize(statistics, current_iterate, options);
       this->globalization_mechanism->initialize(statistics, options);
 
-      options.print_used_overwritten();
+      options.print_used_overwritten(this->used_options);
       if (Logger::level == INFO) {
          statistics.print_header();
          statistics.print_current_line();
@@ -172,16 +240,22 @@ namespace uno {
    }
 
    Statistics Uno::create_statistics(const Model& model, const Options& options) {
-      Statistics statistics{};
-      statistics.add_column("iter", Statistics::int_width, options.get_int("statistics_major_column_order"));
-      statistics.add_column("step norm", Statistics::double_width - 5, options.get_int("statistics_step_norm_column_order"));
-      statistics.add_column("objective", Statistics::double_width - 5, options.get_int("statistics_objective_column_order"));
+      // the table is printed at the INFO level only
+      Statistics statistics(Logger::level == INFO);
+      statistics.iteration_column = statistics.add_column("iter", Statistics::int_width, options.get_int("statistics_major_column_order"));
+      statistics.step_norm_column = statistics.add_column("step norm", Statistics::double_width - 5,
+         options.get_int("statistics_step_norm_column_order"));
+      statistics.objective_column = statistics.add_column("objective", Statistics::double_width - 5,
+         options.get_int("statistics_objective_column_order"));
       if (model.is_constrained()) {
-         statistics.add_column("primal feas", Statistics::double_width - 4, options.get_int("statistics_primal_feasibility_column_order"));
+         statistics.primal_feasibility_column = statistics.add_column("primal feas", Statistics::double_width - 4,
+            options.get_int("statistics_primal_feasibility_column_order"));
       }
-      statistics.add_column("stationarity", Statistics::double_width - 3, options.get_int("statistics_stationarity_column_order"));
-      statistics.add_column("complementarity", Statistics::double_width, options.get_int("statistics_complementarity_column_order"));
-      statistics.add_column("status", Statistics::string_width - 9, options.get_int("statistics_status_column_order"));
+      statistics.stationarity_column = statistics.add_column("stationarity", Statistics::double_width - 3,
+         options.get_int("statistics_stationarity_column_order"));
+      statistics.complementarity_column = statistics.add_column("complementarity", Statistics::double_width,
+         options.get_int("statistics_complementarity_column_order"));
+      statistics.status_column = statistics.add_column("status", Statistics::string_width - 9, options.get_int("statistics_status_column_order"));
       return statistics;
    }
 
@@ -217,7 +291,7 @@ namespace uno {
          solution.residuals.complementarity, solution.primals, solution.multipliers.constraints,
          solution.multipliers.lower_bounds, solution.multipliers.upper_bounds, major_iterations, timer.get_duration(),
          Iterate::number_eval_objective, Iterate::number_eval_constraints, Iterate::number_eval_objective_gradient,
-         Iterate::number_eval_jacobian, number_hessian_evaluations, number_subproblems_solved};
+         Iterate::number_eval_jacobian, number_hessian_evaluations, number_subproblems_solved, this->get_strategy_combination()};
    }
 
    std::string Uno::get_strategy_combination() const {
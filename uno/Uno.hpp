@@ -11,9 +11,11 @@
 #include "optimization/Direction.hpp"
 #include "optimization/Result.hpp"
 #include "optimization/SolutionStatus.hpp"
+#include "options/UsedOptions.hpp"
 
 namespace uno {
    // forward declarations
+   class CancellationToken;
    class Model;
    class Options;
    class Statistics;
@@ -27,6 +29,8 @@ namespace uno {
       // solve with or without user callbacks
       Result solve(const Model& model, const Options& options);
       Result solve(const Model& model, const Options& options, UserCallbacks& user_callbacks);
+      // the solve terminates with the status USER_TERMINATION when the token is cancelled (possibly from another thread)
+      Result solve(const Model& model, const Options& options, UserCallbacks& user_callbacks, const CancellationToken& cancellation_token);
 
       static std::string current_version();
       static void print_available_strategies();
@@ -36,12 +40,15 @@ namespace uno {
       std::unique_ptr<GlobalizationStrategy> globalization_strategy{};
       std::unique_ptr<GlobalizationMechanism> globalization_mechanism{};
       Direction direction{};
+      UsedOptions used_options{}; // options read by the current solve
 
       void pick_ingredients(const Model& model, const Options& options);
       void initialize(Statistics& statistics, const Model& model, Iterate& current_iterate, const Options& options);
       [[nodiscard]] static Statistics create_statistics(const Model& model, const Options& options);
       [[nodiscard]] static bool termination_criteria(SolutionStatus solution_status, size_t iteration, size_t max_iterations,
          double current_time, double time_limit, OptimizationStatus& optimization_status);
+      [[nodiscard]] Result scale_and_solve(const Model& model, const Options& options, UserCallbacks& user_callbacks);
+      [[nodiscard]] Result reformulate_and_solve(const Model& model, const Options& options, UserCallbacks& user_callbacks);
       [[nodiscard]] Result uno_solve(const Model& model, const Options& options, UserCallbacks& user_callbacks);
       static void postprocess_iterate(const Model& model, Iterate& iterate);
       [[nodiscard]] Result create_result(const Model& model, OptimizationStatus optimization_status, Iterate& solution,
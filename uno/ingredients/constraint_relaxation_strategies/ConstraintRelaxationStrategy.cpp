@@ -43,6 +43,25 @@ namespace uno {
    }
    */
 
+   // preallocate the buffers of the inner loops, so that they do not allocate
+   void ConstraintRelaxationStrategy::reserve_scratch_space(size_t number_constraints) {
+      this->scratch_vectors.reserve(1, number_constraints);
+      this->scratch_constraints.reserve(1, number_constraints);
+   }
+
+   void ConstraintRelaxationStrategy::count_bounded_variables(const Model& model) {
+      this->number_lower_bounded_variables = 0;
+      this->number_upper_bounded_variables = 0;
+      for (size_t variable_index: Range(model.number_variables)) {
+         if (is_finite(model.variable_lower_bound(variable_index))) {
+            ++this->number_lower_bounded_variables;
+         }
+         if (is_finite(model.variable_upper_bound(variable_index))) {
+            ++this->number_upper_bounded_variables;
+         }
+      }
+   }
+
    // infeasibility measure: constraint violation
    void ConstraintRelaxationStrategy::set_infeasibility_measure(const Model& model, Iterate& iterate) const {
       iterate.evaluate_constraints(model);
@@ -62,10 +81,10 @@ namespace uno {
          const Model& model, const Iterate& current_iterate, const Vector<double>& primal_direction, double step_length) const {
       // predicted infeasibility reduction: "‖c(x)‖ - ‖c(x) + ∇c(x)^T (αd)‖"
       const double current_constraint_violation = model.constraint_violation(current_iterate.evaluations.constraints, this->progress_norm);
-      Vector<double> result(model.number_constraints);
-      inequality_handling_method.compute_constraint_jacobian_vector_product(primal_direction, result);
+      auto result = this->scratch_vectors.lease(model.number_constraints);
+      inequality_handling_method.compute_constraint_jacobian_vector_product(primal_direction, *result);
       const double trial_linearized_constraint_violation = model.constraint_violation(current_iterate.evaluations.constraints +
-         step_length * result, this->progress_norm);
+         step_length * (*result), this->progress_norm);
       return current_constraint_violation - trial_linearized_constraint_violation;
    }
 
@@ -75,8 +94,11 @@ namespace uno {
       const double directional_derivative = dot(primal_direction, current_iterate.evaluations.objective_gradient);
       const double quadratic_term = this->first_order_predicted_reduction ? 0. :
          inequality_handling_method.compute_hessian_quadratic_product(primal_direction);
+      // capture two doubles only: the closure fits in the small buffer of std::function and does not allocate
+      const double linear_reduction = -step_length * directional_derivative;
+      const double quadratic_reduction = step_length*step_length/2. * quadratic_term;
       return [=](double objective_multiplier) {
-         return step_length * (-objective_multiplier*directional_derivative) - step_length*step_length/2. * quadratic_term;
+         return objective_multiplier * linear_reduction - quadratic_reduction;
       };
    }
 
@@ -88,6 +110,12 @@ namespace uno {
          globalization_strategy.reset();
          inequality_handling_method.set_auxiliary_measure(problem, current_iterate);
          inequality_handling_method.subproblem_definition_changed = false;
+         inequality_handling_method.auxiliary_measure_changed = false;
+      }
+      else if (inequality_handling_method.auxiliary_measure_changed) {
+         DEBUG << "The auxiliary measure is recomputed\n";
+         inequality_handling_method.set_auxiliary_measure(problem, current_iterate);
+         inequality_handling_method.auxiliary_measure_changed = false;
       }
       this->evaluate_progress_measures(inequality_handling_method, problem, trial_iterate);
    }
@@ -103,7 +131,7 @@ namespace uno {
 
    bool ConstraintRelaxationStrategy::is_iterate_acceptable(Statistics& statistics, GlobalizationStrategy& globalization_strategy,
          const OptimizationProblem& problem, InequalityHandlingMethod& inequality_handling_method, Iterate& current_iterate,
-         Iterate& trial_iterate, const Direction& direction, double step_length, UserCallbacks& user_callbacks) const {
+         Iterate& trial_iterate, const Direction& direction, double step_length, UserCallbacks& user_callbacks) {
       inequality_handling_method.postprocess_iterate(problem, trial_iterate);
       const double objective_multiplier = problem.get_objective_multiplier();
       trial_iterate.objective_multiplier = objective_multiplier;
@@ -114,7 +142,7 @@ namespace uno {
          DEBUG << "Zero step acceptable\n";
          trial_iterate.evaluate_objective(problem.model);
          accept_iterate = true;
-         statistics.set("status", "0 primal step");
+         statistics.set(statistics.status_column, "0 primal step");
       }
       else {
          const ProgressMeasures predicted_reductions = ConstraintRelaxationStrategy::compute_predicted_reductions(inequality_handling_method,
@@ -122,9 +150,9 @@ namespace uno {
          accept_iterate = globalization_strategy.is_iterate_acceptable(statistics, current_iterate.progress, trial_iterate.progress,
             predicted_reductions, objective_multiplier);
       }
-      if (accept_iterate) {
+      // the user may terminate the solve at the accepted iterate
+      this->user_termination_request = accept_iterate &&
          user_callbacks.notify_acceptable_iterate(trial_iterate.primals, trial_iterate.multipliers, objective_multiplier);
-      }
       return accept_iterate;
    }
 
@@ -142,65 +170,38 @@ namespace uno {
 
       // complementarity error
       constexpr double shift_value = 0.;
-      // TODO preallocate constraints
-      std::vector<double> constraints(problem.number_constraints);
-      problem.evaluate_constraints(iterate, constraints);
-      iterate.residuals.complementarity = problem.complementarity_error(iterate.primals, constraints,
+      auto constraints = this->scratch_constraints.lease(problem.number_constraints);
+      problem.evaluate_constraints(iterate, *constraints);
+      iterate.residuals.complementarity = problem.complementarity_error(iterate.primals, *constraints,
          iterate.multipliers, shift_value, this->residual_norm);
 
       // scaling factors
-      iterate.residuals.stationarity_scaling = this->compute_stationarity_scaling(problem.model, iterate.multipliers);
-      iterate.residuals.complementarity_scaling = this->compute_complementarity_scaling(problem.model, iterate.multipliers);
+      this->compute_residual_scalings(problem.model, iterate.multipliers, iterate);
    }
 
-   double ConstraintRelaxationStrategy::compute_stationarity_scaling(const Model& model, const Multipliers& multipliers) const {
-      size_t number_lower_bounded_variables = 0;
-      size_t number_upper_bounded_variables = 0;
-      for (size_t variable_index: Range(model.number_variables)) {
-         if (is_finite(model.variable_lower_bound(variable_index))) {
-            ++number_lower_bounded_variables;
-         }
-         if (is_finite(model.variable_upper_bound(variable_index))) {
-            ++number_upper_bounded_variables;
-         }
-      }
-      const size_t total_size = number_lower_bounded_variables + number_upper_bounded_variables + model.number_constraints;
+   // compute the stationarity and complementarity scalings with a single evaluation of the multiplier norms
+   void ConstraintRelaxationStrategy::compute_residual_scalings(const Model& model, const Multipliers& multipliers, Iterate& iterate) const {
+      const size_t number_bounds = this->number_lower_bounded_variables + this->number_upper_bounded_variables;
+      const size_t total_size = number_bounds + model.number_constraints;
       if (total_size == 0) {
-         return 1.;
+         iterate.residuals.stationarity_scaling = 1.;
+         iterate.residuals.complementarity_scaling = 1.;
+         return;
       }
-      else {
-         const double scaling_factor = this->residual_scaling_threshold * static_cast<double>(total_size);
-         const double multiplier_norm = norm_1(
-               view(multipliers.constraints, 0, model.number_constraints),
-               view(multipliers.lower_bounds, 0, model.number_variables),
-               view(multipliers.upper_bounds, 0, model.number_variables)
-         );
-         return std::max(1., multiplier_norm / scaling_factor);
-      }
-   }
-
-   double ConstraintRelaxationStrategy::compute_complementarity_scaling(const Model& model, const Multipliers& multipliers) const {
-      size_t number_lower_bounded_variables = 0;
-      size_t number_upper_bounded_variables = 0;
-      for (size_t variable_index: Range(model.number_variables)) {
-         if (is_finite(model.variable_lower_bound(variable_index))) {
-            ++number_lower_bounded_variables;
-         }
-         if (is_finite(model.variable_upper_bound(variable_index))) {
-            ++number_upper_bounded_variables;
-         }
-      }
-      const size_t total_size = number_lower_bounded_variables + number_upper_bounded_variables;
-      if (total_size == 0) {
-         return 1.;
+      const double bound_multiplier_norm = norm_1(
+         view(multipliers.lower_bounds, 0, model.number_variables),
+         view(multipliers.upper_bounds, 0, model.number_variables)
+      );
+      const double constraint_multiplier_norm = norm_1(view(multipliers.constraints, 0, model.number_constraints));
+
+      const double stationarity_scaling_factor = this->residual_scaling_threshold * static_cast<double>(total_size);
+      iterate.residuals.stationarity_scaling = std::max(1., (constraint_multiplier_norm + bound_multiplier_norm) / stationarity_scaling_factor);
+      if (number_bounds == 0) {
+         iterate.residuals.complementarity_scaling = 1.;
       }
       else {
-         const double scaling_factor = this->residual_scaling_threshold * static_cast<double>(total_size);
-         const double bound_multiplier_norm = norm_1(
-               view(multipliers.lower_bounds, 0, model.number_variables),
-               view(multipliers.upper_bounds, 0, model.number_variables)
-         );
-         return std::max(1., bound_multiplier_norm / scaling_factor);
+         const double complementarity_scaling_factor = this->residual_scaling_threshold * static_cast<double>(number_bounds);
+         iterate.residuals.complementarity_scaling = std::max(1., bound_multiplier_norm / complementarity_scaling_factor);
       }
    }
 } // namespace
\ No newline at end of file
@@ -6,10 +6,13 @@
 
 #include <cstddef>
 #include <functional>
+#include <vector>
 #include "ingredients/globalization_strategies/ProgressMeasures.hpp"
 #include "linear_algebra/Norm.hpp"
+#include "linear_algebra/Vector.hpp"
 #include "optimization/Iterate.hpp"
 #include "optimization/SolutionStatus.hpp"
+#include "tools/ScratchArena.hpp"
 
 namespace uno {
    // forward declarations
@@ -22,8 +25,6 @@ namespace uno {
    class Options;
    class Statistics;
    class UserCallbacks;
-   template <typename ElementType>
-   class Vector;
    class WarmstartInformation;
 
    class ConstraintRelaxationStrategy {
@@ -42,10 +43,16 @@ namespace uno {
       virtual void switch_to_feasibility_problem(Statistics& statistics, GlobalizationStrategy& globalization_strategy,
          const Model& model, Iterate& current_iterate, double trust_region_radius, WarmstartInformation& warmstart_information) = 0;
 
+      // second-order correction of a rejected trial iterate. Returns false if no correction could be computed
+      [[nodiscard]] virtual bool compute_second_order_correction(const Model& model, Iterate& current_iterate, Iterate& trial_iterate,
+         double step_length, Direction& correction) = 0;
+
       // trial iterate acceptance
       [[nodiscard]] virtual bool is_iterate_acceptable(Statistics& statistics, GlobalizationStrategy& globalization_strategy,
          const Model& model, Iterate& current_iterate, Iterate& trial_iterate, const Direction& direction, double step_length,
          WarmstartInformation& warmstart_information, UserCallbacks& user_callbacks) = 0;
+      // true if the user callback requested the termination at the last accepted iterate
+      [[nodiscard]] bool user_termination_requested() const { return this->user_termination_request; }
       [[nodiscard]] virtual SolutionStatus check_termination(const Model& model, Iterate& iterate) = 0;
 
       [[nodiscard]] virtual std::string get_name() const = 0;
@@ -64,7 +71,16 @@ namespace uno {
       const double unbounded_objective_threshold;
       // first_order_predicted_reduction is true when the predicted reduction can be taken as first-order (e.g. in line-search methods)
       const bool first_order_predicted_reduction;
-
+      // per-solve temporary buffers used in the inner loops of the globalization mechanisms
+      mutable ScratchArena<Vector<double>> scratch_vectors{};
+      mutable ScratchArena<std::vector<double>> scratch_constraints{};
+      // the variable bounds are fixed during the solve: the number of finite bounds is counted once and for all
+      size_t number_lower_bounded_variables{0};
+      size_t number_upper_bounded_variables{0};
+      bool user_termination_request{false};
+
+      void reserve_scratch_space(size_t number_constraints);
+      void count_bounded_variables(const Model& model);
       void set_objective_measure(const Model& model, Iterate& iterate) const;
       void set_infeasibility_measure(const Model& model, Iterate& iterate) const;
       [[nodiscard]] double compute_predicted_infeasibility_reduction(InequalityHandlingMethod& inequality_handling_method,
@@ -77,13 +93,12 @@ namespace uno {
          const OptimizationProblem& problem, const Iterate& current_iterate, const Direction& direction, double step_length) const;
       [[nodiscard]] bool is_iterate_acceptable(Statistics& statistics, GlobalizationStrategy& globalization_strategy,
          const OptimizationProblem& problem, InequalityHandlingMethod& inequality_handling_method, Iterate& current_iterate,
-         Iterate& trial_iterate, const Direction& direction, double step_length, UserCallbacks& user_callbacks) const;
+         Iterate& trial_iterate, const Direction& direction, double step_length, UserCallbacks& user_callbacks);
       virtual void evaluate_progress_measures(InequalityHandlingMethod& inequality_handling_method,
          const OptimizationProblem& problem, Iterate& iterate) const = 0;
 
       void compute_primal_dual_residuals(const OptimizationProblem& problem, Iterate& iterate) const;
-      [[nodiscard]] double compute_stationarity_scaling(const Model& model, const Multipliers& multipliers) const;
-      [[nodiscard]] double compute_complementarity_scaling(const Model& model, const Multipliers& multipliers) const;
+      void compute_residual_scalings(const Model& model, const Multipliers& multipliers, Iterate& iterate) const;
 
       template <typename Problem>
       [[nodiscard]] SolutionStatus check_termination(const Problem& problem, Iterate& iterate);
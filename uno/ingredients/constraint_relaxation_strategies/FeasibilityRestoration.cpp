@@ -43,6 +43,8 @@ namespace uno {
       this->reference_optimality_primals.resize(optimality_problem.number_variables);
 
       // memory allocation
+      this->reserve_scratch_space(feasibility_problem.number_constraints);
+      this->count_bounded_variables(model);
       this->optimality_hessian_model->initialize(model);
       this->optimality_inequality_handling_method->initialize(optimality_problem, initial_iterate,
          *this->optimality_hessian_model, *this->optimality_regularization_strategy, trust_region_radius);
@@ -56,8 +58,8 @@ namespace uno {
       this->optimality_inequality_handling_method->initialize_statistics(statistics, options);
       this->feasibility_regularization_strategy->initialize_statistics(statistics, options);
       this->feasibility_inequality_handling_method->initialize_statistics(statistics, options);
-      statistics.add_column("phase", Statistics::int_width, options.get_int("statistics_restoration_phase_column_order"));
-      statistics.set("phase", "OPT");
+      this->phase_column = statistics.add_column("phase", Statistics::int_width, options.get_int("statistics_restoration_phase_column_order"));
+      statistics.set(this->phase_column, "OPT");
 
       // initial iterate
       this->optimality_inequality_handling_method->generate_initial_iterate(optimality_problem, initial_iterate);
@@ -76,7 +78,7 @@ namespace uno {
       direction.reset();
       // if we are in the optimality phase, solve the optimality problem
       if (this->current_phase == Phase::OPTIMALITY) {
-         statistics.set("phase", "OPT");
+         statistics.set(this->phase_column, "OPT");
          try {
             DEBUG << "Solving the optimality subproblem\n";
             const OptimizationProblem optimality_problem{model};
@@ -85,7 +87,7 @@ namespace uno {
                warmstart_information);
             if (direction.status == SubproblemStatus::INFEASIBLE) {
                // switch to the feasibility problem, starting from the current direction
-               statistics.set("status", std::string("infeasible subproblem"));
+               statistics.set(statistics.status_column, "infeasible subproblem");
                DEBUG << "/!\\ The subproblem is infeasible\n";
                this->switch_to_feasibility_problem(statistics, globalization_strategy, model, current_iterate,
                   trust_region_radius, warmstart_information);
@@ -104,7 +106,7 @@ namespace uno {
 
       // solve the feasibility problem (minimize the constraint violation)
       DEBUG << "Solving the feasibility subproblem\n";
-      statistics.set("phase", "FEAS");
+      statistics.set(this->phase_column, "FEAS");
       // note: failure of regularization should not happen here, since the feasibility Jacobian has full rank
       l1RelaxedProblem feasibility_problem{model, 0., this->constraint_violation_coefficient,
          this->optimality_inequality_handling_method->proximal_coefficient(), this->reference_optimality_primals.data()};
@@ -167,6 +169,22 @@ namespace uno {
       DEBUG3 << direction << '\n';
    }
 
+   // the corrections are computed in the optimality phase only
+   bool FeasibilityRestoration::compute_second_order_correction(const Model& model, Iterate& current_iterate, Iterate& trial_iterate,
+         double step_length, Direction& correction) {
+      if (this->current_phase != Phase::OPTIMALITY) {
+         return false;
+      }
+      const OptimizationProblem optimality_problem{model};
+      correction.set_dimensions(optimality_problem.number_variables, optimality_problem.number_constraints);
+      if (!this->optimality_inequality_handling_method->compute_second_order_correction(optimality_problem, current_iterate,
+            trial_iterate, step_length, correction, *this->optimality_hessian_model, *this->optimality_regularization_strategy)) {
+         return false;
+      }
+      correction.norm = norm_inf(view(correction.primals, 0, optimality_problem.get_number_original_variables()));
+      return true;
+   }
+
    bool FeasibilityRestoration::can_switch_to_optimality_phase(const Iterate& current_iterate, const GlobalizationStrategy& globalization_strategy,
          const Model& model, const Iterate& trial_iterate, const Direction& direction, double step_length) const {
       if (globalization_strategy.is_infeasibility_sufficiently_reduced(this->reference_optimality_progress, trial_iterate.progress)) {
@@ -174,11 +192,10 @@ namespace uno {
             return true;
          }
          // compute the linearized constraint violation
-         // TODO preallocate
-         Vector<double> result(model.number_constraints);
-         this->feasibility_inequality_handling_method->compute_constraint_jacobian_vector_product(direction.primals, result);
+         auto result = this->scratch_vectors.lease(model.number_constraints);
+         this->feasibility_inequality_handling_method->compute_constraint_jacobian_vector_product(direction.primals, *result);
          const double trial_linearized_constraint_violation = model.constraint_violation(current_iterate.evaluations.constraints +
-            step_length * result, this->residual_norm);
+            step_length * (*result), this->residual_norm);
          return (trial_linearized_constraint_violation <= this->linear_feasibility_tolerance);
       }
       return false;
@@ -26,6 +26,8 @@ namespace uno {
       const OptimizationProblem problem{model};
 
       // memory allocation
+      this->reserve_scratch_space(problem.number_constraints);
+      this->count_bounded_variables(model);
       this->hessian_model->initialize(model);
       this->inequality_handling_method->initialize(problem, initial_iterate, *this->hessian_model,
          *this->regularization_strategy, trust_region_radius);
@@ -70,6 +72,18 @@ namespace uno {
       throw std::runtime_error("The problem is unconstrained, switching to the feasibility problem should not happen");
    }
 
+   bool UnconstrainedStrategy::compute_second_order_correction(const Model& model, Iterate& current_iterate, Iterate& trial_iterate,
+         double step_length, Direction& correction) {
+      const OptimizationProblem problem{model};
+      correction.set_dimensions(problem.number_variables, problem.number_constraints);
+      if (!this->inequality_handling_method->compute_second_order_correction(problem, current_iterate, trial_iterate, step_length,
+            correction, *this->hessian_model, *this->regularization_strategy)) {
+         return false;
+      }
+      correction.norm = norm_inf(view(correction.primals, 0, problem.get_number_original_variables()));
+      return true;
+   }
+
    bool UnconstrainedStrategy::is_iterate_acceptable(Statistics& statistics, GlobalizationStrategy& globalization_strategy,
          const Model& model, Iterate& current_iterate, Iterate& trial_iterate, const Direction& direction, double step_length,
          WarmstartInformation& warmstart_information, UserCallbacks& user_callbacks) {
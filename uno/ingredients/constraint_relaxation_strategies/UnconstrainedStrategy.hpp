@@ -25,6 +25,9 @@ namespace uno {
       void switch_to_feasibility_problem(Statistics& statistics, GlobalizationStrategy& globalization_strategy, const Model& model,
          Iterate& current_iterate, double trust_region_radius, WarmstartInformation& warmstart_information) override;
 
+      [[nodiscard]] bool compute_second_order_correction(const Model& model, Iterate& current_iterate, Iterate& trial_iterate,
+         double step_length, Direction& correction) override;
+
       // trial iterate acceptance
       [[nodiscard]] bool is_iterate_acceptable(Statistics& statistics, GlobalizationStrategy& globalization_strategy, const Model& model,
          Iterate& current_iterate, Iterate& trial_iterate, const Direction& direction, double step_length,
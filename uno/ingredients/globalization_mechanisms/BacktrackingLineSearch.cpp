@@ -1,32 +1,52 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
 #include <cassert>
 #include "BacktrackingLineSearch.hpp"
 #include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.hpp"
+#include "ingredients/globalization_strategies/GlobalizationStrategy.hpp"
 #include "model/Model.hpp"
 #include "optimization/Direction.hpp"
 #include "optimization/EvaluationErrors.hpp"
 #include "optimization/Iterate.hpp"
+#include "optimization/WarmstartInformation.hpp"
 #include "ingredients/subproblem_solvers/SubproblemStatus.hpp"
 #include "tools/Logger.hpp"
 #include "options/Options.hpp"
 #include "tools/Statistics.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/CancellationToken.hpp"
+#include "tools/Infinity.hpp"
 
 namespace uno {
    BacktrackingLineSearch::BacktrackingLineSearch(const Options& options):
          GlobalizationMechanism(),
          backtracking_ratio(options.get_double("LS_backtracking_ratio")),
          minimum_step_length(options.get_double("LS_min_step_length")),
-         scale_duals_with_step_length(options.get_bool("LS_scale_duals_with_step_length")) {
+         scale_duals_with_step_length(options.get_bool("LS_scale_duals_with_step_length")),
+         maximum_number_second_order_corrections(options.get_unsigned_int("LS_max_number_SOC")),
+         second_order_correction_infeasibility_decrease(options.get_double("LS_SOC_infeasibility_decrease")),
+         watchdog_trigger(options.get_unsigned_int("LS_watchdog_trigger")),
+         watchdog_maximum_tentative_iterations(options.get_unsigned_int("LS_watchdog_max_tentative_iterations")),
+         number_speculative_step_lengths(options.get_unsigned_int("LS_speculative_step_lengths")),
+         speculative_thread_pool(std::max(size_t(1), this->number_speculative_step_lengths)) {
       // check the initial and minimal step lengths
       assert(0 < this->backtracking_ratio && this->backtracking_ratio < 1. && "The LS backtracking ratio should be in (0, 1)");
       assert(0 < this->minimum_step_length && this->minimum_step_length < 1. && "The LS minimum step length should be in (0, 1)");
    }
 
    void BacktrackingLineSearch::initialize(Statistics& statistics, const Options& options) {
-      statistics.add_column("LS iter", Statistics::int_width + 2, options.get_int("statistics_minor_column_order"));
-      statistics.add_column("step length", Statistics::double_width - 4, options.get_int("statistics_LS_step_length_column_order"));
+      this->iteration_column = statistics.add_column("LS iter", Statistics::int_width + 2, options.get_int("statistics_minor_column_order"));
+      this->step_length_column = statistics.add_column("step length", Statistics::double_width - 4,
+         options.get_int("statistics_LS_step_length_column_order"));
+      if (0 < this->maximum_number_second_order_corrections) {
+         this->SOC_column = statistics.add_column("SOC", Statistics::int_width - 2, options.get_int("statistics_SOC_column_order"));
+      }
+      if (1 < this->number_speculative_step_lengths) {
+         this->wasted_evaluations_column = statistics.add_column("LS wasted", Statistics::int_width + 2,
+            options.get_int("statistics_LS_speculative_column_order"));
+      }
    }
 
    void BacktrackingLineSearch::compute_next_iterate(Statistics& statistics, ConstraintRelaxationStrategy& constraint_relaxation_strategy,
@@ -37,8 +57,29 @@ namespace uno {
       constraint_relaxation_strategy.compute_feasible_direction(statistics, globalization_strategy, model, current_iterate,
          direction, INF<double>, warmstart_information);
       BacktrackingLineSearch::check_unboundedness(direction);
-      this->backtrack_along_direction(statistics, constraint_relaxation_strategy, globalization_strategy, model, current_iterate,
-         trial_iterate, direction, warmstart_information, user_callbacks);
+
+      // the watchdog is not used in the feasibility problem
+      if (constraint_relaxation_strategy.solving_feasibility_problem()) {
+         this->watchdog_iteration = 0;
+      }
+      // possibly trigger the watchdog
+      else if (this->watchdog_iteration == 0 && 0 < this->watchdog_maximum_tentative_iterations &&
+            this->watchdog_trigger <= this->number_consecutive_shortened_steps) {
+         DEBUG << "Triggering the watchdog\n";
+         this->watchdog_checkpoint = current_iterate;
+         globalization_strategy.save_checkpoint();
+         this->watchdog_iteration = 1;
+         this->number_consecutive_shortened_steps = 0;
+      }
+
+      if (0 < this->watchdog_iteration) {
+         this->take_watchdog_step(statistics, constraint_relaxation_strategy, globalization_strategy, model, current_iterate,
+            trial_iterate, direction, warmstart_information, user_callbacks);
+      }
+      else {
+         this->backtrack_along_direction(statistics, constraint_relaxation_strategy, globalization_strategy, model, current_iterate,
+            trial_iterate, direction, warmstart_information, user_callbacks);
+      }
    }
 
    std::string BacktrackingLineSearch::get_name() const {
@@ -50,15 +91,26 @@ namespace uno {
    // go a fraction along the direction by finding an acceptable step length
    void BacktrackingLineSearch::backtrack_along_direction(Statistics& statistics, ConstraintRelaxationStrategy& constraint_relaxation_strategy,
          GlobalizationStrategy& globalization_strategy, const Model& model, Iterate& current_iterate, Iterate& trial_iterate,
-         Direction& direction, WarmstartInformation& warmstart_information, UserCallbacks& user_callbacks) const {
-      double step_length = 1.;
+         Direction& direction, WarmstartInformation& warmstart_information, UserCallbacks& user_callbacks, double initial_step_length) {
+      double step_length = initial_step_length;
       bool termination = false;
       size_t number_iterations = 0;
+      // the candidates are evaluated concurrently only if the model evaluations are thread-safe
+      const bool speculative_backtracking = (1 < this->number_speculative_step_lengths) && model.has_thread_safe_evaluations();
+      if (1 < this->number_speculative_step_lengths && !speculative_backtracking && !this->sequential_backtracking_reported) {
+         WARNING << "The model evaluations are not thread-safe, the backtracking is sequential\n";
+         this->sequential_backtracking_reported = true;
+      }
+      this->number_speculative_candidates = this->next_speculative_candidate = 0;
       while (!termination) {
+         CancellationToken::check();
          ++number_iterations;
          DEBUG << "\n\tLine-search iteration " << number_iterations << ", step_length " << step_length << '\n';
          if (1 < number_iterations) { statistics.start_new_line(); }
-         statistics.set("step length", step_length);
+         statistics.set(this->step_length_column, step_length);
+         if (speculative_backtracking && this->next_speculative_candidate == this->number_speculative_candidates) {
+            this->evaluate_speculative_candidates(model, current_iterate, direction, step_length);
+         }
 
          bool is_acceptable = false;
          try {
@@ -67,20 +119,36 @@ namespace uno {
                step_length,
                // scale or not the constraint dual direction with the LS step length
                this->scale_duals_with_step_length ? step_length : 1.);
-            statistics.set("step norm", step_length * direction.norm);
+            statistics.set(statistics.step_norm_column, step_length * direction.norm);
+            if (speculative_backtracking) {
+               this->use_speculative_evaluations(model, trial_iterate, step_length);
+            }
 
             is_acceptable = constraint_relaxation_strategy.is_iterate_acceptable(statistics, globalization_strategy, model, current_iterate,
                trial_iterate, direction, step_length, warmstart_information, user_callbacks);
             GlobalizationMechanism::set_primal_statistics(statistics, model, trial_iterate);
          }
          catch (const EvaluationError&) {
-            statistics.set("status", "eval. error");
+            statistics.set(statistics.status_column, "eval. error");
          }
-         BacktrackingLineSearch::set_LS_statistics(statistics, number_iterations);
+         this->set_LS_statistics(statistics, number_iterations);
 
          if (is_acceptable) {
             trial_iterate.status = constraint_relaxation_strategy.check_termination(model, trial_iterate);
             GlobalizationMechanism::set_dual_residuals_statistics(statistics, trial_iterate);
+            this->number_consecutive_shortened_steps = (step_length < 1.) ? this->number_consecutive_shortened_steps + 1 : 0;
+            this->discard_speculative_candidates(statistics);
+            termination = true;
+            if (Logger::level == INFO) statistics.print_current_line();
+         }
+         // the full step was rejected: try to correct it before backtracking (not after a watchdog restore, which resumes
+         // with a shortened step)
+         else if (step_length == 1. && this->try_second_order_corrections(statistics, constraint_relaxation_strategy,
+               globalization_strategy, model, current_iterate, trial_iterate, direction, step_length, warmstart_information, user_callbacks)) {
+            trial_iterate.status = constraint_relaxation_strategy.check_termination(model, trial_iterate);
+            GlobalizationMechanism::set_dual_residuals_statistics(statistics, trial_iterate);
+            this->number_consecutive_shortened_steps = 0;
+            this->discard_speculative_candidates(statistics);
             termination = true;
             if (Logger::level == INFO) statistics.print_current_line();
          }
@@ -93,13 +161,14 @@ namespace uno {
             // check if we can terminate at a first-order point
             termination = BacktrackingLineSearch::terminate_with_small_step_length(statistics, constraint_relaxation_strategy,
                model, trial_iterate);
+            this->discard_speculative_candidates(statistics);
             if (!termination) {
                // test if we can switch to solving the feasibility problem
                if (constraint_relaxation_strategy.solving_feasibility_problem() || !model.is_constrained()) {
                   throw std::runtime_error("LS failed");
                }
                // switch to solving the feasibility problem
-               statistics.set("status", "small step length");
+               statistics.set(statistics.status_column, "small step length");
                constraint_relaxation_strategy.switch_to_feasibility_problem(statistics, globalization_strategy,
                   model, current_iterate, INF<double>, warmstart_information);
                constraint_relaxation_strategy.compute_feasible_direction(statistics, globalization_strategy,
@@ -113,12 +182,114 @@ namespace uno {
       } // end while loop
    }
 
+   // watchdog iteration (Section 3.2 of the IPOPT paper): the full step is taken. If it is acceptable with respect to the
+   // checkpoint iterate, the watchdog succeeds; otherwise, it is tentatively accepted until the maximum number of tentative iterations is reached. In that case, the
+   // checkpoint iterate and the state of the globalization strategy are restored, and a regular backtracking line search
+   // is performed from the checkpoint iterate (the full step having already been rejected)
+   void BacktrackingLineSearch::take_watchdog_step(Statistics& statistics, ConstraintRelaxationStrategy& constraint_relaxation_strategy,
+         GlobalizationStrategy& globalization_strategy, const Model& model, Iterate& current_iterate, Iterate& trial_iterate,
+         Direction& direction, WarmstartInformation& warmstart_information, UserCallbacks& user_callbacks) {
+      DEBUG << "\n\tWatchdog iteration " << this->watchdog_iteration << '\n';
+      statistics.set(this->step_length_column, 1.);
+      bool is_acceptable = false;
+      bool evaluation_error = false;
+      try {
+         GlobalizationMechanism::assemble_trial_iterate(model, current_iterate, trial_iterate, direction, 1., 1.);
+         statistics.set(statistics.step_norm_column, direction.norm);
+         // the progress of the trial iterate is measured from the checkpoint iterate, not from the last tentative iterate
+         is_acceptable = constraint_relaxation_strategy.is_iterate_acceptable(statistics, globalization_strategy, model,
+            this->watchdog_checkpoint, trial_iterate, direction, 1., warmstart_information, user_callbacks);
+         GlobalizationMechanism::set_primal_statistics(statistics, model, trial_iterate);
+      }
+      catch (const EvaluationError&) {
+         statistics.set(statistics.status_column, "eval. error");
+         evaluation_error = true;
+      }
+      this->set_LS_statistics(statistics, 1);
+
+      if (is_acceptable) {
+         DEBUG << "The watchdog succeeded\n";
+         this->watchdog_iteration = 0;
+      }
+      else if (!evaluation_error && this->watchdog_iteration <= this->watchdog_maximum_tentative_iterations) {
+         // tentatively accept the full step
+         statistics.set(statistics.status_column, "watchdog");
+         ++this->watchdog_iteration;
+      }
+      else {
+         DEBUG << "The watchdog failed, restoring the checkpoint iterate\n";
+         statistics.set(statistics.status_column, "watchdog restore");
+         if (Logger::level == INFO) statistics.print_current_line();
+         statistics.start_new_line();
+         this->watchdog_iteration = 0;
+         current_iterate = this->watchdog_checkpoint;
+         globalization_strategy.restore_checkpoint();
+         // recompute the direction at the checkpoint iterate
+         warmstart_information.iterate_changed();
+         constraint_relaxation_strategy.compute_feasible_direction(statistics, globalization_strategy, model, current_iterate,
+            direction, INF<double>, warmstart_information);
+         BacktrackingLineSearch::check_unboundedness(direction);
+         this->backtrack_along_direction(statistics, constraint_relaxation_strategy, globalization_strategy, model, current_iterate,
+            trial_iterate, direction, warmstart_information, user_callbacks, this->backtracking_ratio);
+         return;
+      }
+      trial_iterate.status = constraint_relaxation_strategy.check_termination(model, trial_iterate);
+      GlobalizationMechanism::set_dual_residuals_statistics(statistics, trial_iterate);
+      if (Logger::level == INFO) statistics.print_current_line();
+   }
+
+   // second-order corrections (Section 2.4 of the IPOPT paper) counteract the Maratos effect: when the full step increases
+   // the constraint violation, the step is corrected with the current factorization. The corrected trial iterates are tested
+   // against the predicted reductions of the original direction. Returns true if a corrected trial iterate was accepted
+   bool BacktrackingLineSearch::try_second_order_corrections(Statistics& statistics, ConstraintRelaxationStrategy& constraint_relaxation_strategy,
+         GlobalizationStrategy& globalization_strategy, const Model& model, Iterate& current_iterate, Iterate& trial_iterate,
+         const Direction& direction, double step_length, WarmstartInformation& warmstart_information, UserCallbacks& user_callbacks) {
+      if (this->maximum_number_second_order_corrections == 0 || !model.is_constrained() ||
+            !is_finite(trial_iterate.progress.infeasibility) ||
+            trial_iterate.progress.infeasibility < current_iterate.progress.infeasibility) {
+         return false;
+      }
+      double previous_infeasibility = trial_iterate.progress.infeasibility;
+      this->second_order_correction = direction;
+      for (size_t correction_index: Range(this->maximum_number_second_order_corrections)) {
+         if (Logger::level == INFO) statistics.print_current_line();
+         statistics.start_new_line();
+         statistics.set(this->SOC_column, correction_index + 1);
+         try {
+            if (!constraint_relaxation_strategy.compute_second_order_correction(model, current_iterate, trial_iterate, step_length,
+                  this->second_order_correction)) {
+               return false;
+            }
+            DEBUG << "\n\tSecond-order correction " << (correction_index + 1) << '\n';
+            GlobalizationMechanism::assemble_trial_iterate(model, current_iterate, trial_iterate, this->second_order_correction, 1., 1.);
+            statistics.set(this->step_length_column, 1.);
+            statistics.set(statistics.step_norm_column, this->second_order_correction.norm);
+            const bool is_acceptable = constraint_relaxation_strategy.is_iterate_acceptable(statistics, globalization_strategy, model,
+               current_iterate, trial_iterate, direction, step_length, warmstart_information, user_callbacks);
+            GlobalizationMechanism::set_primal_statistics(statistics, model, trial_iterate);
+            if (is_acceptable) {
+               return true;
+            }
+         }
+         catch (const EvaluationError&) {
+            statistics.set(statistics.status_column, "eval. error");
+            return false;
+         }
+         // stop when the corrections do not reduce the constraint violation sufficiently
+         if (this->second_order_correction_infeasibility_decrease * previous_infeasibility < trial_iterate.progress.infeasibility) {
+            return false;
+         }
+         previous_infeasibility = trial_iterate.progress.infeasibility;
+      }
+      return false;
+   }
+
    bool BacktrackingLineSearch::terminate_with_small_step_length(Statistics& statistics,
          ConstraintRelaxationStrategy& constraint_relaxation_strategy, const Model& model, Iterate& trial_iterate) {
       bool termination = false;
       trial_iterate.status = constraint_relaxation_strategy.check_termination(model, trial_iterate);
       if (trial_iterate.status != SolutionStatus::NOT_OPTIMAL) {
-         statistics.set("status", "accepted (small step length)");
+         statistics.set(statistics.status_column, "accepted (small step length)");
          GlobalizationMechanism::set_dual_residuals_statistics(statistics, trial_iterate);
          termination = true;
       }
@@ -132,6 +303,84 @@ namespace uno {
       return step_length;
    }
 
+   // assemble the candidates of the sequential backtracking (starting from step_length) and evaluate their objective and
+   // constraints concurrently. The evaluation errors are not raised here: the failed evaluations are repeated when the
+   // candidates are tested, so that the errors occur in the sequential order
+   void BacktrackingLineSearch::evaluate_speculative_candidates(const Model& model, Iterate& current_iterate, const Direction& direction,
+         double step_length) {
+      if (this->speculative_iterates.size() != this->number_speculative_step_lengths) {
+         this->speculative_iterates.assign(this->number_speculative_step_lengths, current_iterate);
+         this->speculative_step_lengths.resize(this->number_speculative_step_lengths);
+         this->is_speculative_evaluation_successful.resize(this->number_speculative_step_lengths);
+      }
+      this->number_speculative_candidates = 0;
+      this->next_speculative_candidate = 0;
+      while (this->number_speculative_candidates < this->number_speculative_step_lengths) {
+         Iterate& candidate = this->speculative_iterates[this->number_speculative_candidates];
+         GlobalizationMechanism::assemble_trial_iterate(model, current_iterate, candidate, direction, step_length,
+            this->scale_duals_with_step_length ? step_length : 1.);
+         candidate.evaluations.constraints.resize(current_iterate.evaluations.constraints.size());
+         this->speculative_step_lengths[this->number_speculative_candidates] = step_length;
+         ++this->number_speculative_candidates;
+         // the sequential backtracking stops below the minimum step length
+         if (step_length < this->minimum_step_length) {
+            break;
+         }
+         step_length = this->decrease_step_length(step_length);
+      }
+      DEBUG << "Evaluating " << this->number_speculative_candidates << " speculative step lengths\n";
+
+      this->speculative_thread_pool.parallel_for(this->number_speculative_candidates, [&](size_t candidate_index, size_t /*thread_index*/) {
+         Iterate& candidate = this->speculative_iterates[candidate_index];
+         bool is_successful = false;
+         try {
+            candidate.evaluations.objective = model.evaluate_objective(candidate.primals);
+            if (model.is_constrained()) {
+               model.evaluate_constraints(candidate.primals, candidate.evaluations.constraints);
+            }
+            is_successful = is_finite(candidate.evaluations.objective) && std::all_of(candidate.evaluations.constraints.cbegin(),
+               candidate.evaluations.constraints.cend(), [](double constraint_j) { return is_finite(constraint_j); });
+         }
+         catch (const EvaluationError&) {
+         }
+         this->is_speculative_evaluation_successful[candidate_index] = is_successful;
+      });
+   }
+
+   // if the trial iterate is the next speculative candidate, retrieve its evaluations. They are counted as if the
+   // trial iterate had been evaluated
+   void BacktrackingLineSearch::use_speculative_evaluations(const Model& model, Iterate& trial_iterate, double step_length) {
+      if (this->next_speculative_candidate == this->number_speculative_candidates ||
+            this->speculative_step_lengths[this->next_speculative_candidate] != step_length) {
+         return;
+      }
+      const size_t candidate_index = this->next_speculative_candidate++;
+      if (this->is_speculative_evaluation_successful[candidate_index]) {
+         const Iterate& candidate = this->speculative_iterates[candidate_index];
+         trial_iterate.evaluations.objective = candidate.evaluations.objective;
+         trial_iterate.is_objective_computed = true;
+         ++Iterate::number_eval_objective;
+         if (model.is_constrained()) {
+            trial_iterate.evaluations.constraints = candidate.evaluations.constraints;
+            ++Iterate::number_eval_constraints;
+         }
+         trial_iterate.are_constraints_computed = true;
+      }
+      else {
+         // the evaluation is repeated
+         ++this->number_wasted_speculative_evaluations;
+      }
+   }
+
+   // the candidates beyond the last tested one were evaluated in vain
+   void BacktrackingLineSearch::discard_speculative_candidates(Statistics& statistics) {
+      if (1 < this->number_speculative_step_lengths) {
+         this->number_wasted_speculative_evaluations += this->number_speculative_candidates - this->next_speculative_candidate;
+         this->number_speculative_candidates = this->next_speculative_candidate = 0;
+         statistics.set(this->wasted_evaluations_column, this->number_wasted_speculative_evaluations);
+      }
+   }
+
    void BacktrackingLineSearch::check_unboundedness(const Direction& direction) {
       if (direction.status == SubproblemStatus::UNBOUNDED_PROBLEM) {
          throw std::runtime_error("The subproblem is unbounded, this should not happen. If the subproblem has curvature,"
@@ -139,7 +388,7 @@ namespace uno {
       }
    }
 
-   void BacktrackingLineSearch::set_LS_statistics(Statistics& statistics, size_t number_iterations) {
-      statistics.set("LS iter", number_iterations);
+   void BacktrackingLineSearch::set_LS_statistics(Statistics& statistics, size_t number_iterations) const {
+      statistics.set(this->iteration_column, number_iterations);
    }
 } // namespace
\ No newline at end of file
@@ -4,7 +4,11 @@
 #ifndef UNO_BACKTRACKINGLINESEARCH_H
 #define UNO_BACKTRACKINGLINESEARCH_H
 
+#include <vector>
 #include "GlobalizationMechanism.hpp"
+#include "optimization/Direction.hpp"
+#include "optimization/Iterate.hpp"
+#include "tools/ThreadPool.hpp"
 
 namespace uno {
    class BacktrackingLineSearch : public GlobalizationMechanism {
@@ -23,16 +27,53 @@ namespace uno {
       const double backtracking_ratio;
       const double minimum_step_length;
       const bool scale_duals_with_step_length;
+      const size_t maximum_number_second_order_corrections;
+      const double second_order_correction_infeasibility_decrease;
+      Direction second_order_correction{};
+      // watchdog: after a number of consecutive shortened steps, full steps are tentatively accepted for a few iterations.
+      // If no full step is accepted by the globalization strategy, the checkpoint iterate is restored
+      const size_t watchdog_trigger;
+      const size_t watchdog_maximum_tentative_iterations;
+      size_t number_consecutive_shortened_steps{0};
+      size_t watchdog_iteration{0}; // 0 if the watchdog is inactive
+      Iterate watchdog_checkpoint{0, 0};
+      // handles of the statistics columns
+      size_t iteration_column{};
+      size_t step_length_column{};
+      size_t SOC_column{};
+      size_t wasted_evaluations_column{};
+      // speculative backtracking: the objective and constraints at the next step lengths are evaluated concurrently on
+      // separate iterates. The candidates are then tested in the sequential order, so that the accepted step length is
+      // that of the sequential backtracking. The evaluations beyond the accepted candidate are wasted. The backtracking
+      // is sequential if the model evaluations are not thread-safe
+      const size_t number_speculative_step_lengths;
+      bool sequential_backtracking_reported{false};
+      ThreadPool speculative_thread_pool;
+      std::vector<Iterate> speculative_iterates{};
+      std::vector<double> speculative_step_lengths{};
+      std::vector<char> is_speculative_evaluation_successful{};
+      size_t number_speculative_candidates{0};
+      size_t next_speculative_candidate{0};
+      size_t number_wasted_speculative_evaluations{0};
 
       void backtrack_along_direction(Statistics& statistics, ConstraintRelaxationStrategy& constraint_relaxation_strategy,
          GlobalizationStrategy& globalization_strategy, const Model& model, Iterate& current_iterate, Iterate& trial_iterate,
-         Direction& direction, WarmstartInformation& warmstart_information, UserCallbacks& user_callbacks) const;
+         Direction& direction, WarmstartInformation& warmstart_information, UserCallbacks& user_callbacks, double initial_step_length = 1.);
+      void take_watchdog_step(Statistics& statistics, ConstraintRelaxationStrategy& constraint_relaxation_strategy,
+         GlobalizationStrategy& globalization_strategy, const Model& model, Iterate& current_iterate, Iterate& trial_iterate,
+         Direction& direction, WarmstartInformation& warmstart_information, UserCallbacks& user_callbacks);
+      [[nodiscard]] bool try_second_order_corrections(Statistics& statistics, ConstraintRelaxationStrategy& constraint_relaxation_strategy,
+         GlobalizationStrategy& globalization_strategy, const Model& model, Iterate& current_iterate, Iterate& trial_iterate,
+         const Direction& direction, double step_length, WarmstartInformation& warmstart_information, UserCallbacks& user_callbacks);
       [[nodiscard]] static bool terminate_with_small_step_length(Statistics& statistics, ConstraintRelaxationStrategy& constraint_relaxation_strategy,
          const Model& model, Iterate& trial_iterate);
       [[nodiscard]] double decrease_step_length(double step_length) const;
+      void evaluate_speculative_candidates(const Model& model, Iterate& current_iterate, const Direction& direction, double step_length);
+      void use_speculative_evaluations(const Model& model, Iterate& trial_iterate, double step_length);
+      void discard_speculative_candidates(Statistics& statistics);
       static void check_unboundedness(const Direction& direction);
 
-      static void set_LS_statistics(Statistics& statistics, size_t number_iterations);
+      void set_LS_statistics(Statistics& statistics, size_t number_iterations) const;
    };
 } // namespace
 
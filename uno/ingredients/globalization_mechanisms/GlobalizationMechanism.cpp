@@ -34,15 +34,15 @@ namespace uno {
 
    void GlobalizationMechanism::set_primal_statistics(Statistics& statistics, const Model& model, const Iterate& iterate) {
       if (iterate.is_objective_computed) {
-         statistics.set("objective", iterate.evaluations.objective);
+         statistics.set(statistics.objective_column, iterate.evaluations.objective);
       }
       if (model.is_constrained()) {
-         statistics.set("primal feas", iterate.progress.infeasibility);
+         statistics.set(statistics.primal_feasibility_column, iterate.progress.infeasibility);
       }
    }
 
    void GlobalizationMechanism::set_dual_residuals_statistics(Statistics& statistics, const Iterate& iterate) {
-      statistics.set("stationarity", iterate.residuals.stationarity);
-      statistics.set("complementarity", iterate.residuals.complementarity);
+      statistics.set(statistics.stationarity_column, iterate.residuals.stationarity);
+      statistics.set(statistics.complementarity_column, iterate.residuals.complementarity);
    }
 } // namespace
\ No newline at end of file
@@ -12,6 +12,7 @@
 #include "optimization/Iterate.hpp"
 #include "optimization/WarmstartInformation.hpp"
 #include "options/Options.hpp"
+#include "tools/CancellationToken.hpp"
 #include "tools/Logger.hpp"
 #include "tools/Statistics.hpp"
 
@@ -32,9 +33,9 @@ namespace uno {
    }
 
    void TrustRegionStrategy::initialize(Statistics& statistics, const Options& options) {
-      statistics.add_column("TR iter", Statistics::int_width + 2, options.get_int("statistics_minor_column_order"));
-      statistics.add_column("TR radius", Statistics::double_width - 4, options.get_int("statistics_TR_radius_column_order"));
-      statistics.set("TR radius", this->radius);
+      this->iteration_column = statistics.add_column("TR iter", Statistics::int_width + 2, options.get_int("statistics_minor_column_order"));
+      this->radius_column = statistics.add_column("TR radius", Statistics::double_width - 4, options.get_int("statistics_TR_radius_column_order"));
+      statistics.set(this->radius_column, this->radius);
    }
 
    void TrustRegionStrategy::compute_next_iterate(Statistics& statistics, ConstraintRelaxationStrategy& constraint_relaxation_strategy,
@@ -46,6 +47,7 @@ namespace uno {
       size_t number_iterations = 0;
       bool termination = false;
       while (!termination) {
+         CancellationToken::check();
          bool is_acceptable = false;
          try {
             ++number_iterations;
@@ -56,18 +58,18 @@ namespace uno {
             // compute the direction within the trust region
             constraint_relaxation_strategy.compute_feasible_direction(statistics, globalization_strategy, model, current_iterate,
                direction, this->radius, warmstart_information);
-            statistics.set("step norm", direction.norm);
+            statistics.set(statistics.step_norm_column, direction.norm);
 
             // deal with errors in the subproblem
             if (direction.status == SubproblemStatus::UNBOUNDED_PROBLEM) {
                // the subproblem is always bounded, but the objective may exceed a very large negative value
-               statistics.set("status", "unbounded subproblem");
+               statistics.set(statistics.status_column, "unbounded subproblem");
                if (Logger::level == INFO) statistics.print_current_line();
                this->decrease_radius_aggressively();
                warmstart_information.variable_bounds_changed = true;
             }
             else if (direction.status == SubproblemStatus::ERROR) {
-               statistics.set("status", "solver error");
+               statistics.set(statistics.status_column, "solver error");
                if (Logger::level == INFO) statistics.print_current_line();
                this->decrease_radius();
                // reset the Hessian representation of the subproblem solver
@@ -94,7 +96,7 @@ namespace uno {
          }
          // if an evaluation error occurs, decrease the radius
          catch (const EvaluationError&) {
-            statistics.set("status", "eval. error");
+            statistics.set(statistics.status_column, "eval. error");
             if (Logger::level == INFO) statistics.print_current_line();
             DEBUG << "A function could not be evaluated. The trust-region radius will be reduced\n";
             this->decrease_radius();
@@ -190,7 +192,7 @@ namespace uno {
    }
 
    void TrustRegionStrategy::set_TR_statistics(Statistics& statistics, size_t number_iterations) const {
-      statistics.set("TR iter", number_iterations);
-      statistics.set("TR radius", this->radius);
+      statistics.set(this->iteration_column, number_iterations);
+      statistics.set(this->radius_column, this->radius);
    }
 } // namespace
@@ -28,6 +28,9 @@ namespace uno {
       const double minimum_radius;
       const double radius_reset_threshold;
       const double primal_tolerance;
+      // handles of the statistics columns
+      size_t iteration_column{};
+      size_t radius_column{};
 
       [[nodiscard]] bool is_iterate_acceptable(Statistics& statistics, ConstraintRelaxationStrategy& constraint_relaxation_strategy,
          GlobalizationStrategy& globalization_strategy, const Model& model, Iterate& current_iterate, Iterate& trial_iterate,
@@ -25,6 +25,9 @@ namespace uno {
          const ProgressMeasures& trial_progress) const = 0;
 
       virtual void reset() = 0;
+      // save and restore the state of the strategy (e.g. for a watchdog line search)
+      virtual void save_checkpoint() = 0;
+      virtual void restore_checkpoint() = 0;
 
       virtual void notify_switch_to_feasibility(const ProgressMeasures& current_progress) = 0;
       virtual void notify_switch_to_optimality(const ProgressMeasures& current_progress) = 0;
@@ -12,7 +12,8 @@ namespace uno {
    }
 
    void l1MeritFunction::initialize(Statistics& statistics, const Iterate& /*initial_iterate*/, const Options& options) {
-      statistics.add_column("penalty", Statistics::double_width - 5, options.get_int("statistics_penalty_parameter_column_order"));
+      this->penalty_column = statistics.add_column("penalty", Statistics::double_width - 5,
+         options.get_int("statistics_penalty_parameter_column_order"));
    }
 
    bool l1MeritFunction::is_iterate_acceptable(Statistics& statistics, const ProgressMeasures& current_progress,
@@ -30,17 +31,17 @@ namespace uno {
       DEBUG << "Current merit: " << current_merit_value << '\n';
       DEBUG << "Trial merit:   " << trial_merit_value << '\n';
       DEBUG << "Actual reduction: " << current_merit_value << " - " << trial_merit_value << " = " << actual_reduction << '\n';
-      statistics.set("penalty", objective_multiplier);
+      statistics.set(this->penalty_column, objective_multiplier);
 
       // Armijo sufficient decrease condition
       const bool accept = this->armijo_sufficient_decrease(constrained_predicted_reduction, actual_reduction);
       if (accept) {
          DEBUG << "Trial iterate was accepted by satisfying Armijo condition\n";
          this->smallest_known_infeasibility = std::min(this->smallest_known_infeasibility, trial_progress.infeasibility);
-         statistics.set("status", "✔ (Armijo)");
+         statistics.set(statistics.status_column, "✔ (Armijo)");
       }
       else {
-         statistics.set("status", "✘ (Armijo)");
+         statistics.set(statistics.status_column, "✘ (Armijo)");
       }
       return accept;
    }
@@ -54,6 +55,14 @@ namespace uno {
    void l1MeritFunction::reset() {
    }
 
+   void l1MeritFunction::save_checkpoint() {
+      this->checkpoint_smallest_known_infeasibility = this->smallest_known_infeasibility;
+   }
+
+   void l1MeritFunction::restore_checkpoint() {
+      this->smallest_known_infeasibility = this->checkpoint_smallest_known_infeasibility;
+   }
+
    void l1MeritFunction::notify_switch_to_feasibility(const ProgressMeasures& /*current_progress*/) {
    }
 
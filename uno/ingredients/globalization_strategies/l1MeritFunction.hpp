@@ -18,6 +18,8 @@ namespace uno {
             const ProgressMeasures& trial_progress, const ProgressMeasures& predicted_reduction, double objective_multiplier) override;
       [[nodiscard]] bool is_infeasibility_sufficiently_reduced(const ProgressMeasures& current_progress, const ProgressMeasures& trial_progress) const override;
       void reset() override;
+      void save_checkpoint() override;
+      void restore_checkpoint() override;
       void notify_switch_to_feasibility(const ProgressMeasures& current_progress) override;
       void notify_switch_to_optimality(const ProgressMeasures& current_progress) override;
 
@@ -25,6 +27,8 @@ namespace uno {
 
    protected:
       double smallest_known_infeasibility{INF<double>};
+      double checkpoint_smallest_known_infeasibility{INF<double>};
+      size_t penalty_column{}; // handle of the statistics column
 
       [[nodiscard]] static double constrained_merit_function(const ProgressMeasures& progress, double objective_multiplier);
       [[nodiscard]] double compute_merit_actual_reduction(double current_merit_value, double trial_merit_value) const;
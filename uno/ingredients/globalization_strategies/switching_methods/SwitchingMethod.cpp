@@ -60,7 +60,7 @@ namespace uno {
          DEBUG << "Trial iterate (h-type) was rejected by violating the Armijo condition\n";
       }
       Iterate::number_eval_objective--;
-      statistics.set("status", std::string(accept ? "✔" : "✘") + " (restoration)");
+      statistics.set(statistics.status_column, accept ? "✔ (restoration)" : "✘ (restoration)");
       return accept;
    }
 } // namespace
\ No newline at end of file
@@ -27,6 +27,14 @@ namespace uno {
       this->filter->reset();
    }
 
+   void FilterMethod::save_checkpoint() {
+      this->filter->save_checkpoint();
+   }
+
+   void FilterMethod::restore_checkpoint() {
+      this->filter->restore_checkpoint();
+   }
+
    void FilterMethod::notify_switch_to_feasibility(const ProgressMeasures& current_progress) {
       const double current_objective_measure = SwitchingMethod::unconstrained_merit_function(current_progress);
       this->filter->add(current_progress.infeasibility, current_objective_measure);
@@ -24,6 +24,8 @@ namespace uno {
 
       void initialize(Statistics& statistics, const Iterate& initial_iterate, const Options& options) override;
       void reset() override;
+      void save_checkpoint() override;
+      void restore_checkpoint() override;
       void notify_switch_to_feasibility(const ProgressMeasures& current_progress) override;
       void notify_switch_to_optimality(const ProgressMeasures& current_progress) override;
 
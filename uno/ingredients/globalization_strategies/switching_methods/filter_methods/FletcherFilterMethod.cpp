@@ -23,7 +23,8 @@ namespace uno {
       DEBUG << "Current filter:\n" << *this->filter << '\n';
       DEBUG << "Unconstrained predicted reduction = " << merit_predicted_reduction << '\n';
 
-      std::string scenario;
+      // literal status of the acceptance test: nothing is formatted
+      std::string_view status;
       bool accept = false;
       if (this->filter->acceptable(trial_progress.infeasibility, trial_merit)) {
          if (this->filter->acceptable_wrt_current_iterate(current_progress.infeasibility, current_merit, trial_progress.infeasibility, trial_merit)) {
@@ -39,7 +40,7 @@ namespace uno {
                else { // switching condition holds, but not Armijo condition
                   DEBUG << "Trial iterate (f-type) was rejected by violating the Armijo condition\n";
                }
-               scenario = "f-type";
+               status = accept ? "✔ (f-type)" : "✘ (f-type)";
             }
                // switching condition violated: predicted reduction is not promising (h-type)
             else {
@@ -47,19 +48,19 @@ namespace uno {
                accept = true;
                this->filter->add(current_progress.infeasibility, current_merit);
                DEBUG << "Current iterate was added to the filter\n";
-               scenario = "h-type";
+               status = "✔ (h-type)";
             }
          }
          else {
             DEBUG << "Trial iterate not acceptable with respect to current point\n";
-            scenario = "current";
+            status = "✘ (current)";
          }
       }
       else {
          DEBUG << "Trial iterate not filter acceptable\n";
-         scenario = "filter";
+         status = "✘ (filter)";
       }
-      statistics.set("status", std::string(accept ? "✔" : "✘") + " (" + scenario + ")");
+      statistics.set(statistics.status_column, status);
       return accept;
    }
 
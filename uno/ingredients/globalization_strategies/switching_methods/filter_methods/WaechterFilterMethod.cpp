@@ -33,7 +33,7 @@ namespace uno {
       DEBUG << "Current filter:\n" << *this->filter;
       DEBUG << "Unconstrained predicted reduction = " << merit_predicted_reduction << '\n';
 
-      std::string scenario;
+      std::string_view status;
       bool accept = false;
       if (this->filter->acceptable(trial_progress.infeasibility, trial_merit)) {
          const double merit_actual_reduction = this->compute_actual_objective_reduction(current_merit, current_progress.infeasibility, trial_merit);
@@ -55,7 +55,7 @@ namespace uno {
             else {
                DEBUG << "Armijo condition not satisfied\n";
             }
-            scenario = "f-type";
+            status = accept ? "✔ (f-type)" : "✘ (f-type)";
          }
          else {
             DEBUG << "Switching condition violated\n";
@@ -66,7 +66,7 @@ namespace uno {
             else {
                DEBUG << "Trial iterate (h-type) not acceptable with respect to current point\n";
             }
-            scenario = "h-type";
+            status = accept ? "✔ (h-type)" : "✘ (h-type)";
          }
          // possibly augment the filter
          if (accept && (!switching || !sufficient_decrease)) {
@@ -76,9 +76,9 @@ namespace uno {
       }
       else {
          DEBUG << "Trial iterate not filter acceptable\n";
-         scenario = "filter";
+         status = "✘ (filter)";
       }
-      statistics.set("status", std::string(accept ? "✔" : "✘") + " (" + scenario + ")");
+      statistics.set(statistics.status_column, status);
       return accept;
    }
 
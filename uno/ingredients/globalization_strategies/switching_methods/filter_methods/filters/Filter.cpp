@@ -22,6 +22,20 @@ namespace uno {
       this->number_entries = 0;
    }
 
+   void Filter::save_checkpoint() {
+      this->checkpoint_infeasibility = this->infeasibility;
+      this->checkpoint_objective = this->objective;
+      this->checkpoint_infeasibility_upper_bound = this->infeasibility_upper_bound;
+      this->checkpoint_number_entries = this->number_entries;
+   }
+
+   void Filter::restore_checkpoint() {
+      this->infeasibility = this->checkpoint_infeasibility;
+      this->objective = this->checkpoint_objective;
+      this->infeasibility_upper_bound = this->checkpoint_infeasibility_upper_bound;
+      this->number_entries = this->checkpoint_number_entries;
+   }
+
    bool Filter::is_empty() const {
       return (this->number_entries == 0);
    }
@@ -23,6 +23,8 @@ namespace uno {
       virtual ~Filter() = default;
 
       void reset();
+      void save_checkpoint();
+      void restore_checkpoint();
       [[nodiscard]] double get_smallest_infeasibility() const;
       void set_infeasibility_upper_bound(double new_upper_bound);
 
@@ -44,6 +46,11 @@ namespace uno {
       double infeasibility_upper_bound{INF<double>}; /*!< Upper bound on infeasibility measure */
       size_t number_entries{0};
       const FilterParameters parameters; /*!< Set of parameters */
+      // copy of the entries saved by save_checkpoint()
+      std::vector<double> checkpoint_infeasibility{};
+      std::vector<double> checkpoint_objective{};
+      double checkpoint_infeasibility_upper_bound{INF<double>};
+      size_t checkpoint_number_entries{0};
 
       [[nodiscard]] bool is_empty() const;
       [[nodiscard]] bool acceptable_wrt_upper_bound(double trial_infeasibility) const;
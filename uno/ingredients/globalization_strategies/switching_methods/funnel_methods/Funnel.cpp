@@ -16,6 +16,14 @@ namespace uno {
       this->width = new_upper_bound;
    }
 
+   void Funnel::save_checkpoint() {
+      this->checkpoint_width = this->width;
+   }
+
+   void Funnel::restore_checkpoint() {
+      this->width = this->checkpoint_width;
+   }
+
    double Funnel::current_width() const {
       return this->width;
    }
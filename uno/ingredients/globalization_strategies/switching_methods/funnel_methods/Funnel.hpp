@@ -21,11 +21,14 @@ namespace uno {
       [[nodiscard]] bool sufficient_decrease_condition(double trial_infeasibility) const;
       void update(double current_infeasibility, double trial_infeasibility);
       void update_restoration(double current_infeasibility);
+      void save_checkpoint();
+      void restore_checkpoint();
 
       void print() const;
 
    protected:
       double width{INF<double>};
+      double checkpoint_width{INF<double>};
       const double margin;
       const int update_strategy;
       const double kappa;
@@ -26,8 +26,9 @@ namespace uno {
       this->funnel.set_infeasibility_upper_bound(upper_bound);
       DEBUG << "Current funnel width: " << this->funnel.current_width() << '\n';
 
-      statistics.add_column("funnel width", Statistics::double_width - 3, options.get_int("statistics_funnel_width_column_order"));
-      statistics.set("funnel width", this->funnel.current_width());
+      this->funnel_width_column = statistics.add_column("funnel width", Statistics::double_width - 3,
+         options.get_int("statistics_funnel_width_column_order"));
+      statistics.set(this->funnel_width_column, this->funnel.current_width());
    }
 
    bool FunnelMethod::is_regular_iterate_acceptable(Statistics& statistics, const ProgressMeasures& current_progress,
@@ -40,7 +41,7 @@ namespace uno {
       DEBUG << "Trial:   (infeasibility, objective + auxiliary) = (" << trial_progress.infeasibility << ", " << trial_merit << ")\n";
       DEBUG << "Unconstrained predicted reduction = " << merit_predicted_reduction << '\n';
 
-      std::string scenario;
+      std::string_view status;
       bool accept = false;
       if (this->funnel.acceptable(trial_progress.infeasibility)) {
          // IF require_acceptance_wrt_current_iterate == false, then condition always fulfilled, we never check
@@ -60,7 +61,7 @@ namespace uno {
                else { // switching condition holds, but not Armijo condition
                   DEBUG << "Trial iterate (f-type) was REJECTED by violating the Armijo condition\n";
                }
-               scenario = "f-type";
+               status = accept ? "✔ (f-type)" : "✘ (f-type)";
             }
             // h-type step
             else if (this->funnel.sufficient_decrease_condition(trial_progress.infeasibility)) {
@@ -69,25 +70,25 @@ namespace uno {
 
                DEBUG << "\t\tEntering funnel reduction mechanism\n";
                this->funnel.update(current_progress.infeasibility, trial_progress.infeasibility);
-               statistics.set("funnel width", this->funnel.current_width());
-               scenario = "h-type";
+               statistics.set(this->funnel_width_column, this->funnel.current_width());
+               status = "✔ (h-type)";
             }
             else {
                DEBUG << "\t\tTrial iterate REJECTED by violating switching and funnel sufficient decrease condition\n";
-               scenario = "funnel";
+               status = "✘ (funnel)";
             }
          }
          else {
             DEBUG << "Trial iterate not acceptable with respect to current point\n";
-            scenario = "current";
+            status = "✘ (current)";
          }
       }
       else {
          DEBUG << "\t\tTrial iterate REJECTED. Not in funnel\n";
-         scenario = "funnel";
+         status = "✘ (funnel)";
       }
 
-      statistics.set("status", std::string(accept ? "✔" : "✘") + " (" + scenario + ")");
+      statistics.set(statistics.status_column, status);
       if (accept) {
          this->funnel.print();
       }
@@ -103,6 +104,14 @@ namespace uno {
       // do nothing
    }
 
+   void FunnelMethod::save_checkpoint() {
+      this->funnel.save_checkpoint();
+   }
+
+   void FunnelMethod::restore_checkpoint() {
+      this->funnel.restore_checkpoint();
+   }
+
    void FunnelMethod::notify_switch_to_feasibility(const ProgressMeasures& /*current_progress_measures*/) {
    }
 
@@ -140,6 +149,6 @@ namespace uno {
    }
 
    void FunnelMethod::set_statistics(Statistics& statistics) const {
-      statistics.set("funnel width", this->funnel.current_width());
+      statistics.set(this->funnel_width_column, this->funnel.current_width());
    }
 } // namespace
@@ -29,6 +29,8 @@ namespace uno {
       [[nodiscard]] bool is_infeasibility_sufficiently_reduced(const ProgressMeasures& reference_progress,
             const ProgressMeasures& trial_progress) const override;
       void reset() override;
+      void save_checkpoint() override;
+      void restore_checkpoint() override;
       void notify_switch_to_feasibility(const ProgressMeasures& current_progress_measures) override;
       void notify_switch_to_optimality(const ProgressMeasures& current_progress_measures) override;
 
@@ -43,6 +45,7 @@ namespace uno {
       Funnel funnel;
       const FunnelMethodParameters parameters; /*!< Set of constants */
       const bool require_acceptance_wrt_current_iterate;
+      size_t funnel_width_column{}; // handle of the statistics column
 
       [[nodiscard]] bool is_regular_iterate_acceptable(Statistics& statistics, const ProgressMeasures& current_progress,
             const ProgressMeasures& trial_progress, const ProgressMeasures& predicted_reduction) override;
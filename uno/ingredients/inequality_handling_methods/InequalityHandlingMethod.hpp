@@ -34,6 +34,11 @@ namespace uno {
       virtual void solve(Statistics& statistics, const OptimizationProblem& problem, Iterate& current_iterate,
          Direction& direction, HessianModel& hessian_model, RegularizationStrategy<double>& regularization_strategy,
          double trust_region_radius, WarmstartInformation& warmstart_information) = 0;
+      // second-order correction of a rejected trial iterate, computed without refactorization. Returns false if the method
+      // does not support corrections
+      [[nodiscard]] virtual bool compute_second_order_correction(const OptimizationProblem& problem, Iterate& current_iterate,
+         Iterate& trial_iterate, double primal_step_length, Direction& correction, HessianModel& hessian_model,
+         RegularizationStrategy<double>& regularization_strategy) = 0;
 
       virtual void initialize_feasibility_problem(const l1RelaxedProblem& problem, Iterate& current_iterate) = 0;
       virtual void exit_feasibility_problem(const OptimizationProblem& problem, Iterate& trial_iterate) = 0;
@@ -59,6 +64,8 @@ namespace uno {
       size_t number_subproblems_solved{0};
       // when the parameterization of the subproblem (e.g. penalty or barrier parameter) is updated, signal it
       bool subproblem_definition_changed{false};
+      // when only the auxiliary measure changed (e.g. free-mode barrier parameter), the globalization strategy is kept
+      bool auxiliary_measure_changed{false};
 
       [[nodiscard]] virtual std::string get_name() const = 0;
    };
@@ -1,6 +1,7 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
 #include "InequalityConstrainedMethod.hpp"
 #include "optimization/Iterate.hpp"
 #include "ingredients/constraint_relaxation_strategies/l1RelaxedProblem.hpp"
@@ -9,8 +10,10 @@
 #include "ingredients/subproblem_solvers/BoxLPSolverFactory.hpp"
 #include "ingredients/subproblem_solvers/LPSolverFactory.hpp"
 #include "ingredients/subproblem_solvers/QPSolverFactory.hpp"
+#include "linear_algebra/SparseVector.hpp"
 #include "optimization/Direction.hpp"
 #include "optimization/EvaluationSpace.hpp"
+#include "optimization/OptimizationProblem.hpp"
 #include "symbolic/VectorView.hpp"
 #include "tools/Logger.hpp"
 
@@ -46,8 +49,20 @@ namespace uno {
       // do nothing
    }
 
-   void InequalityConstrainedMethod::generate_initial_iterate(const OptimizationProblem& /*problem*/, Iterate& /*initial_iterate*/) {
+   void InequalityConstrainedMethod::generate_initial_iterate(const OptimizationProblem& problem, Iterate& initial_iterate) {
       // TODO enforce linear constraints
+      // set the slack variables (if any) to the constraint values projected onto the slack bounds
+      if (!problem.model.get_slacks().is_empty()) {
+         initial_iterate.evaluate_constraints(problem.model);
+         for (const auto [constraint_index, slack_index]: problem.model.get_slacks()) {
+            initial_iterate.primals[slack_index] = std::min(std::max(initial_iterate.evaluations.constraints[constraint_index],
+               problem.variable_lower_bound(slack_index)), problem.variable_upper_bound(slack_index));
+         }
+         // since the slacks have been set, the function evaluations should also be updated
+         initial_iterate.is_objective_gradient_computed = false;
+         initial_iterate.are_constraints_computed = false;
+         initial_iterate.is_constraint_jacobian_computed = false;
+      }
    }
 
    void InequalityConstrainedMethod::solve(Statistics& statistics, const OptimizationProblem& problem, Iterate& current_iterate,
@@ -62,6 +77,13 @@ namespace uno {
       this->initial_point.fill(0.);
    }
 
+   // the QP solvers do not expose their factorization: second-order corrections are not supported
+   bool InequalityConstrainedMethod::compute_second_order_correction(const OptimizationProblem& /*problem*/, Iterate& /*current_iterate*/,
+         Iterate& /*trial_iterate*/, double /*primal_step_length*/, Direction& /*correction*/, HessianModel& /*hessian_model*/,
+         RegularizationStrategy<double>& /*regularization_strategy*/) {
+      return false;
+   }
+
    void InequalityConstrainedMethod::initialize_feasibility_problem(const l1RelaxedProblem& /*problem*/, Iterate& /*current_iterate*/) {
       // do nothing
    }
@@ -25,6 +25,9 @@ namespace uno {
       void solve(Statistics& statistics, const OptimizationProblem& problem, Iterate& current_iterate,
          Direction& direction, HessianModel& hessian_model, RegularizationStrategy<double>& regularization_strategy,
          double trust_region_radius, WarmstartInformation& warmstart_information) override;
+      [[nodiscard]] bool compute_second_order_correction(const OptimizationProblem& problem, Iterate& current_iterate,
+         Iterate& trial_iterate, double primal_step_length, Direction& correction, HessianModel& hessian_model,
+         RegularizationStrategy<double>& regularization_strategy) override;
 
       void initialize_feasibility_problem(const l1RelaxedProblem& problem, Iterate& current_iterate) override;
       void exit_feasibility_problem(const OptimizationProblem& problem, Iterate& trial_iterate) override;
@@ -0,0 +1,130 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "AdaptiveBarrierParameterUpdateStrategy.hpp"
+#include "PrimalDualInteriorPointProblem.hpp"
+#include "optimization/Iterate.hpp"
+#include "tools/Logger.hpp"
+#include "options/Options.hpp"
+
+namespace uno {
+   AdaptiveBarrierParameterUpdateStrategy::AdaptiveBarrierParameterUpdateStrategy(const Options& options):
+      BarrierParameterUpdateStrategy(options),
+      monotone_strategy(options),
+      probing_oracle(options.get_string("barrier_adaptive_oracle") == "probing"),
+      maximum_barrier_parameter(options.get_double("barrier_adaptive_maximum_parameter")),
+      sufficient_progress_factor(options.get_double("barrier_adaptive_sufficient_progress")),
+      number_reference_errors(options.get_unsigned_int("barrier_adaptive_reference_errors")),
+      monotone_initial_factor(options.get_double("barrier_adaptive_monotone_initial_factor")) {
+      const std::string& oracle = options.get_string("barrier_adaptive_oracle");
+      if (oracle != "loqo" && oracle != "probing") {
+         throw std::invalid_argument("The barrier oracle " + oracle + " is not supported");
+      }
+   }
+
+   void AdaptiveBarrierParameterUpdateStrategy::set_barrier_parameter(double new_barrier_parameter) {
+      BarrierParameterUpdateStrategy::set_barrier_parameter(new_barrier_parameter);
+      this->monotone_strategy.set_barrier_parameter(new_barrier_parameter);
+   }
+
+   bool AdaptiveBarrierParameterUpdateStrategy::update_barrier_parameter(const PrimalDualInteriorPointProblem& barrier_problem,
+         const Iterate& current_iterate, const DualResiduals& residuals) {
+      const auto [average_complementarity, minimum_complementarity] = barrier_problem.compute_average_and_minimum_complementarity(
+         current_iterate.primals, current_iterate.multipliers);
+      if (average_complementarity <= 0.) {
+         // no bounds: the barrier parameter is irrelevant
+         return false;
+      }
+      const double primal_feasibility = (barrier_problem.get_objective_multiplier() == 0.) ? 0. : current_iterate.primal_feasibility;
+      const double primal_dual_error = std::max({
+         residuals.stationarity / residuals.stationarity_scaling,
+         primal_feasibility,
+         residuals.complementarity / residuals.complementarity_scaling
+      });
+
+      if (this->free_mode) {
+         if (this->is_sufficient_progress(primal_dual_error)) {
+            this->add_reference_error(primal_dual_error);
+            if (this->probing_oracle) {
+               // the barrier parameter is computed once the augmented system is factorized
+               return false;
+            }
+            const double new_barrier_parameter = this->safeguard(this->loqo_barrier_parameter(average_complementarity, minimum_complementarity));
+            DEBUG << "Free mode: barrier parameter mu updated to " << new_barrier_parameter << '\n';
+            const bool parameter_updated = (new_barrier_parameter != this->barrier_parameter);
+            this->barrier_parameter = new_barrier_parameter;
+            return parameter_updated;
+         }
+         // safeguard: switch to the monotone mode
+         this->free_mode = false;
+         this->monotone_strategy.set_barrier_parameter(this->safeguard(this->monotone_initial_factor * average_complementarity));
+         this->barrier_parameter = this->monotone_strategy.get_barrier_parameter();
+         DEBUG << "Insufficient progress in free mode, switching to monotone mode with mu = " << this->barrier_parameter << '\n';
+         return true;
+      }
+      else {
+         const bool parameter_updated = this->monotone_strategy.update_barrier_parameter(barrier_problem, current_iterate, residuals);
+         this->barrier_parameter = this->monotone_strategy.get_barrier_parameter();
+         if (parameter_updated) {
+            // the monotone barrier subproblem was solved: switch back to the free mode
+            DEBUG << "Switching back to free mode\n";
+            this->free_mode = true;
+            this->reference_errors.clear();
+            this->add_reference_error(primal_dual_error);
+         }
+         return parameter_updated;
+      }
+   }
+
+   bool AdaptiveBarrierParameterUpdateStrategy::uses_probing() const {
+      return this->free_mode && this->probing_oracle;
+   }
+
+   bool AdaptiveBarrierParameterUpdateStrategy::update_barrier_parameter_by_probing(double average_complementarity,
+         double affine_complementarity) {
+      const double new_barrier_parameter = this->safeguard(this->probing_barrier_parameter(average_complementarity, affine_complementarity));
+      const bool parameter_updated = (new_barrier_parameter != this->barrier_parameter);
+      this->barrier_parameter = new_barrier_parameter;
+      return parameter_updated;
+   }
+
+   bool AdaptiveBarrierParameterUpdateStrategy::is_free_mode() const {
+      return this->free_mode;
+   }
+
+   std::string AdaptiveBarrierParameterUpdateStrategy::get_mode() const {
+      return this->free_mode ? (this->probing_oracle ? "probing" : "LOQO") : "monotone";
+   }
+
+   // the primal-dual error should be sufficiently smaller than the largest of the reference errors
+   bool AdaptiveBarrierParameterUpdateStrategy::is_sufficient_progress(double primal_dual_error) const {
+      if (this->reference_errors.empty()) {
+         return true;
+      }
+      const double largest_reference_error = *std::max_element(this->reference_errors.cbegin(), this->reference_errors.cend());
+      return (primal_dual_error <= this->sufficient_progress_factor * largest_reference_error);
+   }
+
+   void AdaptiveBarrierParameterUpdateStrategy::add_reference_error(double primal_dual_error) {
+      this->reference_errors.push_back(primal_dual_error);
+      if (this->number_reference_errors < this->reference_errors.size()) {
+         this->reference_errors.pop_front();
+      }
+   }
+
+   // LOQO rule (Vanderbei & Shanno, 1999): sigma = 0.1 min(0.05 (1 - xi)/xi, 2)^3 where xi measures the deviation from
+   // centrality
+   double AdaptiveBarrierParameterUpdateStrategy::loqo_barrier_parameter(double average_complementarity, double minimum_complementarity) const {
+      const double centrality = minimum_complementarity / average_complementarity;
+      const double factor = (0. < centrality) ? std::min(0.05 * (1. - centrality) / centrality, 2.) : 2.;
+      const double centering_parameter = 0.1 * std::pow(factor, 3);
+      return centering_parameter * average_complementarity;
+   }
+
+   double AdaptiveBarrierParameterUpdateStrategy::safeguard(double barrier_parameter) const {
+      return std::min(this->maximum_barrier_parameter, std::max(this->minimum_barrier_parameter, barrier_parameter));
+   }
+} // namespace
@@ -0,0 +1,46 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_ADAPTIVEBARRIERPARAMETERUPDATESTRATEGY_H
+#define UNO_ADAPTIVEBARRIERPARAMETERUPDATESTRATEGY_H
+
+#include <cstddef>
+#include <deque>
+#include "BarrierParameterUpdateStrategy.hpp"
+#include "MonotoneBarrierParameterUpdateStrategy.hpp"
+
+namespace uno {
+   // adaptive (free-mode) rule (Nocedal, Waechter & Waltz, 2009): the barrier parameter is recomputed at each iteration by
+   // an oracle, either the LOQO rule or probing along the affine-scaling direction. As a safeguard, the strategy falls back
+   // to the monotone mode when the primal-dual error does not decrease sufficiently, and returns to the free mode once the
+   // monotone barrier subproblem is solved
+   class AdaptiveBarrierParameterUpdateStrategy: public BarrierParameterUpdateStrategy {
+   public:
+      explicit AdaptiveBarrierParameterUpdateStrategy(const Options& options);
+
+      void set_barrier_parameter(double new_barrier_parameter) override;
+      [[nodiscard]] bool update_barrier_parameter(const PrimalDualInteriorPointProblem& barrier_problem,
+         const Iterate& current_iterate, const DualResiduals& residuals) override;
+      [[nodiscard]] bool uses_probing() const override;
+      [[nodiscard]] bool update_barrier_parameter_by_probing(double average_complementarity, double affine_complementarity) override;
+      [[nodiscard]] bool is_free_mode() const override;
+      [[nodiscard]] std::string get_mode() const override;
+
+   protected:
+      MonotoneBarrierParameterUpdateStrategy monotone_strategy;
+      const bool probing_oracle;
+      const double maximum_barrier_parameter;
+      const double sufficient_progress_factor;
+      const size_t number_reference_errors;
+      const double monotone_initial_factor;
+      bool free_mode{true};
+      std::deque<double> reference_errors{};
+
+      [[nodiscard]] bool is_sufficient_progress(double primal_dual_error) const;
+      void add_reference_error(double primal_dual_error);
+      [[nodiscard]] double loqo_barrier_parameter(double average_complementarity, double minimum_complementarity) const;
+      [[nodiscard]] double safeguard(double barrier_parameter) const;
+   };
+} // namespace
+
+#endif // UNO_ADAPTIVEBARRIERPARAMETERUPDATESTRATEGY_H
@@ -3,22 +3,16 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include "BarrierParameterUpdateStrategy.hpp"
-#include "PrimalDualInteriorPointProblem.hpp"
-#include "optimization/Iterate.hpp"
 #include "tools/Logger.hpp"
 #include "options/Options.hpp"
 
 namespace uno {
    BarrierParameterUpdateStrategy::BarrierParameterUpdateStrategy(const Options& options):
       barrier_parameter(options.get_double("barrier_initial_parameter")),
-      dual_tolerance(options.get_double("dual_tolerance")),
-      parameters({
-         options.get_double("barrier_k_mu"),
-         options.get_double("barrier_theta_mu"),
-         options.get_double("barrier_k_epsilon"),
-         options.get_double("barrier_update_fraction")
-      }) {
+      minimum_barrier_parameter(options.get_double("dual_tolerance") / options.get_double("barrier_update_fraction")),
+      centering_exponent(options.get_double("barrier_centering_exponent")) {
    }
 
    double BarrierParameterUpdateStrategy::get_barrier_parameter() const {
@@ -30,36 +24,25 @@ namespace uno {
       this->barrier_parameter = new_barrier_parameter;
    }
 
-   bool BarrierParameterUpdateStrategy::update_barrier_parameter(const PrimalDualInteriorPointProblem& barrier_problem,
-         const Iterate& current_iterate, const DualResiduals& residuals) {
-      // primal-dual errors
-      const double scaled_stationarity = residuals.stationarity / residuals.stationarity_scaling;
-      const double primal_feasibility = (barrier_problem.get_objective_multiplier() == 0.) ? 0. : current_iterate.primal_feasibility;
-      double primal_dual_error = std::max({
-         scaled_stationarity,
-         primal_feasibility,
-         residuals.complementarity / residuals.complementarity_scaling
-      });
-      DEBUG << "Max scaled primal-dual error for barrier subproblem is " << primal_dual_error << '\n';
-
-      // update the barrier parameter (Eq. 7 in IPOPT paper)
-      const double tolerance_fraction = this->dual_tolerance / this->parameters.update_fraction;
-      bool parameter_updated = false;
-      while (primal_dual_error <= this->parameters.k_epsilon * this->barrier_parameter && tolerance_fraction < this->barrier_parameter) {
-         this->barrier_parameter = std::max(tolerance_fraction, std::min(this->parameters.k_mu * this->barrier_parameter,
-            std::pow(this->barrier_parameter, this->parameters.theta_mu)));
-         DEBUG << "Barrier parameter mu updated to " << this->barrier_parameter << '\n';
-         // update complementarity error
-         double scaled_complementarity_error = barrier_problem.compute_centrality_error(current_iterate.primals,
-            current_iterate.multipliers, this->barrier_parameter) / residuals.complementarity_scaling;
-         primal_dual_error = std::max({
-            scaled_stationarity,
-            primal_feasibility,
-            scaled_complementarity_error
-         });
-         DEBUG << "Max scaled primal-dual error for barrier subproblem is " << primal_dual_error << '\n';
-         parameter_updated = true;
-      }
+   bool BarrierParameterUpdateStrategy::update_barrier_parameter_by_probing(double average_complementarity,
+         double affine_complementarity) {
+      const double new_barrier_parameter = this->probing_barrier_parameter(average_complementarity, affine_complementarity);
+      const bool parameter_updated = (new_barrier_parameter != this->barrier_parameter);
+      this->barrier_parameter = new_barrier_parameter;
       return parameter_updated;
    }
+
+   bool BarrierParameterUpdateStrategy::is_free_mode() const {
+      return false;
+   }
+
+   // adaptive rule of Mehrotra's predictor-corrector: mu = sigma * average complementarity, where the centering parameter
+   // sigma = (average complementarity after the affine-scaling step / average complementarity)^exponent
+   double BarrierParameterUpdateStrategy::probing_barrier_parameter(double average_complementarity, double affine_complementarity) const {
+      assert(0. < average_complementarity && "The average complementarity should be positive.");
+      const double centering_parameter = std::min(1., std::pow(affine_complementarity / average_complementarity, this->centering_exponent));
+      const double new_barrier_parameter = std::max(this->minimum_barrier_parameter, centering_parameter * average_complementarity);
+      DEBUG << "Centering parameter sigma = " << centering_parameter << ", barrier parameter mu updated to " << new_barrier_parameter << '\n';
+      return new_barrier_parameter;
+   }
 } // namespace
@@ -4,6 +4,8 @@
 #ifndef UNO_BARRIERPARAMETERUPDATESTRATEGY_H
 #define UNO_BARRIERPARAMETERUPDATESTRATEGY_H
 
+#include <string>
+
 namespace uno {
    // forward declarations
    class DualResiduals;
@@ -12,25 +14,30 @@ namespace uno {
    class Options;
    class PrimalDualInteriorPointProblem;
 
-   struct UpdateParameters {
-      double k_mu;
-      double theta_mu;
-      double k_epsilon;
-      double update_fraction;
-   };
-
    class BarrierParameterUpdateStrategy {
    public:
       explicit BarrierParameterUpdateStrategy(const Options& options);
+      virtual ~BarrierParameterUpdateStrategy() = default;
+
       [[nodiscard]] double get_barrier_parameter() const;
-      void set_barrier_parameter(double new_barrier_parameter);
-      [[nodiscard]] bool update_barrier_parameter(const PrimalDualInteriorPointProblem& barrier_problem,
-         const Iterate& current_iterate, const DualResiduals& residuals);
+      virtual void set_barrier_parameter(double new_barrier_parameter);
+      // update before the augmented system is factorized
+      [[nodiscard]] virtual bool update_barrier_parameter(const PrimalDualInteriorPointProblem& barrier_problem,
+         const Iterate& current_iterate, const DualResiduals& residuals) = 0;
+      // update once the augmented system is factorized, by probing along the affine-scaling direction
+      [[nodiscard]] virtual bool uses_probing() const = 0;
+      [[nodiscard]] virtual bool update_barrier_parameter_by_probing(double average_complementarity, double affine_complementarity);
+      // in free mode, the barrier parameter is recomputed at each iteration
+      [[nodiscard]] virtual bool is_free_mode() const;
+      // current mode of the strategy (reported in the statistics)
+      [[nodiscard]] virtual std::string get_mode() const = 0;
 
    protected:
       double barrier_parameter;
-      const double dual_tolerance;
-      const UpdateParameters parameters;
+      const double minimum_barrier_parameter;
+      const double centering_exponent;
+
+      [[nodiscard]] double probing_barrier_parameter(double average_complementarity, double affine_complementarity) const;
    };
 } // namespace
 
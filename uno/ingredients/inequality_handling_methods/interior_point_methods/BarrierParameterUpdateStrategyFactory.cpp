@@ -0,0 +1,22 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <string>
+#include <stdexcept>
+#include "BarrierParameterUpdateStrategyFactory.hpp"
+#include "AdaptiveBarrierParameterUpdateStrategy.hpp"
+#include "MonotoneBarrierParameterUpdateStrategy.hpp"
+#include "options/Options.hpp"
+
+namespace uno {
+   std::unique_ptr<BarrierParameterUpdateStrategy> BarrierParameterUpdateStrategyFactory::create(const Options& options) {
+      const std::string& strategy_type = options.get_string("barrier_update_strategy");
+      if (strategy_type == "monotone") {
+         return std::make_unique<MonotoneBarrierParameterUpdateStrategy>(options);
+      }
+      else if (strategy_type == "adaptive") {
+         return std::make_unique<AdaptiveBarrierParameterUpdateStrategy>(options);
+      }
+      throw std::invalid_argument("Barrier parameter update strategy " + strategy_type + " is not supported");
+   }
+} // namespace
@@ -0,0 +1,23 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_BARRIERPARAMETERUPDATESTRATEGYFACTORY_H
+#define UNO_BARRIERPARAMETERUPDATESTRATEGYFACTORY_H
+
+#include <array>
+#include <memory>
+
+namespace uno {
+   // forward declarations
+   class BarrierParameterUpdateStrategy;
+   class Options;
+
+   class BarrierParameterUpdateStrategyFactory {
+   public:
+      static std::unique_ptr<BarrierParameterUpdateStrategy> create(const Options& options);
+
+      constexpr static std::array available_strategies{"monotone", "adaptive"};
+   };
+} // namespace
+
+#endif // UNO_BARRIERPARAMETERUPDATESTRATEGYFACTORY_H
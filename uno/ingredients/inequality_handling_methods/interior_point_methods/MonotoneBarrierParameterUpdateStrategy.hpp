@@ -0,0 +1,32 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_MONOTONEBARRIERPARAMETERUPDATESTRATEGY_H
+#define UNO_MONOTONEBARRIERPARAMETERUPDATESTRATEGY_H
+
+#include "BarrierParameterUpdateStrategy.hpp"
+
+namespace uno {
+   struct UpdateParameters {
+      double k_mu;
+      double theta_mu;
+      double k_epsilon;
+   };
+
+   // Fiacco-McCormick monotone rule (Eq. 7 in IPOPT paper): the barrier parameter is decreased once the barrier
+   // subproblem is solved to a tolerance proportional to mu
+   class MonotoneBarrierParameterUpdateStrategy: public BarrierParameterUpdateStrategy {
+   public:
+      explicit MonotoneBarrierParameterUpdateStrategy(const Options& options);
+
+      [[nodiscard]] bool update_barrier_parameter(const PrimalDualInteriorPointProblem& barrier_problem,
+         const Iterate& current_iterate, const DualResiduals& residuals) override;
+      [[nodiscard]] bool uses_probing() const override;
+      [[nodiscard]] std::string get_mode() const override;
+
+   protected:
+      const UpdateParameters parameters;
+   };
+} // namespace
+
+#endif // UNO_MONOTONEBARRIERPARAMETERUPDATESTRATEGY_H
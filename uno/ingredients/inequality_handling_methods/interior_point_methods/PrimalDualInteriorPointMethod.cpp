@@ -1,13 +1,17 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
 #include <cmath>
 #include "PrimalDualInteriorPointMethod.hpp"
+#include "BarrierParameterUpdateStrategyFactory.hpp"
 #include "PrimalDualInteriorPointProblem.hpp"
 #include "ingredients/constraint_relaxation_strategies/l1RelaxedProblem.hpp"
 #include "ingredients/subproblem/Subproblem.hpp"
 #include "ingredients/subproblem_solvers/SymmetricIndefiniteLinearSolverFactory.hpp"
+#include "linear_algebra/Norm.hpp"
 #include "linear_algebra/SparseVector.hpp"
+#include "symbolic/VectorView.hpp"
 #include "optimization/Direction.hpp"
 #include "optimization/EvaluationSpace.hpp"
 #include "optimization/Iterate.hpp"
@@ -18,8 +22,10 @@
 namespace uno {
    PrimalDualInteriorPointMethod::PrimalDualInteriorPointMethod(const Options& options):
          InequalityHandlingMethod(),
-         linear_solver(SymmetricIndefiniteLinearSolverFactory::create(options.get_string("linear_solver"))),
-         barrier_parameter_update_strategy(options),
+         linear_solver(SymmetricIndefiniteLinearSolverFactory::create_augmented_system_solver(options.get_string("linear_solver"), options)),
+         least_square_linear_solver(SymmetricIndefiniteLinearSolverFactory::create_augmented_system_solver(
+            options.get_string("linear_solver"), options)),
+         barrier_parameter_update_strategy(BarrierParameterUpdateStrategyFactory::create(options)),
          previous_barrier_parameter(options.get_double("barrier_initial_parameter")),
          default_multiplier(options.get_double("barrier_default_multiplier")),
          parameters({
@@ -32,7 +38,8 @@ namespace uno {
                options.get_double("barrier_damping_factor")
          }),
          least_square_multiplier_max_norm(options.get_double("least_square_multiplier_max_norm")),
-         l1_constraint_violation_coefficient(options.get_double("l1_constraint_violation_coefficient")) {
+         l1_constraint_violation_coefficient(options.get_double("l1_constraint_violation_coefficient")),
+         predictor_corrector(options.get_bool("barrier_predictor_corrector")) {
    }
 
    void PrimalDualInteriorPointMethod::initialize(const OptimizationProblem& problem, Iterate& current_iterate,
@@ -46,10 +53,17 @@ namespace uno {
       const PrimalDualInteriorPointProblem barrier_problem(problem, this->barrier_parameter(), this->parameters);
       const Subproblem subproblem{barrier_problem, current_iterate, hessian_model, regularization_strategy, trust_region_radius};
       this->linear_solver->initialize_augmented_system(subproblem);
+      this->corrected_constraints.resize(problem.number_constraints);
+      this->trial_constraints.resize(problem.number_constraints);
+      this->affine_direction = Direction(problem.number_variables, problem.number_constraints);
+      this->augmented_solution.resize(problem.number_variables + problem.number_constraints);
+      this->augmented_solutions.resize(2 * (problem.number_variables + problem.number_constraints));
    }
 
    void PrimalDualInteriorPointMethod::initialize_statistics(Statistics& statistics, const Options& options) {
-      statistics.add_column("barrier", Statistics::double_width - 5, options.get_int("statistics_barrier_parameter_column_order"));
+      this->barrier_parameter_column = statistics.add_column("barrier", Statistics::double_width - 5, options.get_int("statistics_barrier_parameter_column_order"));
+      this->barrier_update_column = statistics.add_column("mu mode", Statistics::int_width + 2, options.get_int("statistics_barrier_update_column_order"));
+      this->linear_solver->initialize_statistics(statistics, options);
    }
 
    void PrimalDualInteriorPointMethod::generate_initial_iterate(const OptimizationProblem& problem, Iterate& initial_iterate) {
@@ -92,8 +106,8 @@ namespace uno {
          }
       }
 
-      if (0 < problem.number_constraints) {
-         // TODO compute least-square multipliers
+      if (0 < problem.number_constraints && 0. < this->least_square_multiplier_max_norm) {
+         this->compute_least_square_multipliers(problem, initial_iterate);
       }
    }
 
@@ -105,31 +119,47 @@ namespace uno {
       }
 
 
-      // possibly update the barrier parameter
-      if (!this->first_feasibility_iteration) {
+      // possibly update the barrier parameter (a probing strategy updates it once the matrix is factorized)
+      const bool update_barrier_parameter = !this->first_feasibility_iteration;
+      if (update_barrier_parameter) {
          const PrimalDualInteriorPointProblem barrier_problem(problem, this->barrier_parameter(), this->parameters);
          this->update_barrier_parameter(barrier_problem, current_iterate, current_iterate.residuals);
       }
+      this->first_feasibility_iteration = false;
+
+      // with a predictor-corrector or probing strategy, the first solve computes the affine-scaling (predictor) direction
+      const bool compute_predictor = update_barrier_parameter &&
+         (this->predictor_corrector || this->barrier_parameter_update_strategy->uses_probing());
+      if (compute_predictor && !this->predictor_corrector) {
+         this->compute_probing_direction(statistics, problem, current_iterate, direction, hessian_model, regularization_strategy,
+            warmstart_information);
+      }
       else {
-         this->first_feasibility_iteration = false;
+         // create the subproblem
+         const PrimalDualInteriorPointProblem barrier_problem = compute_predictor ?
+            PrimalDualInteriorPointProblem::affine_scaling_problem(problem, this->barrier_parameter(), this->parameters) :
+            PrimalDualInteriorPointProblem(problem, this->barrier_parameter(), this->parameters);
+         const Subproblem subproblem{barrier_problem, current_iterate, hessian_model, regularization_strategy,
+            trust_region_radius};
+
+         // compute the primal-dual solution
+         this->linear_solver->solve_indefinite_system(statistics, subproblem, direction, warmstart_information);
       }
-      statistics.set("barrier", this->barrier_parameter());
-
-      // create the subproblem
-      const PrimalDualInteriorPointProblem barrier_problem(problem, this->barrier_parameter(), this->parameters);
-      const Subproblem subproblem{barrier_problem, current_iterate, hessian_model, regularization_strategy,
-         trust_region_radius};
-
-      // compute the primal-dual solution
-      this->linear_solver->solve_indefinite_system(statistics, subproblem, direction, warmstart_information);
       ++this->number_subproblems_solved;
+      this->number_second_order_corrections = 0;
 
       // check whether the augmented matrix was singular, in which case the subproblem is infeasible
       if (this->linear_solver->matrix_is_singular()) {
+         this->set_barrier_statistics(statistics);
          direction.status = SubproblemStatus::INFEASIBLE;
          return;
       }
+      if (compute_predictor && this->predictor_corrector) {
+         this->compute_predictor_corrector_direction(problem, current_iterate, direction, hessian_model, regularization_strategy);
+      }
+      this->set_barrier_statistics(statistics);
       direction.subproblem_objective = this->evaluate_subproblem_objective(direction);
+      this->previous_primal_step_length = direction.primal_step_length;
 
       // determine if the direction is a "small direction" (Section 3.9 of the Ipopt paper) TODO
       const bool is_small_step = PrimalDualInteriorPointMethod::is_small_step(problem, current_iterate.primals,
@@ -139,8 +169,143 @@ namespace uno {
       }
    }
 
+   // second-order correction (Section 2.4 of the IPOPT paper): the constraint values of the rejected trial iterate are
+   // accumulated into c_soc = alpha c_soc + c(x_trial) (with c_soc = c(x_k) initially), where alpha is the fraction-to-boundary
+   // step length of the direction (alpha_max), then of the previous correction. The system is solved with the RHS -c_soc and
+   // the current factorization. The fraction-to-boundary rule is applied to the correction
+   bool PrimalDualInteriorPointMethod::compute_second_order_correction(const OptimizationProblem& problem, Iterate& current_iterate,
+         Iterate& trial_iterate, double /*primal_step_length*/, Direction& correction, HessianModel& hessian_model,
+         RegularizationStrategy<double>& regularization_strategy) {
+      const PrimalDualInteriorPointProblem barrier_problem(problem, this->barrier_parameter(), this->parameters);
+      if (this->number_second_order_corrections == 0) {
+         barrier_problem.evaluate_constraints(current_iterate, this->corrected_constraints);
+      }
+      barrier_problem.evaluate_constraints(trial_iterate, this->trial_constraints);
+      for (size_t constraint_index: Range(problem.number_constraints)) {
+         this->corrected_constraints[constraint_index] = this->previous_primal_step_length *
+            this->corrected_constraints[constraint_index] + this->trial_constraints[constraint_index];
+      }
+      ++this->number_second_order_corrections;
+
+      const Subproblem subproblem{barrier_problem, current_iterate, hessian_model, regularization_strategy, INF<double>};
+      this->linear_solver->solve_indefinite_system_with_corrected_constraints(subproblem, this->corrected_constraints, correction);
+      correction.status = SubproblemStatus::OPTIMAL;
+      correction.subproblem_objective = this->evaluate_subproblem_objective(correction);
+      this->previous_primal_step_length = correction.primal_step_length;
+      return true;
+   }
+
+   // the direction computed with the affine-scaling problem is the predictor (the Newton direction for mu = 0). The current
+   // factorization is reused to compute the direction for the new barrier parameter (computed by probing if the strategy
+   // uses it), corrected with the second-order terms dx_aff dz_aff in the complementarity conditions (Mehrotra's
+   // predictor-corrector). The affine-scaling direction is kept if the problem has no bounds
+   void PrimalDualInteriorPointMethod::compute_predictor_corrector_direction(const OptimizationProblem& problem,
+         Iterate& current_iterate, Direction& direction, HessianModel& hessian_model, RegularizationStrategy<double>& regularization_strategy) {
+      const PrimalDualInteriorPointProblem affine_problem = PrimalDualInteriorPointProblem::affine_scaling_problem(problem,
+         this->barrier_parameter(), this->parameters);
+      // affine-scaling direction (not scaled by the fraction-to-boundary rule)
+      this->affine_direction.primals = direction.primals;
+      this->affine_direction.multipliers = direction.multipliers;
+      const auto [average_complementarity, affine_complementarity] =
+         affine_problem.compute_affine_scaling_complementarity(current_iterate, this->affine_direction);
+      if (average_complementarity <= 0.) {
+         return;
+      }
+
+      // adaptive barrier parameter
+      if (this->barrier_parameter_update_strategy->uses_probing()) {
+         const bool barrier_parameter_updated = this->barrier_parameter_update_strategy->update_barrier_parameter_by_probing(
+            average_complementarity, affine_complementarity);
+         // probing is a free-mode update: the globalization strategy is kept
+         this->auxiliary_measure_changed = this->auxiliary_measure_changed || barrier_parameter_updated;
+      }
+
+      // centering-corrector direction
+      const PrimalDualInteriorPointProblem corrector_problem(problem, this->barrier_parameter(), this->parameters,
+         &this->affine_direction);
+      const Subproblem corrector_subproblem{corrector_problem, current_iterate, hessian_model, regularization_strategy, INF<double>};
+      this->linear_solver->solve_indefinite_system_with_new_objective_gradient(corrector_subproblem, this->augmented_solution);
+      corrector_subproblem.assemble_primal_dual_direction(this->augmented_solution, direction);
+      DEBUG << "Direction recomputed with mu = " << this->barrier_parameter() << '\n';
+   }
+
+   // probing without Mehrotra's corrector: the Newton direction is affine in the barrier parameter. The affine-scaling system
+   // (mu = 0) and the Newton system for the current mu_0 are solved at once with the same factorization, and the Newton
+   // direction for the barrier parameter mu computed by probing is d(mu) = d(0) + mu/mu_0 (d(mu_0) - d(0))
+   void PrimalDualInteriorPointMethod::compute_probing_direction(Statistics& statistics, const OptimizationProblem& problem,
+         Iterate& current_iterate, Direction& direction, HessianModel& hessian_model, RegularizationStrategy<double>& regularization_strategy,
+         const WarmstartInformation& warmstart_information) {
+      const double current_barrier_parameter = this->barrier_parameter();
+      const PrimalDualInteriorPointProblem affine_problem = PrimalDualInteriorPointProblem::affine_scaling_problem(problem,
+         current_barrier_parameter, this->parameters);
+      const Subproblem affine_subproblem{affine_problem, current_iterate, hessian_model, regularization_strategy, INF<double>};
+      const PrimalDualInteriorPointProblem current_problem(problem, current_barrier_parameter, this->parameters);
+      const Subproblem current_subproblem{current_problem, current_iterate, hessian_model, regularization_strategy, INF<double>};
+      this->linear_solver->solve_indefinite_systems(statistics, affine_subproblem, current_subproblem, warmstart_information,
+         this->augmented_solutions);
+      if (this->linear_solver->matrix_is_singular()) {
+         return;
+      }
+
+      // affine-scaling direction (not scaled by the fraction-to-boundary rule)
+      // (the solutions are stored contiguously)
+      const size_t dimension = this->augmented_solutions.size() / 2;
+      this->augmented_solution.resize(dimension);
+      std::copy(this->augmented_solutions.begin(), this->augmented_solutions.begin() + static_cast<std::ptrdiff_t>(dimension),
+         this->augmented_solution.begin());
+      affine_subproblem.assemble_primal_dual_direction(this->augmented_solution, this->affine_direction);
+      const auto [average_complementarity, affine_complementarity] =
+         affine_problem.compute_affine_scaling_complementarity(current_iterate, this->affine_direction);
+      if (0. < average_complementarity) {
+         const bool barrier_parameter_updated = this->barrier_parameter_update_strategy->update_barrier_parameter_by_probing(
+            average_complementarity, affine_complementarity);
+         // probing is a free-mode update: the globalization strategy is kept
+         this->auxiliary_measure_changed = this->auxiliary_measure_changed || barrier_parameter_updated;
+      }
+
+      // Newton direction for the new barrier parameter
+      const double ratio = this->barrier_parameter() / current_barrier_parameter;
+      for (size_t index: Range(dimension)) {
+         this->augmented_solution[index] += ratio * (this->augmented_solutions[dimension + index] - this->augmented_solution[index]);
+      }
+      const PrimalDualInteriorPointProblem barrier_problem(problem, this->barrier_parameter(), this->parameters);
+      const Subproblem subproblem{barrier_problem, current_iterate, hessian_model, regularization_strategy, INF<double>};
+      subproblem.assemble_primal_dual_direction(this->augmented_solution, direction);
+      DEBUG << "Direction computed with mu = " << this->barrier_parameter() << " by probing\n";
+   }
+
+   // least-square estimate of the constraint multipliers (Section 3.6 of the IPOPT paper): the system
+   // [I J^T; J 0] [w; y] = [∇f - z; 0] is factorized once. The estimate is discarded if the matrix is singular or if
+   // its norm exceeds least_square_multiplier_max_norm
+   void PrimalDualInteriorPointMethod::compute_least_square_multipliers(const OptimizationProblem& problem, Iterate& iterate) {
+      if (!this->least_square_system_initialized) {
+         this->least_square_linear_solver->initialize_least_square_system(problem);
+         this->least_square_system_initialized = true;
+      }
+      this->least_square_linear_solver->solve_least_square_system(problem, iterate, this->augmented_solution);
+      if (this->least_square_linear_solver->matrix_is_singular()) {
+         DEBUG << "The least-square multiplier system is singular, the multipliers are not initialized\n";
+         return;
+      }
+      const auto multipliers = view(this->augmented_solution, problem.number_variables,
+         problem.number_variables + problem.number_constraints);
+      const double multipliers_norm = norm_inf(multipliers);
+      if (multipliers_norm <= this->least_square_multiplier_max_norm) {
+         iterate.multipliers.constraints = multipliers;
+         DEBUG << "Least-square multipliers: " << iterate.multipliers.constraints << '\n';
+      }
+      else {
+         DEBUG << "The least-square multipliers have norm " << multipliers_norm << " and are discarded\n";
+      }
+   }
+
+   void PrimalDualInteriorPointMethod::set_barrier_statistics(Statistics& statistics) const {
+      statistics.set(this->barrier_parameter_column, this->barrier_parameter());
+      statistics.set(this->barrier_update_column, this->barrier_parameter_update_strategy->get_mode());
+   }
+
    double PrimalDualInteriorPointMethod::barrier_parameter() const {
-      return this->barrier_parameter_update_strategy.get_barrier_parameter();
+      return this->barrier_parameter_update_strategy->get_barrier_parameter();
    }
 
    void PrimalDualInteriorPointMethod::initialize_feasibility_problem(const l1RelaxedProblem& /*problem*/, Iterate& current_iterate) {
@@ -151,7 +316,7 @@ namespace uno {
       // temporarily update the objective multiplier
       this->previous_barrier_parameter = this->barrier_parameter();
       const double new_barrier_parameter = std::max(this->barrier_parameter(), current_iterate.primal_feasibility);
-      this->barrier_parameter_update_strategy.set_barrier_parameter(new_barrier_parameter);
+      this->barrier_parameter_update_strategy->set_barrier_parameter(new_barrier_parameter);
       DEBUG << "Barrier parameter mu temporarily updated to " << this->barrier_parameter() << '\n';
 
       // set the bound multipliers
@@ -167,7 +332,7 @@ namespace uno {
 
    void PrimalDualInteriorPointMethod::exit_feasibility_problem(const OptimizationProblem& /*problem*/, Iterate& /*trial_iterate*/) {
       //assert(this->solving_feasibility_problem && "The barrier subproblem did not know it was solving the feasibility problem.");
-      this->barrier_parameter_update_strategy.set_barrier_parameter(this->previous_barrier_parameter);
+      this->barrier_parameter_update_strategy->set_barrier_parameter(this->previous_barrier_parameter);
       this->solving_feasibility_problem = false;
       // TODO compute least-square multipliers
    }
@@ -256,10 +421,20 @@ namespace uno {
 
    void PrimalDualInteriorPointMethod::update_barrier_parameter(const PrimalDualInteriorPointProblem& barrier_problem,
          const Iterate& current_iterate, const DualResiduals& residuals) {
-      const bool barrier_parameter_updated = this->barrier_parameter_update_strategy.update_barrier_parameter(barrier_problem,
+      const bool was_free_mode = this->barrier_parameter_update_strategy->is_free_mode();
+      const bool barrier_parameter_updated = this->barrier_parameter_update_strategy->update_barrier_parameter(barrier_problem,
          current_iterate, residuals);
-      // the barrier parameter may have been changed earlier when entering restoration
-      this->subproblem_definition_changed = this->subproblem_definition_changed || barrier_parameter_updated;
+      if (barrier_parameter_updated) {
+         // in free mode, mu changes at each iteration: only the auxiliary measure is recomputed. A monotone update or a
+         // change of mode resets the globalization strategy
+         if (was_free_mode && this->barrier_parameter_update_strategy->is_free_mode()) {
+            this->auxiliary_measure_changed = true;
+         }
+         else {
+            // the barrier parameter may have been changed earlier when entering restoration
+            this->subproblem_definition_changed = true;
+         }
+      }
    }
 
    // Section 3.9 in IPOPT paper
@@ -5,10 +5,13 @@
 #define UNO_PRIMALDUALINTERIORPOINTMETHOD_H
 
 #include <memory>
+#include <vector>
 #include "../InequalityHandlingMethod.hpp"
 #include "InteriorPointParameters.hpp"
-#include "ingredients/subproblem_solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
+#include "ingredients/subproblem_solvers/SymmetricIndefiniteLinearSolver.hpp"
 #include "BarrierParameterUpdateStrategy.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "optimization/Direction.hpp"
 
 namespace uno {
    // forward references
@@ -26,6 +29,9 @@ namespace uno {
       void solve(Statistics& statistics, const OptimizationProblem& problem, Iterate& current_iterate, Direction& direction,
          HessianModel& hessian_model, RegularizationStrategy<double>& regularization_strategy, double trust_region_radius,
          WarmstartInformation& warmstart_information) override;
+      [[nodiscard]] bool compute_second_order_correction(const OptimizationProblem& problem, Iterate& current_iterate,
+         Iterate& trial_iterate, double primal_step_length, Direction& correction, HessianModel& hessian_model,
+         RegularizationStrategy<double>& regularization_strategy) override;
 
       void initialize_feasibility_problem(const l1RelaxedProblem& problem, Iterate& current_iterate) override;
       void exit_feasibility_problem(const OptimizationProblem& problem, Iterate& trial_iterate) override;
@@ -51,13 +57,30 @@ namespace uno {
       [[nodiscard]] std::string get_name() const override;
 
    protected:
-      const std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> linear_solver;
-      BarrierParameterUpdateStrategy barrier_parameter_update_strategy;
+      const std::unique_ptr<SymmetricIndefiniteLinearSolver<double>> linear_solver;
+      // solver of [I J^T; J 0] for the least-square multiplier estimate
+      const std::unique_ptr<SymmetricIndefiniteLinearSolver<double>> least_square_linear_solver;
+      bool least_square_system_initialized{false};
+      const std::unique_ptr<BarrierParameterUpdateStrategy> barrier_parameter_update_strategy;
       double previous_barrier_parameter;
       const double default_multiplier;
       const InteriorPointParameters parameters;
       const double least_square_multiplier_max_norm;
       const double l1_constraint_violation_coefficient; // (rho in Section 3.3.1 in IPOPT paper)
+      const bool predictor_corrector;
+      // handles of the statistics columns
+      size_t barrier_parameter_column{};
+      size_t barrier_update_column{};
+      Direction affine_direction{};
+      Vector<double> augmented_solution{};
+      // solutions of the affine-scaling and Newton systems (probing)
+      Vector<double> augmented_solutions{};
+
+      // second-order correction: accumulated constraint values (c_soc in the IPOPT paper)
+      std::vector<double> corrected_constraints{};
+      std::vector<double> trial_constraints{};
+      size_t number_second_order_corrections{0};
+      double previous_primal_step_length{1.}; // alpha_max of the direction, then of the last correction
 
       bool solving_feasibility_problem{false};
       bool first_feasibility_iteration{false};
@@ -65,6 +88,13 @@ namespace uno {
       [[nodiscard]] double barrier_parameter() const;
       void update_barrier_parameter(const PrimalDualInteriorPointProblem& barrier_problem, const Iterate& current_iterate,
          const DualResiduals& residuals);
+      void compute_predictor_corrector_direction(const OptimizationProblem& problem, Iterate& current_iterate,
+         Direction& direction, HessianModel& hessian_model, RegularizationStrategy<double>& regularization_strategy);
+      void compute_probing_direction(Statistics& statistics, const OptimizationProblem& problem, Iterate& current_iterate,
+         Direction& direction, HessianModel& hessian_model, RegularizationStrategy<double>& regularization_strategy,
+         const WarmstartInformation& warmstart_information);
+      void compute_least_square_multipliers(const OptimizationProblem& problem, Iterate& iterate);
+      void set_barrier_statistics(Statistics& statistics) const;
       [[nodiscard]] bool is_small_step(const OptimizationProblem& problem, const Vector<double>& current_primals, const Vector<double>& direction_primals) const;
       [[nodiscard]] double evaluate_subproblem_objective(const Direction& direction) const;
    };
@@ -12,10 +12,21 @@
 
 namespace uno {
    PrimalDualInteriorPointProblem::PrimalDualInteriorPointProblem(const OptimizationProblem& problem, double barrier_parameter,
-      const InteriorPointParameters &parameters):
+      const InteriorPointParameters &parameters, const Direction* affine_direction):
+         PrimalDualInteriorPointProblem(problem, barrier_parameter, parameters, affine_direction, barrier_parameter, false) { }
+
+   PrimalDualInteriorPointProblem::PrimalDualInteriorPointProblem(const OptimizationProblem& problem, double barrier_parameter,
+      const InteriorPointParameters &parameters, const Direction* affine_direction, double regularization_barrier_parameter,
+      bool affine_scaling):
          OptimizationProblem(problem.model, problem.number_variables, problem.number_constraints),
          first_reformulation(problem), barrier_parameter(barrier_parameter),
-         parameters(parameters), equality_constraints(problem.number_constraints) { }
+         parameters(parameters), equality_constraints(problem.number_constraints), affine_direction(affine_direction),
+         regularization_barrier_parameter(regularization_barrier_parameter), affine_scaling(affine_scaling) { }
+
+   PrimalDualInteriorPointProblem PrimalDualInteriorPointProblem::affine_scaling_problem(const OptimizationProblem& problem,
+         double barrier_parameter, const InteriorPointParameters &parameters) {
+      return {problem, 0., parameters, nullptr, barrier_parameter, true};
+   }
 
    double PrimalDualInteriorPointProblem::get_objective_multiplier() const {
       return this->first_reformulation.get_objective_multiplier();
@@ -32,14 +43,16 @@ namespace uno {
       for (size_t variable_index: Range(this->first_reformulation.number_variables)) {
          double barrier_term = 0.;
          if (is_finite(this->first_reformulation.variable_lower_bound(variable_index))) { // lower bounded
-            barrier_term += -this->barrier_parameter/(iterate.primals[variable_index] - this->first_reformulation.variable_lower_bound(variable_index));
+            barrier_term += -this->lower_bound_complementarity_target(variable_index)/(iterate.primals[variable_index] -
+               this->first_reformulation.variable_lower_bound(variable_index));
             // damping
             if (!is_finite(this->first_reformulation.variable_upper_bound(variable_index))) {
                barrier_term += this->parameters.damping_factor * this->barrier_parameter;
             }
          }
          if (is_finite(this->first_reformulation.variable_upper_bound(variable_index))) { // upper bounded
-            barrier_term += -this->barrier_parameter/(iterate.primals[variable_index] - this->first_reformulation.variable_upper_bound(variable_index));
+            barrier_term += -this->upper_bound_complementarity_target(variable_index)/(iterate.primals[variable_index] -
+               this->first_reformulation.variable_upper_bound(variable_index));
             // damping
             if (!is_finite(this->first_reformulation.variable_lower_bound(variable_index))) {
                barrier_term -= this->parameters.damping_factor * this->barrier_parameter;
@@ -142,19 +155,9 @@ namespace uno {
       // barrier terms
       size_t nonzero_index = this->first_reformulation.number_hessian_nonzeros(hessian_model);
       for (size_t variable_index: Range(this->first_reformulation.number_variables)) {
-         const bool finite_lower_bound = is_finite(this->first_reformulation.variable_lower_bound(variable_index));
-         const bool finite_upper_bound = is_finite(this->first_reformulation.variable_upper_bound(variable_index));
-         if (finite_lower_bound || finite_upper_bound) {
-            double diagonal_barrier_term = 0.;
-            if (finite_lower_bound) {
-               const double distance_to_bound = primal_variables[variable_index] - this->first_reformulation.variable_lower_bound(variable_index);
-               diagonal_barrier_term += multipliers.lower_bounds[variable_index] / distance_to_bound;
-            }
-            if (finite_upper_bound) {
-               const double distance_to_bound = primal_variables[variable_index] - this->first_reformulation.variable_upper_bound(variable_index);
-               diagonal_barrier_term += multipliers.upper_bounds[variable_index] / distance_to_bound;
-            }
-            hessian_values[nonzero_index] = diagonal_barrier_term;
+         if (is_finite(this->first_reformulation.variable_lower_bound(variable_index)) ||
+               is_finite(this->first_reformulation.variable_upper_bound(variable_index))) {
+            hessian_values[nonzero_index] = this->barrier_diagonal_term(variable_index, primal_variables.data(), multipliers);
             ++nonzero_index;
          }
       }
@@ -167,20 +170,14 @@ namespace uno {
 
       // barrier terms
       for (size_t variable_index: Range(this->first_reformulation.number_variables)) {
-         const bool finite_lower_bound = is_finite(this->first_reformulation.variable_lower_bound(variable_index));
-         const bool finite_upper_bound = is_finite(this->first_reformulation.variable_upper_bound(variable_index));
-         if (finite_lower_bound || finite_upper_bound) {
-            double diagonal_barrier_term = 0.;
-            if (finite_lower_bound) { // lower bounded
-               const double distance_to_bound = vector[variable_index] - this->first_reformulation.variable_lower_bound(variable_index);
-               diagonal_barrier_term += multipliers.lower_bounds[variable_index] / distance_to_bound;
-            }
-            if (finite_upper_bound) { // upper bounded
-               const double distance_to_bound = vector[variable_index] - this->first_reformulation.variable_upper_bound(variable_index);
-               diagonal_barrier_term += multipliers.upper_bounds[variable_index] / distance_to_bound;
-            }
-            result[variable_index] += diagonal_barrier_term * vector[variable_index];
-         }
+         result[variable_index] += this->barrier_diagonal_term(variable_index, x, multipliers) * vector[variable_index];
+      }
+   }
+
+   void PrimalDualInteriorPointProblem::evaluate_barrier_diagonal(const Vector<double>& primal_variables, const Multipliers& multipliers,
+         double* diagonal) const {
+      for (size_t variable_index: Range(this->first_reformulation.number_variables)) {
+         diagonal[variable_index] = this->barrier_diagonal_term(variable_index, primal_variables.data(), multipliers);
       }
    }
 
@@ -230,6 +227,10 @@ namespace uno {
       direction.multipliers.constraints = view(-solution, this->first_reformulation.number_variables,
          this->first_reformulation.number_variables + this->first_reformulation.number_constraints);
       this->compute_bound_dual_direction(current_iterate, direction);
+      direction.primal_step_length = 1.;
+      if (this->affine_scaling) {
+         return;
+      }
 
       // "fraction-to-boundary" rule for primal variables and constraints multipliers
       const double tau = std::max(this->parameters.tau_min, 1. - this->barrier_parameter);
@@ -243,6 +244,7 @@ namespace uno {
       // scale the primal-dual variables
       direction.primals.scale(primal_step_length);
       direction.multipliers.constraints.scale(primal_step_length);
+      direction.primal_step_length = primal_step_length;
       direction.multipliers.lower_bounds.scale(bound_dual_step_length);
       direction.multipliers.upper_bounds.scale(bound_dual_step_length);
    }
@@ -273,7 +275,7 @@ namespace uno {
    }
 
    double PrimalDualInteriorPointProblem::dual_regularization_factor() const {
-      return std::pow(this->barrier_parameter, this->parameters.dual_regularization_exponent);
+      return std::pow(this->regularization_barrier_parameter, this->parameters.dual_regularization_exponent);
    }
 
    // protected member functions
@@ -298,19 +300,112 @@ namespace uno {
          const double upper_bound = this->first_reformulation.variable_upper_bound(variable_index);
          if (is_finite(lower_bound)) {
             const double distance_to_bound = current_iterate.primals[variable_index] - lower_bound;
-            direction.multipliers.lower_bounds[variable_index] = (this->barrier_parameter - direction.primals[variable_index] *
-               current_iterate.multipliers.lower_bounds[variable_index]) / distance_to_bound - current_iterate.multipliers.lower_bounds[variable_index];
+            direction.multipliers.lower_bounds[variable_index] = (this->lower_bound_complementarity_target(variable_index) -
+               direction.primals[variable_index] * current_iterate.multipliers.lower_bounds[variable_index]) / distance_to_bound -
+               current_iterate.multipliers.lower_bounds[variable_index];
             assert(is_finite(direction.multipliers.lower_bounds[variable_index]) && "The lower bound dual is infinite");
          }
          if (is_finite(upper_bound)) {
             const double distance_to_bound = current_iterate.primals[variable_index] - upper_bound;
-            direction.multipliers.upper_bounds[variable_index] = (this->barrier_parameter - direction.primals[variable_index] *
-               current_iterate.multipliers.upper_bounds[variable_index]) / distance_to_bound - current_iterate.multipliers.upper_bounds[variable_index];
+            direction.multipliers.upper_bounds[variable_index] = (this->upper_bound_complementarity_target(variable_index) -
+               direction.primals[variable_index] * current_iterate.multipliers.upper_bounds[variable_index]) / distance_to_bound -
+               current_iterate.multipliers.upper_bounds[variable_index];
             assert(is_finite(direction.multipliers.upper_bounds[variable_index]) && "The upper bound dual is infinite");
          }
       }
    }
 
+   // average and smallest complementarity products (x - x_L) z_L and (x - x_U) z_U over the bounds
+   std::pair<double, double> PrimalDualInteriorPointProblem::compute_average_and_minimum_complementarity(const Vector<double>& primals,
+         const Multipliers& multipliers) const {
+      double complementarity = 0.;
+      double minimum_complementarity = INF<double>;
+      size_t number_bounds = 0;
+      for (size_t variable_index: Range(this->first_reformulation.number_variables)) {
+         const double lower_bound = this->first_reformulation.variable_lower_bound(variable_index);
+         const double upper_bound = this->first_reformulation.variable_upper_bound(variable_index);
+         if (is_finite(lower_bound)) {
+            const double product = (primals[variable_index] - lower_bound) * multipliers.lower_bounds[variable_index];
+            complementarity += product;
+            minimum_complementarity = std::min(minimum_complementarity, product);
+            ++number_bounds;
+         }
+         if (is_finite(upper_bound)) {
+            const double product = (primals[variable_index] - upper_bound) * multipliers.upper_bounds[variable_index];
+            complementarity += product;
+            minimum_complementarity = std::min(minimum_complementarity, product);
+            ++number_bounds;
+         }
+      }
+      if (number_bounds == 0) {
+         return {0., 0.};
+      }
+      return {complementarity / static_cast<double>(number_bounds), minimum_complementarity};
+   }
+
+   // average complementarity at the current iterate and after the longest step along the affine-scaling direction that
+   // keeps the primal variables and the bound multipliers nonnegative (Mehrotra's probing)
+   std::pair<double, double> PrimalDualInteriorPointProblem::compute_affine_scaling_complementarity(const Iterate& current_iterate,
+         const Direction& affine_direction) const {
+      const double primal_step_length = this->primal_fraction_to_boundary(current_iterate.primals, affine_direction.primals, 1.);
+      const double dual_step_length = this->dual_fraction_to_boundary(current_iterate.multipliers, affine_direction.multipliers, 1.);
+      double complementarity = 0.;
+      double affine_complementarity = 0.;
+      size_t number_bounds = 0;
+      for (size_t variable_index: Range(this->first_reformulation.number_variables)) {
+         const double lower_bound = this->first_reformulation.variable_lower_bound(variable_index);
+         const double upper_bound = this->first_reformulation.variable_upper_bound(variable_index);
+         const double trial_primal = current_iterate.primals[variable_index] + primal_step_length * affine_direction.primals[variable_index];
+         if (is_finite(lower_bound)) {
+            complementarity += (current_iterate.primals[variable_index] - lower_bound) * current_iterate.multipliers.lower_bounds[variable_index];
+            affine_complementarity += (trial_primal - lower_bound) * (current_iterate.multipliers.lower_bounds[variable_index] +
+               dual_step_length * affine_direction.multipliers.lower_bounds[variable_index]);
+            ++number_bounds;
+         }
+         if (is_finite(upper_bound)) {
+            complementarity += (current_iterate.primals[variable_index] - upper_bound) * current_iterate.multipliers.upper_bounds[variable_index];
+            affine_complementarity += (trial_primal - upper_bound) * (current_iterate.multipliers.upper_bounds[variable_index] +
+               dual_step_length * affine_direction.multipliers.upper_bounds[variable_index]);
+            ++number_bounds;
+         }
+      }
+      if (number_bounds == 0) {
+         return {0., 0.};
+      }
+      return {complementarity / static_cast<double>(number_bounds), affine_complementarity / static_cast<double>(number_bounds)};
+   }
+
+   // diagonal term Σ = z_L / (x - x_L) + z_U / (x - x_U) of the primal-dual barrier Hessian (0 for unbounded variables)
+   double PrimalDualInteriorPointProblem::barrier_diagonal_term(size_t variable_index, const double* x, const Multipliers& multipliers) const {
+      double diagonal_barrier_term = 0.;
+      if (is_finite(this->first_reformulation.variable_lower_bound(variable_index))) { // lower bounded
+         const double distance_to_bound = x[variable_index] - this->first_reformulation.variable_lower_bound(variable_index);
+         diagonal_barrier_term += multipliers.lower_bounds[variable_index] / distance_to_bound;
+      }
+      if (is_finite(this->first_reformulation.variable_upper_bound(variable_index))) { // upper bounded
+         const double distance_to_bound = x[variable_index] - this->first_reformulation.variable_upper_bound(variable_index);
+         diagonal_barrier_term += multipliers.upper_bounds[variable_index] / distance_to_bound;
+      }
+      return diagonal_barrier_term;
+   }
+
+   // target of the linearized complementarity conditions: mu (Newton) or mu - dx_aff dz_aff (Mehrotra's corrector)
+   double PrimalDualInteriorPointProblem::lower_bound_complementarity_target(size_t variable_index) const {
+      if (this->affine_direction == nullptr) {
+         return this->barrier_parameter;
+      }
+      return this->barrier_parameter - this->affine_direction->primals[variable_index] *
+         this->affine_direction->multipliers.lower_bounds[variable_index];
+   }
+
+   double PrimalDualInteriorPointProblem::upper_bound_complementarity_target(size_t variable_index) const {
+      if (this->affine_direction == nullptr) {
+         return this->barrier_parameter;
+      }
+      return this->barrier_parameter - this->affine_direction->primals[variable_index] *
+         this->affine_direction->multipliers.upper_bounds[variable_index];
+   }
+
    // TODO use a single function for primal and dual fraction-to-boundary rules
    double PrimalDualInteriorPointProblem::primal_fraction_to_boundary(const Vector<double>& current_primals,
          const Vector<double>& primal_direction, double tau) const {
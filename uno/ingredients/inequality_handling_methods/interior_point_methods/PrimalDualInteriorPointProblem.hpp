@@ -4,6 +4,7 @@
 #ifndef UNO_PRIMALDUALINTERIORPOINTPROBLEM_H
 #define UNO_PRIMALDUALINTERIORPOINTPROBLEM_H
 
+#include <utility>
 #include "InteriorPointParameters.hpp"
 #include "optimization/OptimizationProblem.hpp"
 #include "symbolic/Range.hpp"
@@ -11,8 +12,14 @@
 namespace uno {
    class PrimalDualInteriorPointProblem : public OptimizationProblem {
    public:
+      // if an affine-scaling direction is given, the complementarity conditions are corrected with the second-order
+      // terms of the affine-scaling direction (Mehrotra's corrector)
       PrimalDualInteriorPointProblem(const OptimizationProblem& problem, double barrier_parameter,
-         const InteriorPointParameters &parameters);
+         const InteriorPointParameters &parameters, const Direction* affine_direction = nullptr);
+      // affine-scaling problem (Newton system for mu = 0) that shares the matrix of the barrier problem with parameter mu:
+      // the dual regularization still depends on mu, and the direction is not scaled by the fraction-to-boundary rule
+      [[nodiscard]] static PrimalDualInteriorPointProblem affine_scaling_problem(const OptimizationProblem& problem,
+         double barrier_parameter, const InteriorPointParameters &parameters);
 
       [[nodiscard]] double get_objective_multiplier() const override;
 
@@ -40,6 +47,8 @@ namespace uno {
          const Multipliers& multipliers, double* hessian_values) const override;
       void compute_hessian_vector_product(HessianModel& hessian_model, const double* x, const double* vector,
          const Multipliers& multipliers, double* result) const override;
+      void evaluate_barrier_diagonal(const Vector<double>& primal_variables, const Multipliers& multipliers,
+         double* diagonal) const override;
 
       [[nodiscard]] double variable_lower_bound(size_t variable_index) const override;
       [[nodiscard]] double variable_upper_bound(size_t variable_index) const override;
@@ -62,6 +71,11 @@ namespace uno {
       void postprocess_iterate(Iterate& iterate) const;
       [[nodiscard]] double compute_centrality_error(const Vector<double>& primals, const Multipliers& multipliers,
          double shift) const;
+      void compute_bound_dual_direction(const Iterate& current_iterate, Direction& direction) const;
+      [[nodiscard]] std::pair<double, double> compute_average_and_minimum_complementarity(const Vector<double>& primals,
+         const Multipliers& multipliers) const;
+      [[nodiscard]] std::pair<double, double> compute_affine_scaling_complementarity(const Iterate& current_iterate,
+         const Direction& affine_direction) const;
 
    protected:
       const OptimizationProblem& first_reformulation;
@@ -70,8 +84,16 @@ namespace uno {
       const Vector<size_t> fixed_variables{};
       const ForwardRange equality_constraints;
       const ForwardRange inequality_constraints{0};
+      const Direction* affine_direction;
+      const double regularization_barrier_parameter;
+      const bool affine_scaling;
 
-      void compute_bound_dual_direction(const Iterate& current_iterate, Direction& direction) const;
+      PrimalDualInteriorPointProblem(const OptimizationProblem& problem, double barrier_parameter,
+         const InteriorPointParameters &parameters, const Direction* affine_direction, double regularization_barrier_parameter,
+         bool affine_scaling);
+      [[nodiscard]] double barrier_diagonal_term(size_t variable_index, const double* x, const Multipliers& multipliers) const;
+      [[nodiscard]] double lower_bound_complementarity_target(size_t variable_index) const;
+      [[nodiscard]] double upper_bound_complementarity_target(size_t variable_index) const;
       [[nodiscard]] double primal_fraction_to_boundary(const Vector<double>& current_primals, const Vector<double>& primal_direction,
          double tau) const;
       [[nodiscard]] double dual_fraction_to_boundary(const Multipliers& current_multipliers, const Multipliers& direction_multipliers,
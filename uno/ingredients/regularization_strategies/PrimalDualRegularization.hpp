@@ -12,6 +12,7 @@
 #include "ingredients/subproblem_solvers/SymmetricIndefiniteLinearSolverFactory.hpp"
 #include "options/Options.hpp"
 #include "symbolic/Collection.hpp"
+#include "tools/CancellationToken.hpp"
 #include "tools/Logger.hpp"
 #include "tools/Statistics.hpp"
 
@@ -43,9 +44,11 @@ namespace uno {
       [[nodiscard]] std::string get_name() const override;
 
    protected:
+      const Options& options; // reference to the options for delayed allocation of solver
       const std::string& optional_linear_solver_name;
       std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> optional_linear_solver{};
       ElementType primal_regularization{0.};
+      size_t regularization_column{}; // handle of the statistics column
       ElementType dual_regularization{0.};
       ElementType previous_primal_regularization{0.};
       const ElementType regularization_failure_threshold;
@@ -61,6 +64,7 @@ namespace uno {
    template <typename ElementType>
    PrimalDualRegularization<ElementType>::PrimalDualRegularization(const Options& options):
          RegularizationStrategy<ElementType>(),
+         options(options),
          optional_linear_solver_name(options.get_string("linear_solver")),
          regularization_failure_threshold(ElementType(options.get_double("regularization_failure_threshold"))),
          primal_regularization_initial_factor(ElementType(options.get_double("primal_regularization_initial_factor"))),
@@ -74,7 +78,7 @@ namespace uno {
 
    template <typename ElementType>
    void PrimalDualRegularization<ElementType>::initialize_statistics(Statistics& statistics, const Options& options) {
-      statistics.add_column("regulariz", Statistics::double_width - 4, options.get_int("statistics_regularization_column_order"));
+      this->regularization_column = statistics.add_column("regulariz", Statistics::double_width - 4, options.get_int("statistics_regularization_column_order"));
    }
 
    template <typename ElementType>
@@ -82,7 +86,8 @@ namespace uno {
          const double* hessian_values, const Inertia& expected_inertia, double* primal_regularization_values) {
       // pick the member linear solver
       if (this->optional_linear_solver == nullptr) {
-         this->optional_linear_solver = SymmetricIndefiniteLinearSolverFactory::create(this->optional_linear_solver_name);
+         this->optional_linear_solver = SymmetricIndefiniteLinearSolverFactory::create(this->optional_linear_solver_name,
+            this->options);
          this->optional_linear_solver->initialize_augmented_system(subproblem);
          this->optional_linear_solver->do_symbolic_analysis();
       }
@@ -106,7 +111,8 @@ namespace uno {
          const double* augmented_matrix_values, ElementType dual_regularization_parameter,
          const Inertia& expected_inertia, double* primal_regularization_values, double* dual_regularization_values) {
       if (this->optional_linear_solver == nullptr) {
-         this->optional_linear_solver = SymmetricIndefiniteLinearSolverFactory::create(this->optional_linear_solver_name);
+         this->optional_linear_solver = SymmetricIndefiniteLinearSolverFactory::create(this->optional_linear_solver_name,
+            this->options);
          this->optional_linear_solver->initialize_augmented_system(subproblem);
          this->optional_linear_solver->do_symbolic_analysis();
       }
@@ -142,7 +148,7 @@ namespace uno {
 
       if (estimated_inertia == expected_inertia) {
          DEBUG << "The inertia is correct\n";
-         statistics.set("regulariz", this->primal_regularization);
+         statistics.set(this->regularization_column, this->primal_regularization);
          return;
       }
 
@@ -170,6 +176,7 @@ namespace uno {
 
       bool good_inertia = false;
       while (!good_inertia) {
+         CancellationToken::check();
          DEBUG << "Testing factorization with regularization factors (" << this->primal_regularization << ", " << this->dual_regularization << ")\n";
          DEBUG2 << augmented_matrix_values << '\n';
          DEBUG << "Performing numerical factorization of the indefinite system\n";
@@ -209,7 +216,7 @@ namespace uno {
             }
          }
       }
-      statistics.set("regulariz", this->primal_regularization);
+      statistics.set(this->regularization_column, this->primal_regularization);
    }
 
    template <typename ElementType>
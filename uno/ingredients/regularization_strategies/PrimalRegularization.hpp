@@ -13,6 +13,7 @@
 #include "ingredients/subproblem_solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
 #include "ingredients/subproblem_solvers/SymmetricIndefiniteLinearSolverFactory.hpp"
 #include "options/Options.hpp"
+#include "tools/CancellationToken.hpp"
 #include "tools/Logger.hpp"
 #include "tools/Statistics.hpp"
 
@@ -45,9 +46,11 @@ namespace uno {
       [[nodiscard]] std::string get_name() const override;
 
    protected:
+      const Options& options; // reference to the options for delayed allocation of solver
       const std::string& optional_linear_solver_name;
       std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> optional_linear_solver{};
       double regularization_factor{0.};
+      size_t regularization_column{}; // handle of the statistics column
       const double regularization_initial_value{};
       const double regularization_increase_factor{};
       const double regularization_failure_threshold{};
@@ -56,6 +59,7 @@ namespace uno {
    template <typename ElementType>
    PrimalRegularization<ElementType>::PrimalRegularization(const Options& options):
          RegularizationStrategy<ElementType>(),
+         options(options),
          optional_linear_solver_name(options.get_string("linear_solver")),
          regularization_initial_value(options.get_double("regularization_initial_value")),
          regularization_increase_factor(options.get_double("regularization_increase_factor")),
@@ -64,7 +68,7 @@ namespace uno {
 
    template <typename ElementType>
    void PrimalRegularization<ElementType>::initialize_statistics(Statistics& statistics, const Options& options) {
-      statistics.add_column("regulariz", Statistics::double_width - 4, options.get_int("statistics_regularization_column_order"));
+      this->regularization_column = statistics.add_column("regulariz", Statistics::double_width - 4, options.get_int("statistics_regularization_column_order"));
    }
 
    // Nocedal and Wright, p51
@@ -73,7 +77,8 @@ namespace uno {
          const double* hessian_values, const Inertia& expected_inertia, double* primal_regularization_values) {
       // pick the member linear solver
       if (this->optional_linear_solver == nullptr) {
-         this->optional_linear_solver = SymmetricIndefiniteLinearSolverFactory::create(this->optional_linear_solver_name);
+         this->optional_linear_solver = SymmetricIndefiniteLinearSolverFactory::create(this->optional_linear_solver_name,
+            this->options);
          this->optional_linear_solver->initialize_hessian(subproblem);
          this->optional_linear_solver->do_symbolic_analysis();
       }
@@ -94,6 +99,7 @@ namespace uno {
       this->regularization_factor = (smallest_diagonal_entry > 0.) ? 0. : this->regularization_initial_value - smallest_diagonal_entry;
       bool good_inertia = false;
       while (!good_inertia) {
+         CancellationToken::check();
          DEBUG << "Testing factorization with regularization factor " << this->regularization_factor << '\n';
          for (size_t index: Range(subproblem.get_primal_regularization_variables().size())) {
             primal_regularization_values[index] = this->regularization_factor;
@@ -117,7 +123,7 @@ namespace uno {
          }
          DEBUG << '\n';
       }
-      statistics.set("regulariz", this->regularization_factor);
+      statistics.set(this->regularization_column, this->regularization_factor);
    }
 
    template <typename ElementType>
@@ -127,7 +133,8 @@ namespace uno {
          double* dual_regularization_values) {
       // pick the member linear solver
       if (this->optional_linear_solver == nullptr) {
-         this->optional_linear_solver = SymmetricIndefiniteLinearSolverFactory::create(this->optional_linear_solver_name);
+         this->optional_linear_solver = SymmetricIndefiniteLinearSolverFactory::create(this->optional_linear_solver_name,
+            this->options);
          this->optional_linear_solver->initialize_hessian(subproblem);
          this->optional_linear_solver->do_symbolic_analysis();
       }
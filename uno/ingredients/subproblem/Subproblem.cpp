@@ -102,6 +102,10 @@ namespace uno {
       }
    }
 
+   void Subproblem::evaluate_barrier_diagonal(double* diagonal) const {
+      this->problem.evaluate_barrier_diagonal(this->current_iterate.primals, this->current_iterate.multipliers, diagonal);
+   }
+
    void Subproblem::assemble_augmented_matrix(Statistics& statistics, double* augmented_matrix_values) const {
       // evaluate the Lagrangian Hessian of the problem at the current primal-dual point
       this->problem.evaluate_lagrangian_hessian(statistics, this->hessian_model, this->current_iterate.primals,
@@ -43,6 +43,8 @@ namespace uno {
       void evaluate_lagrangian_hessian(Statistics& statistics, double* hessian_values) const;
       void regularize_lagrangian_hessian(Statistics& statistics, double* hessian_values) const;
       void compute_hessian_vector_product(const double* x, const double* vector, double* result) const;
+      // diagonal barrier terms of the Hessian at the current iterate
+      void evaluate_barrier_diagonal(double* diagonal) const;
 
       // augmented system
       void assemble_augmented_matrix(Statistics& statistics, double* augmented_matrix_values) const;
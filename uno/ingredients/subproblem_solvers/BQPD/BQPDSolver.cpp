@@ -2,6 +2,7 @@
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
 #include <cassert>
+#include <mutex>
 #include "BQPDSolver.hpp"
 #include "ingredients/hessian_models/HessianModel.hpp"
 #include "ingredients/subproblem/Subproblem.hpp"
@@ -37,6 +38,11 @@ extern "C" {
 namespace uno {
    #define BIG 1e30
 
+   // BQPD keeps its state in Fortran common blocks: the solves of concurrent instances (e.g. concurrent Uno solves) are serialized.
+   // The warm starts reuse the factors of the last solve: they are valid only if the instance that last called BQPD is the same
+   static std::mutex bqpd_mutex;
+   static const BQPDSolver* bqpd_owner{nullptr};
+
    // heuristic to select kmax (the maximum size of the nullspace)
    // source: Minotaur code
    // https://github.com/coin-or/minotaur/blob/51a8bb78241a0b2e9ae94802aa76af8319f99192/src/interfaces/UnoEngine.cpp#L277
@@ -89,21 +95,33 @@ namespace uno {
       this->mxws = static_cast<size_t>(this->kmax * (this->kmax + 9) / 2) + 2 * subproblem.number_variables +
          subproblem.number_constraints /* (required by bqpd.f) */ + 5 * subproblem.number_variables + this->nprof /* (required
          by sparseL.f) */;
-      // 6 pointers hidden in lws
-      constexpr size_t hidden_pointers_size = 6*sizeof(intptr_t);
+      // pointers hidden in lws
+      constexpr size_t hidden_pointers_size = BQPDSolver::number_hidden_pointers*sizeof(intptr_t);
       this->mxlws = hidden_pointers_size + static_cast<size_t>(this->kmax) /* (required by bqpd.f) */ +
          9 * subproblem.number_variables + subproblem.number_constraints /* (required by sparseL.f) */;
       this->ws.resize(this->mxws);
       this->lws.resize(this->mxlws);
+      this->hide_evaluation_space_pointers_in_workspace();
+   }
+
+   BQPDSolver::~BQPDSolver() {
+      std::lock_guard<std::mutex> lock(bqpd_mutex);
+      if (bqpd_owner == this) {
+         bqpd_owner = nullptr;
+      }
    }
 
    void BQPDSolver::solve(Statistics& statistics, Subproblem& subproblem, const Vector<double>& initial_point,
          Direction& direction, const WarmstartInformation& warmstart_information) {
+      std::lock_guard<std::mutex> lock(bqpd_mutex);
+      // if another instance called BQPD since the last solve, its factors are lost and a warm start is not possible
+      const bool factors_lost = (bqpd_owner != this);
+      bqpd_owner = this;
       this->set_up_subproblem(statistics, subproblem, warmstart_information);
       if (this->print_subproblem) {
          this->display_subproblem(subproblem, initial_point);
       }
-      this->solve_subproblem(subproblem, initial_point, direction, warmstart_information);
+      this->solve_subproblem(subproblem, initial_point, direction, warmstart_information, factors_lost);
    }
 
    EvaluationSpace& BQPDSolver::get_evaluation_space() {
@@ -115,10 +133,23 @@ namespace uno {
    void BQPDSolver::set_up_subproblem(Statistics& statistics, const Subproblem& subproblem,
          const WarmstartInformation& warmstart_information) {
       // initialize wsc_ common block (Hessian & workspace for BQPD)
-      // setting the common block here ensures that several instances of BQPD can run simultaneously
+      // setting the common block here ensures that several instances of BQPD can be used one after the other
       WSC.mxws = static_cast<int>(this->mxws);
       WSC.mxlws = static_cast<int>(this->mxlws);
 
+      // the statistics and the subproblem are local to the caller: their pointers are hidden at every call
+      this->hide_pointers_in_workspace(statistics, subproblem);
+
+      // fast path (e.g. the trust-region radius was decreased after a rejected step): only the n box bounds are updated
+      if (BQPDSolver::only_variable_bounds_changed(warmstart_information)) {
+         subproblem.set_variables_bounds(this->lower_bounds, this->upper_bounds);
+         for (size_t variable_index: Range(subproblem.number_variables)) {
+            this->lower_bounds[variable_index] = std::max(-BIG, this->lower_bounds[variable_index]);
+            this->upper_bounds[variable_index] = std::min(BIG, this->upper_bounds[variable_index]);
+         }
+         return;
+      }
+
       // evaluate the functions and derivatives
       this->evaluation_space.evaluate_functions(subproblem.problem, subproblem.current_iterate, warmstart_information);
 
@@ -139,8 +170,6 @@ namespace uno {
          this->lower_bounds[variable_index] = std::max(-BIG, this->lower_bounds[variable_index]);
          this->upper_bounds[variable_index] = std::min(BIG, this->upper_bounds[variable_index]);
       }
-
-      this->hide_pointers_in_workspace(statistics, subproblem);
    }
 
    void BQPDSolver::display_subproblem(const Subproblem& subproblem, const Vector<double>& initial_point) const {
@@ -185,12 +214,12 @@ namespace uno {
    }
 
    void BQPDSolver::solve_subproblem(const Subproblem& subproblem, const Vector<double>& initial_point, Direction& direction,
-         const WarmstartInformation& warmstart_information) {
+         const WarmstartInformation& warmstart_information, bool factors_lost) {
       direction.primals = initial_point;
       const int n = static_cast<int>(subproblem.number_variables);
       const int m = static_cast<int>(subproblem.number_constraints);
 
-      const BQPDMode mode = BQPDSolver::determine_mode(warmstart_information);
+      const BQPDMode mode = this->determine_mode(warmstart_information, factors_lost);
       const int mode_integer = static_cast<int>(mode);
 
       // solve the LP/QP
@@ -207,6 +236,8 @@ namespace uno {
          termination = this->check_sufficient_workspace_size(bqpd_status);
          if (termination) {
             direction.status = BQPDSolver::status_from_bqpd_status(bqpd_status);
+            // the factors of the reduced Hessian can be reused by the next solve only if BQPD terminated successfully
+            this->reduced_hessian_factors_available = (bqpd_status == BQPDStatus::OPTIMAL);
          }
       }
 
@@ -218,38 +249,47 @@ namespace uno {
       this->set_multipliers(subproblem.number_variables, direction.multipliers);
    }
 
-   BQPDMode BQPDSolver::determine_mode(const WarmstartInformation& warmstart_information) {
+   BQPDMode BQPDSolver::determine_mode(const WarmstartInformation& warmstart_information, bool factors_lost) const {
       BQPDMode mode = BQPDMode::USER_DEFINED;
       // if problem structure changed, use cold start
       if (warmstart_information.hessian_sparsity_changed || warmstart_information.jacobian_sparsity_changed) {
          mode = BQPDMode::ACTIVE_SET_EQUALITIES;
       }
-      // if only the variable bounds changed, reuse the active set estimate and the Jacobian information
-      else if (warmstart_information.variable_bounds_changed && !warmstart_information.objective_changed &&
-               !warmstart_information.constraints_changed && !warmstart_information.constraint_bounds_changed) {
-         mode = BQPDMode::UNCHANGED_ACTIVE_SET_AND_JACOBIAN;
+      // if the factors of the last solve were overwritten by another instance, restart from the active set of this instance
+      else if (factors_lost) {
+         mode = BQPDMode::USER_DEFINED;
+      }
+      // if only the variable bounds changed, reuse the active set estimate and the Jacobian information. Since the Hessian
+      // is unchanged, the factors of the reduced Hessian are also reused if the previous solve succeeded
+      else if (BQPDSolver::only_variable_bounds_changed(warmstart_information)) {
+         mode = this->reduced_hessian_factors_available ? BQPDMode::UNCHANGED_ACTIVE_SET_AND_REDUCED_HESSIAN :
+            BQPDMode::UNCHANGED_ACTIVE_SET_AND_JACOBIAN;
       }
       return mode;
    }
 
-   // hide pointers to arbitrary objects into this->workspace_sparsity (BQPD's lws)
-   void BQPDSolver::hide_pointers_in_workspace(Statistics& statistics, const Subproblem& subproblem) {
-      WSC.kk = 0; // length of ws that is used by gdotx
-      WSC.ll = 0; // length of lws that is used by gdotx
+   bool BQPDSolver::only_variable_bounds_changed(const WarmstartInformation& warmstart_information) {
+      return warmstart_information.variable_bounds_changed && !warmstart_information.objective_changed &&
+         !warmstart_information.constraints_changed && !warmstart_information.constraint_bounds_changed &&
+         !warmstart_information.hessian_sparsity_changed && !warmstart_information.jacobian_sparsity_changed;
+   }
 
-      // hide pointer to this->evaluate_hessian, statistics, subproblem and Hessian
+   // hide pointers to the flag evaluate_hessian and the Hessian into BQPD's lws. The members of the evaluation space do not
+   // move, so this is done once and for all
+   void BQPDSolver::hide_evaluation_space_pointers_in_workspace() {
       hide_pointer(0, this->lws.data(), this->evaluation_space.evaluate_hessian);
-      WSC.ll += sizeof(intptr_t);
-      hide_pointer(1, this->lws.data(), statistics);
-      WSC.ll += sizeof(intptr_t);
-      hide_pointer(2, this->lws.data(), subproblem);
-      WSC.ll += sizeof(intptr_t);
       hide_pointer(3, this->lws.data(), this->evaluation_space.hessian_row_indices);
-      WSC.ll += sizeof(intptr_t);
       hide_pointer(4, this->lws.data(), this->evaluation_space.hessian_column_indices);
-      WSC.ll += sizeof(intptr_t);
       hide_pointer(5, this->lws.data(), this->evaluation_space.hessian_values);
-      WSC.ll += sizeof(intptr_t);
+   }
+
+   // hide pointers to the statistics and the subproblem into BQPD's lws
+   void BQPDSolver::hide_pointers_in_workspace(Statistics& statistics, const Subproblem& subproblem) {
+      WSC.kk = 0; // length of ws that is used by gdotx
+      WSC.ll = static_cast<int>(BQPDSolver::number_hidden_pointers * sizeof(intptr_t)); // length of lws that is used by gdotx
+
+      hide_pointer(1, this->lws.data(), statistics);
+      hide_pointer(2, this->lws.data(), subproblem);
    }
 
    void BQPDSolver::set_multipliers(size_t number_variables, Multipliers& direction_multipliers) const {
@@ -43,6 +43,7 @@ namespace uno {
    class BQPDSolver : public QPSolver {
    public:
       explicit BQPDSolver(const Options& options);
+      ~BQPDSolver() override;
 
       void initialize_memory(const Subproblem& subproblem) override;
 
@@ -70,14 +71,19 @@ namespace uno {
       int iprint{0}, nout{6};
       double fmin{-1e20};
       int peq_solution{0}, ifail{0};
+      // pointers to the flag evaluate_hessian, the statistics, the subproblem and the Hessian
+      static constexpr size_t number_hidden_pointers{6};
+      bool reduced_hessian_factors_available{false};
 
       const bool print_subproblem;
 
       void set_up_subproblem(Statistics& statistics, const Subproblem& subproblem, const WarmstartInformation& warmstart_information);
       void display_subproblem(const Subproblem& subproblem, const Vector<double>& initial_point) const;
       void solve_subproblem(const Subproblem& subproblem, const Vector<double>& initial_point, Direction& direction,
-         const WarmstartInformation& warmstart_information);
-      [[nodiscard]] static BQPDMode determine_mode(const WarmstartInformation& warmstart_information);
+         const WarmstartInformation& warmstart_information, bool factors_lost);
+      [[nodiscard]] BQPDMode determine_mode(const WarmstartInformation& warmstart_information, bool factors_lost) const;
+      [[nodiscard]] static bool only_variable_bounds_changed(const WarmstartInformation& warmstart_information);
+      void hide_evaluation_space_pointers_in_workspace();
       void hide_pointers_in_workspace(Statistics& statistics, const Subproblem& subproblem);
       void compute_gradients_sparsity(const Subproblem& subproblem);
       void set_multipliers(size_t number_variables, Multipliers& direction_multipliers) const;
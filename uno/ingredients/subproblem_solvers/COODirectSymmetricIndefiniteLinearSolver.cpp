@@ -0,0 +1,119 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include "COODirectSymmetricIndefiniteLinearSolver.hpp"
+#include "ingredients/subproblem/Subproblem.hpp"
+#include "optimization/Direction.hpp"
+#include "optimization/OptimizationProblem.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   COODirectSymmetricIndefiniteLinearSolver::COODirectSymmetricIndefiniteLinearSolver(std::string solver_name, const Options& options):
+         DirectSymmetricIndefiniteLinearSolver<double>(),
+         solver_name(std::move(solver_name)),
+         evaluation_space(options) {
+   }
+
+   void COODirectSymmetricIndefiniteLinearSolver::initialize_hessian(const Subproblem& subproblem) {
+      this->evaluation_space.initialize_hessian(subproblem);
+      this->resize_workspace(subproblem.number_variables);
+   }
+
+   void COODirectSymmetricIndefiniteLinearSolver::initialize_augmented_system(const Subproblem& subproblem) {
+      this->evaluation_space.initialize_augmented_system(subproblem);
+      this->resize_workspace(subproblem.number_variables + subproblem.number_constraints);
+   }
+
+   void COODirectSymmetricIndefiniteLinearSolver::initialize_least_square_system(const OptimizationProblem& problem) {
+      this->evaluation_space.initialize_least_square_system(problem);
+      this->resize_workspace(problem.number_variables + problem.number_constraints);
+   }
+
+   bool COODirectSymmetricIndefiniteLinearSolver::increase_pivot_tolerance() {
+      const double maximum_pivot_tolerance = 0.5;
+      double& pivot_tolerance = this->pivot_tolerance();
+      const double new_pivot_tolerance = std::min(maximum_pivot_tolerance, std::pow(pivot_tolerance, 0.75));
+      if (new_pivot_tolerance <= pivot_tolerance) {
+         return false;
+      }
+      pivot_tolerance = new_pivot_tolerance;
+      DEBUG << this->solver_name << ": pivot tolerance increased to " << pivot_tolerance << '\n';
+      return true;
+   }
+
+   void COODirectSymmetricIndefiniteLinearSolver::solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem,
+         Direction& direction, const WarmstartInformation& warmstart_information) {
+      // set up the linear system by evaluating the functions at the current iterate
+      this->evaluation_space.set_up_linear_system(statistics, subproblem, *this, warmstart_information);
+      // solve the linear system. If the iterative refinement stalls, the factorization is not accurate enough: the pivot
+      // tolerance is increased and the matrix is refactorized by the regularization strategy (with inertia correction)
+      while (!this->evaluation_space.solve_with_iterative_refinement(*this)) {
+         if (!this->increase_pivot_tolerance()) {
+            WARNING << this->solver_name << ": the iterative refinement stalled and the pivot tolerance cannot be increased\n";
+            break;
+         }
+         this->evaluation_space.regularize_linear_system(statistics, subproblem, *this);
+      }
+      this->evaluation_space.unscale_solution();
+      // assemble the full primal-dual direction
+      subproblem.assemble_primal_dual_direction(this->evaluation_space.solution, direction);
+      if (this->matrix_is_singular()) {
+         direction.status = SubproblemStatus::INFEASIBLE;
+      }
+   }
+
+   void COODirectSymmetricIndefiniteLinearSolver::solve_indefinite_systems(Statistics& statistics, const Subproblem& subproblem,
+         const Subproblem& second_subproblem, const WarmstartInformation& warmstart_information, Vector<double>& solutions) {
+      this->evaluation_space.set_up_linear_system(statistics, subproblem, *this, warmstart_information);
+      this->evaluation_space.stack_rhs_with_new_objective_gradient(second_subproblem);
+      // both right-hand sides are solved with a single (multiple-RHS) call to the backend
+      while (!this->evaluation_space.solve_stacked_systems_with_iterative_refinement(*this)) {
+         if (!this->increase_pivot_tolerance()) {
+            WARNING << this->solver_name << ": the iterative refinement stalled and the pivot tolerance cannot be increased\n";
+            break;
+         }
+         this->evaluation_space.regularize_linear_system(statistics, subproblem, *this);
+      }
+      solutions = this->evaluation_space.stacked_solutions;
+   }
+
+   void COODirectSymmetricIndefiniteLinearSolver::solve_indefinite_system_with_corrected_constraints(const Subproblem& subproblem,
+         const std::vector<double>& corrected_constraints, Direction& direction) {
+      // reuse the current factorization: only the RHS changes
+      this->evaluation_space.assemble_corrected_rhs(subproblem, corrected_constraints);
+      this->solve_with_current_factorization();
+      this->evaluation_space.unscale_solution();
+      subproblem.assemble_primal_dual_direction(this->evaluation_space.solution, direction);
+   }
+
+   void COODirectSymmetricIndefiniteLinearSolver::solve_indefinite_system_with_new_objective_gradient(const Subproblem& subproblem,
+         Vector<double>& solution) {
+      // reuse the current factorization: only the RHS changes
+      this->evaluation_space.assemble_rhs_with_new_objective_gradient(subproblem);
+      this->solve_with_current_factorization();
+      this->evaluation_space.unscale_solution();
+      solution = this->evaluation_space.solution;
+   }
+
+   void COODirectSymmetricIndefiniteLinearSolver::solve_least_square_system(const OptimizationProblem& problem, Iterate& iterate,
+         Vector<double>& solution) {
+      this->evaluation_space.set_up_least_square_system(problem, iterate, *this);
+      this->solve_with_current_factorization();
+      this->evaluation_space.unscale_solution();
+      solution = this->evaluation_space.solution;
+   }
+
+   // the factorization is shared with other solves and is not recomputed: the refined solution is kept
+   void COODirectSymmetricIndefiniteLinearSolver::solve_with_current_factorization() {
+      if (!this->evaluation_space.solve_with_iterative_refinement(*this)) {
+         DEBUG << this->solver_name << ": the iterative refinement stalled with the current factorization\n";
+      }
+   }
+
+   EvaluationSpace& COODirectSymmetricIndefiniteLinearSolver::get_evaluation_space() {
+      return this->evaluation_space;
+   }
+} // namespace
@@ -0,0 +1,51 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_COODIRECTSYMMETRICINDEFINITELINEARSOLVER_H
+#define UNO_COODIRECTSYMMETRICINDEFINITELINEARSOLVER_H
+
+#include <string>
+#include "COOEvaluationSpace.hpp"
+#include "DirectSymmetricIndefiniteLinearSolver.hpp"
+
+namespace uno {
+   // common layer of the direct solvers that factorize a matrix in COO format (MA27, MA57, MUMPS): the assembly of the
+   // linear systems and the solves with the current factorization are shared. The backends implement the primitives
+   // (workspace, analysis, factorization, solve, inertia)
+   class COODirectSymmetricIndefiniteLinearSolver: public DirectSymmetricIndefiniteLinearSolver<double> {
+   public:
+      COODirectSymmetricIndefiniteLinearSolver(std::string solver_name, const Options& options);
+      ~COODirectSymmetricIndefiniteLinearSolver() override = default;
+
+      void initialize_hessian(const Subproblem& subproblem) override;
+      void initialize_augmented_system(const Subproblem& subproblem) override;
+      void initialize_least_square_system(const OptimizationProblem& problem) override;
+
+      // the relative pivot tolerance is increased as u := u^0.75 (as in IPOPT). Values larger than 0.5 are treated as 0.5
+      [[nodiscard]] bool increase_pivot_tolerance() override;
+
+      using DirectSymmetricIndefiniteLinearSolver<double>::solve_indefinite_system;
+      void solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
+         const WarmstartInformation& warmstart_information) override;
+      void solve_indefinite_systems(Statistics& statistics, const Subproblem& subproblem, const Subproblem& second_subproblem,
+         const WarmstartInformation& warmstart_information, Vector<double>& solutions) override;
+      void solve_indefinite_system_with_corrected_constraints(const Subproblem& subproblem,
+         const std::vector<double>& corrected_constraints, Direction& direction) override;
+      void solve_indefinite_system_with_new_objective_gradient(const Subproblem& subproblem, Vector<double>& solution) override;
+      void solve_least_square_system(const OptimizationProblem& problem, Iterate& iterate, Vector<double>& solution) override;
+
+      [[nodiscard]] EvaluationSpace& get_evaluation_space() override;
+
+   protected:
+      const std::string solver_name;
+      COOEvaluationSpace evaluation_space;
+
+      // allocate the workspace of the backend for a matrix of a given dimension (the sparsity is in the evaluation space)
+      virtual void resize_workspace(size_t dimension) = 0;
+      // relative pivot tolerance of the numerical factorization
+      [[nodiscard]] virtual double& pivot_tolerance() = 0;
+      void solve_with_current_factorization();
+   };
+} // namespace
+
+#endif // UNO_COODIRECTSYMMETRICINDEFINITELINEARSOLVER_H
@@ -1,16 +1,32 @@
 // Copyright (c) 2025 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
+#include <cmath>
 #include <stdexcept>
 #include "COOEvaluationSpace.hpp"
 #include "ingredients/subproblem/Subproblem.hpp"
 #include "ingredients/subproblem_solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
 #include "linear_algebra/COOMatrix.hpp"
 #include "linear_algebra/Indexing.hpp"
+#include "linear_algebra/Norm.hpp"
 #include "linear_algebra/Vector.hpp"
+#include "optimization/Iterate.hpp"
+#include "optimization/OptimizationProblem.hpp"
 #include "optimization/WarmstartInformation.hpp"
+#include "options/Options.hpp"
+#include "tools/Logger.hpp"
 
 namespace uno {
+   COOEvaluationSpace::COOEvaluationSpace(const Options& options):
+         equilibrate_matrix(options.get_bool("kkt_matrix_equilibration")),
+         equilibration_iterations(options.get_unsigned_int("kkt_matrix_equilibration_iterations")),
+         equilibration_tolerance(options.get_double("kkt_matrix_equilibration_tolerance")),
+         maximum_refinement_steps(options.get_unsigned_int("kkt_refinement_max_steps")),
+         refinement_tolerance(options.get_double("kkt_refinement_tolerance")),
+         refinement_stall_factor(options.get_double("kkt_refinement_stall_factor")) {
+   }
+
    void COOEvaluationSpace::initialize_hessian(const Subproblem& subproblem) {
       if (!subproblem.has_hessian_matrix()) {
          throw std::runtime_error("The subproblem does not have an explicit Hessian matrix and cannot be solved with a direct linear solver");
@@ -28,6 +44,8 @@ namespace uno {
       this->matrix_values.resize(this->number_matrix_nonzeros);
       this->rhs.resize(dimension);
       this->solution.resize(dimension);
+      this->residuals.resize(dimension);
+      this->correction.resize(dimension);
    }
 
    void COOEvaluationSpace::initialize_augmented_system(const Subproblem& subproblem) {
@@ -58,6 +76,53 @@ namespace uno {
       this->matrix_values.resize(this->number_matrix_nonzeros);
       this->rhs.resize(dimension);
       this->solution.resize(dimension);
+      this->residuals.resize(dimension);
+      this->correction.resize(dimension);
+      if (this->equilibrate_matrix) {
+         this->equilibration_factors.resize(dimension);
+         this->row_norms.resize(dimension);
+         this->equilibrated_matrix_values.resize(this->number_matrix_nonzeros);
+      }
+   }
+
+   void COOEvaluationSpace::initialize_least_square_system(const OptimizationProblem& problem) {
+      const size_t dimension = problem.number_variables + problem.number_constraints;
+
+      // evaluations
+      this->objective_gradient.resize(problem.number_variables);
+
+      // Jacobian
+      this->number_jacobian_nonzeros = problem.number_jacobian_nonzeros();
+      this->jacobian_row_indices.resize(this->number_jacobian_nonzeros);
+      this->jacobian_column_indices.resize(this->number_jacobian_nonzeros);
+      problem.compute_constraint_jacobian_sparsity(this->jacobian_row_indices.data(), this->jacobian_column_indices.data(),
+         Indexing::C_indexing, MatrixOrder::COLUMN_MAJOR);
+
+      // augmented system: identity block, then Jacobian block
+      this->number_hessian_nonzeros = problem.number_variables;
+      this->number_matrix_nonzeros = this->number_hessian_nonzeros + this->number_jacobian_nonzeros;
+      this->matrix_row_indices.resize(this->number_matrix_nonzeros);
+      this->matrix_column_indices.resize(this->number_matrix_nonzeros);
+      for (size_t variable_index: Range(problem.number_variables)) {
+         this->matrix_row_indices[variable_index] = static_cast<int>(variable_index) + Indexing::Fortran_indexing;
+         this->matrix_column_indices[variable_index] = static_cast<int>(variable_index) + Indexing::Fortran_indexing;
+      }
+      for (size_t nonzero_index: Range(this->number_jacobian_nonzeros)) {
+         const size_t matrix_index = this->number_hessian_nonzeros + nonzero_index;
+         this->matrix_row_indices[matrix_index] = static_cast<int>(problem.number_variables) +
+            this->jacobian_row_indices[nonzero_index] + Indexing::Fortran_indexing;
+         this->matrix_column_indices[matrix_index] = this->jacobian_column_indices[nonzero_index] + Indexing::Fortran_indexing;
+      }
+      this->matrix_values.resize(this->number_matrix_nonzeros);
+      this->rhs.resize(dimension);
+      this->solution.resize(dimension);
+      this->residuals.resize(dimension);
+      this->correction.resize(dimension);
+      if (this->equilibrate_matrix) {
+         this->equilibration_factors.resize(dimension);
+         this->row_norms.resize(dimension);
+         this->equilibrated_matrix_values.resize(this->number_matrix_nonzeros);
+      }
    }
 
    void COOEvaluationSpace::evaluate_constraint_jacobian(const OptimizationProblem& problem, Iterate& iterate) {
@@ -113,16 +178,218 @@ namespace uno {
             linear_solver.do_symbolic_analysis();
             this->analysis_performed = true;
          }
-         // assemble the augmented matrix
+         // assemble the augmented matrix and the RHS
          subproblem.assemble_augmented_matrix(statistics, this->matrix_values.data());
-         // regularize the augmented matrix (this calls the analysis and the factorization)
-         subproblem.regularize_augmented_matrix(statistics, this->matrix_values.data(),
-            subproblem.dual_regularization_factor(), linear_solver);
-
-         // assemble the RHS
          const COOMatrix jacobian{this->jacobian_row_indices.data(), this->jacobian_column_indices.data(),
             this->matrix_values.data() + this->number_hessian_nonzeros};
          subproblem.assemble_augmented_rhs(this->objective_gradient, this->constraints, jacobian, this->rhs);
+         if (this->equilibrate_matrix) {
+            // the original matrix is kept intact (the Jacobian is used in the matrix-vector products)
+            this->equilibrate_linear_system();
+         }
+         this->regularize_linear_system(statistics, subproblem, linear_solver);
+      }
+   }
+
+   void COOEvaluationSpace::regularize_linear_system(Statistics& statistics, const Subproblem& subproblem,
+         DirectSymmetricIndefiniteLinearSolver<double>& linear_solver) {
+      // regularize the augmented matrix (this calls the factorization)
+      double* factorized_matrix_values = this->equilibrate_matrix ? this->equilibrated_matrix_values.data() : this->matrix_values.data();
+      subproblem.regularize_augmented_matrix(statistics, factorized_matrix_values, subproblem.dual_regularization_factor(),
+         linear_solver);
+   }
+
+   void COOEvaluationSpace::set_up_least_square_system(const OptimizationProblem& problem, Iterate& iterate,
+         DirectSymmetricIndefiniteLinearSolver<double>& linear_solver) {
+      // perform the symbolic analysis once and for all
+      if (!this->analysis_performed) {
+         DEBUG << "Performing symbolic analysis of the least-square system\n";
+         linear_solver.do_symbolic_analysis();
+         this->analysis_performed = true;
+      }
+
+      // matrix [I J^T; J 0]
+      for (size_t variable_index: Range(problem.number_variables)) {
+         this->matrix_values[variable_index] = 1.;
+      }
+      problem.evaluate_constraint_jacobian(iterate, this->matrix_values.data() + this->number_hessian_nonzeros);
+
+      // RHS [∇f - z; 0]
+      problem.evaluate_objective_gradient(iterate, this->objective_gradient.data());
+      for (size_t variable_index: Range(problem.number_variables)) {
+         this->rhs[variable_index] = this->objective_gradient[variable_index] - iterate.multipliers.lower_bounds[variable_index] -
+            iterate.multipliers.upper_bounds[variable_index];
+      }
+      for (size_t constraint_index: Range(problem.number_constraints)) {
+         this->rhs[problem.number_variables + constraint_index] = 0.;
+      }
+
+      if (this->equilibrate_matrix) {
+         this->equilibrate_linear_system();
+      }
+      linear_solver.do_numerical_factorization(this->get_factorized_matrix_values().data());
+   }
+
+   const Vector<double>& COOEvaluationSpace::get_factorized_matrix_values() const {
+      return this->equilibrate_matrix ? this->equilibrated_matrix_values : this->matrix_values;
+   }
+
+   bool COOEvaluationSpace::solve_with_iterative_refinement(DirectSymmetricIndefiniteLinearSolver<double>& linear_solver) {
+      linear_solver.solve_indefinite_system(this->get_factorized_matrix_values(), this->rhs, this->solution);
+      return this->refine_solution(linear_solver);
+   }
+
+   void COOEvaluationSpace::stack_rhs_with_new_objective_gradient(const Subproblem& second_subproblem) {
+      const size_t dimension = this->rhs.size();
+      this->stacked_rhs.resize(2 * dimension);
+      this->stacked_solutions.resize(2 * dimension);
+      std::copy(this->rhs.begin(), this->rhs.end(), this->stacked_rhs.begin());
+      this->assemble_rhs_with_new_objective_gradient(second_subproblem);
+      std::copy(this->rhs.begin(), this->rhs.end(), this->stacked_rhs.begin() + static_cast<std::ptrdiff_t>(dimension));
+   }
+
+   bool COOEvaluationSpace::solve_stacked_systems_with_iterative_refinement(DirectSymmetricIndefiniteLinearSolver<double>& linear_solver) {
+      const size_t dimension = this->rhs.size();
+      const size_t number_rhs = this->stacked_rhs.size() / dimension;
+      linear_solver.solve_indefinite_system(this->get_factorized_matrix_values(), this->stacked_rhs, this->stacked_solutions, number_rhs);
+      // refine and unscale the solutions one after the other
+      bool refinement_successful = true;
+      for (size_t rhs_index: Range(number_rhs)) {
+         const auto first = static_cast<std::ptrdiff_t>(rhs_index * dimension);
+         const auto last = first + static_cast<std::ptrdiff_t>(dimension);
+         std::copy(this->stacked_rhs.begin() + first, this->stacked_rhs.begin() + last, this->rhs.begin());
+         std::copy(this->stacked_solutions.begin() + first, this->stacked_solutions.begin() + last, this->solution.begin());
+         refinement_successful = this->refine_solution(linear_solver) && refinement_successful;
+         this->unscale_solution();
+         std::copy(this->solution.begin(), this->solution.end(), this->stacked_solutions.begin() + first);
+      }
+      return refinement_successful;
+   }
+
+   // refine the solution until the relative residual is small enough
+   bool COOEvaluationSpace::refine_solution(DirectSymmetricIndefiniteLinearSolver<double>& linear_solver) {
+      if (this->maximum_refinement_steps == 0) {
+         return true;
+      }
+
+      const Vector<double>& factorized_matrix_values = this->get_factorized_matrix_values();
+      double relative_residual = this->compute_relative_residual();
+      size_t number_refinement_steps = 0;
+      while (this->refinement_tolerance < relative_residual) {
+         // refinement step: solve K dx = r and update x := x + dx
+         linear_solver.solve_indefinite_system(factorized_matrix_values, this->residuals, this->correction);
+         this->solution += this->correction;
+         ++number_refinement_steps;
+         const double previous_relative_residual = relative_residual;
+         relative_residual = this->compute_relative_residual();
+         DEBUG2 << "Iterative refinement step " << number_refinement_steps << ": relative residual = " << relative_residual << '\n';
+
+         const bool refinement_stalled = (this->refinement_stall_factor * previous_relative_residual <= relative_residual);
+         if (this->refinement_tolerance < relative_residual &&
+               (refinement_stalled || number_refinement_steps == this->maximum_refinement_steps)) {
+            DEBUG << "The iterative refinement stalled with relative residual " << relative_residual << '\n';
+            return false;
+         }
+      }
+      return true;
+   }
+
+   // the equilibrated system (D K D) y = D rhs has solution y = D^{-1} x
+   void COOEvaluationSpace::unscale_solution() {
+      if (this->equilibrate_matrix) {
+         for (size_t index: Range(this->solution.size())) {
+            this->solution[index] *= this->equilibration_factors[index];
+         }
+      }
+   }
+
+   void COOEvaluationSpace::assemble_corrected_rhs(const Subproblem& subproblem, const std::vector<double>& corrected_constraints) {
+      const COOMatrix jacobian{this->jacobian_row_indices.data(), this->jacobian_column_indices.data(),
+         this->matrix_values.data() + this->number_hessian_nonzeros};
+      subproblem.assemble_augmented_rhs(this->objective_gradient, corrected_constraints, jacobian, this->rhs);
+      if (this->equilibrate_matrix) {
+         this->scale_rhs();
+      }
+   }
+
+   void COOEvaluationSpace::assemble_rhs_with_new_objective_gradient(const Subproblem& subproblem) {
+      subproblem.problem.evaluate_objective_gradient(subproblem.current_iterate, this->objective_gradient.data());
+      const COOMatrix jacobian{this->jacobian_row_indices.data(), this->jacobian_column_indices.data(),
+         this->matrix_values.data() + this->number_hessian_nonzeros};
+      subproblem.assemble_augmented_rhs(this->objective_gradient, this->constraints, jacobian, this->rhs);
+      if (this->equilibrate_matrix) {
+         this->scale_rhs();
+      }
+   }
+
+   // symmetric Ruiz equilibration: iteratively scale the rows and columns by the inverse square roots of their infinity norms.
+   // The regularization entries are ignored, since they are set by the regularization strategy on the equilibrated matrix
+   void COOEvaluationSpace::equilibrate_linear_system() {
+      const size_t number_nonzeros = this->number_hessian_nonzeros + this->number_jacobian_nonzeros;
+      this->equilibration_factors.fill(1.);
+      this->equilibrated_matrix_values = this->matrix_values;
+
+      for (size_t iteration: Range(this->equilibration_iterations)) {
+         // infinity norms of the rows (the matrix is symmetric and only one triangle is stored)
+         this->row_norms.fill(0.);
+         for (size_t nonzero_index: Range(number_nonzeros)) {
+            const size_t row_index = static_cast<size_t>(this->matrix_row_indices[nonzero_index] - Indexing::Fortran_indexing);
+            const size_t column_index = static_cast<size_t>(this->matrix_column_indices[nonzero_index] - Indexing::Fortran_indexing);
+            const double entry = std::abs(this->equilibrated_matrix_values[nonzero_index]);
+            this->row_norms[row_index] = std::max(this->row_norms[row_index], entry);
+            this->row_norms[column_index] = std::max(this->row_norms[column_index], entry);
+         }
+         // check convergence and compute the scaling of this iteration
+         double largest_deviation = 0.;
+         for (size_t index: Range(this->row_norms.size())) {
+            if (0. < this->row_norms[index]) {
+               largest_deviation = std::max(largest_deviation, std::abs(1. - this->row_norms[index]));
+               this->row_norms[index] = 1. / std::sqrt(this->row_norms[index]);
+            }
+            else {
+               this->row_norms[index] = 1.;
+            }
+         }
+         DEBUG2 << "Equilibration iteration " << iteration << ": largest deviation of the row norms from 1 = " << largest_deviation << '\n';
+         if (largest_deviation <= this->equilibration_tolerance) {
+            break;
+         }
+         // scale the matrix and accumulate the scaling factors
+         for (size_t nonzero_index: Range(number_nonzeros)) {
+            const size_t row_index = static_cast<size_t>(this->matrix_row_indices[nonzero_index] - Indexing::Fortran_indexing);
+            const size_t column_index = static_cast<size_t>(this->matrix_column_indices[nonzero_index] - Indexing::Fortran_indexing);
+            this->equilibrated_matrix_values[nonzero_index] *= this->row_norms[row_index] * this->row_norms[column_index];
+         }
+         for (size_t index: Range(this->equilibration_factors.size())) {
+            this->equilibration_factors[index] *= this->row_norms[index];
+         }
+      }
+
+      this->scale_rhs();
+   }
+
+   // compute the residuals r = rhs - K x of the factorized (symmetric, one triangle) matrix and the relative residual
+   // ||r|| / (||x|| + ||rhs||)
+   double COOEvaluationSpace::compute_relative_residual() {
+      const Vector<double>& factorized_matrix_values = this->get_factorized_matrix_values();
+      this->residuals = this->rhs;
+      for (size_t nonzero_index: Range(this->number_matrix_nonzeros)) {
+         const size_t row_index = static_cast<size_t>(this->matrix_row_indices[nonzero_index] - Indexing::Fortran_indexing);
+         const size_t column_index = static_cast<size_t>(this->matrix_column_indices[nonzero_index] - Indexing::Fortran_indexing);
+         const double entry = factorized_matrix_values[nonzero_index];
+         this->residuals[row_index] -= entry * this->solution[column_index];
+         if (row_index != column_index) {
+            this->residuals[column_index] -= entry * this->solution[row_index];
+         }
+      }
+      const double denominator = norm_inf(this->solution) + norm_inf(this->rhs);
+      const double residual_norm = norm_inf(this->residuals);
+      return (0. < denominator) ? residual_norm / denominator : residual_norm;
+   }
+
+   void COOEvaluationSpace::scale_rhs() {
+      for (size_t index: Range(this->rhs.size())) {
+         this->rhs[index] *= this->equilibration_factors[index];
       }
    }
 } // namespace
\ No newline at end of file
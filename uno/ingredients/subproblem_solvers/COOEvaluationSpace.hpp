@@ -10,13 +10,19 @@
 #include "optimization/EvaluationSpace.hpp"
 
 namespace uno {
+   // forward declaration
+   class Options;
+
    class COOEvaluationSpace: public EvaluationSpace {
    public:
       COOEvaluationSpace() = default;
+      explicit COOEvaluationSpace(const Options& options);
       ~COOEvaluationSpace() override = default;
 
       void initialize_hessian(const Subproblem& subproblem);
       void initialize_augmented_system(const Subproblem& subproblem);
+      // least-square multiplier estimate: augmented system [I J^T; J 0] whose Jacobian block has the sparsity of the problem
+      void initialize_least_square_system(const OptimizationProblem& problem);
 
       void evaluate_constraint_jacobian(const OptimizationProblem& problem, Iterate& iterate) override;
       void compute_constraint_jacobian_vector_product(const Vector<double>& vector, Vector<double>& result) const override;
@@ -26,6 +32,30 @@ namespace uno {
 
       void set_up_linear_system(Statistics& statistics, const Subproblem& subproblem, DirectSymmetricIndefiniteLinearSolver<double>& linear_solver,
          const WarmstartInformation& warmstart_information);
+      // assemble [I J^T; J 0] and the RHS [∇f - z; 0] at the iterate, then factorize the matrix. The symbolic analysis is
+      // performed once and for all
+      void set_up_least_square_system(const OptimizationProblem& problem, Iterate& iterate,
+         DirectSymmetricIndefiniteLinearSolver<double>& linear_solver);
+      // matrix that was factorized (the equilibrated matrix if equilibration is enabled)
+      [[nodiscard]] const Vector<double>& get_factorized_matrix_values() const;
+      // regularize and factorize the assembled (possibly equilibrated) matrix with the regularization strategy of the subproblem
+      void regularize_linear_system(Statistics& statistics, const Subproblem& subproblem,
+         DirectSymmetricIndefiniteLinearSolver<double>& linear_solver);
+      // solve the system with the current factorization and refine the solution until the relative residual is small enough.
+      // Returns false if the refinement stalled, that is if the factorization is not accurate enough
+      [[nodiscard]] bool solve_with_iterative_refinement(DirectSymmetricIndefiniteLinearSolver<double>& linear_solver);
+      // multiple right-hand sides: append the RHS of a second subproblem (reevaluated objective gradient) to the current RHS
+      void stack_rhs_with_new_objective_gradient(const Subproblem& second_subproblem);
+      // solve the system with the current factorization for all the stacked right-hand sides at once, then refine and unscale
+      // each solution. Returns false if a refinement stalled
+      [[nodiscard]] bool solve_stacked_systems_with_iterative_refinement(DirectSymmetricIndefiniteLinearSolver<double>& linear_solver);
+      // map the solution of the equilibrated system back to the solution of the original system
+      void unscale_solution();
+      // second-order correction: assemble the RHS with corrected constraint values. The matrix and its factorization are unchanged
+      void assemble_corrected_rhs(const Subproblem& subproblem, const std::vector<double>& corrected_constraints);
+      // predictor-corrector: reevaluate the objective gradient of the subproblem and reassemble the RHS. The matrix and
+      // its factorization are unchanged
+      void assemble_rhs_with_new_objective_gradient(const Subproblem& subproblem);
 
       Vector<double> objective_gradient{}; /*!< Sparse Jacobian of the objective */
       std::vector<double> constraints{}; /*!< Constraint values (size \f$m)\f$ */
@@ -43,7 +73,31 @@ namespace uno {
       Vector<double> matrix_values;
       Vector<double> rhs{};
       Vector<double> solution{};
+      // right-hand sides and solutions stored contiguously (column after column)
+      Vector<double> stacked_rhs{};
+      Vector<double> stacked_solutions{};
       bool analysis_performed{false};
+
+   protected:
+      // symmetric equilibration D K D of the augmented matrix (Ruiz scaling)
+      const bool equilibrate_matrix{false};
+      const size_t equilibration_iterations{0};
+      const double equilibration_tolerance{0.};
+      Vector<double> equilibration_factors{};
+      Vector<double> row_norms{};
+      Vector<double> equilibrated_matrix_values{};
+
+      // iterative refinement
+      const size_t maximum_refinement_steps{0};
+      const double refinement_tolerance{0.};
+      const double refinement_stall_factor{0.};
+      Vector<double> residuals{};
+      Vector<double> correction{};
+
+      void equilibrate_linear_system();
+      void scale_rhs();
+      [[nodiscard]] bool refine_solution(DirectSymmetricIndefiniteLinearSolver<double>& linear_solver);
+      [[nodiscard]] double compute_relative_residual();
    };
 } // namespace
 
@@ -4,8 +4,11 @@
 #ifndef UNO_DIRECTSYMMETRICINDEFINITELINEARSOLVER_H
 #define UNO_DIRECTSYMMETRICINDEFINITELINEARSOLVER_H
 
+#include <algorithm>
+#include <cassert>
 #include "SymmetricIndefiniteLinearSolver.hpp"
 #include "ingredients/regularization_strategies/Inertia.hpp"
+#include "linear_algebra/Vector.hpp"
 
 namespace uno {
    template <typename ElementType>
@@ -16,12 +19,34 @@ namespace uno {
 
       virtual void do_symbolic_analysis() = 0;
       virtual void do_numerical_factorization(const double* matrix_values) = 0;
+      // increase the relative pivot tolerance of the numerical factorization. Returns false if it is already maximal
+      [[nodiscard]] virtual bool increase_pivot_tolerance() = 0;
+
+      using SymmetricIndefiniteLinearSolver<ElementType>::solve_indefinite_system;
+      // fallback for the backends without a native multiple-RHS solve: the right-hand sides are solved one after the other
+      void solve_indefinite_system(const Vector<double>& matrix_values, const Vector<ElementType>& rhs, Vector<ElementType>& result,
+            size_t number_rhs) override {
+         assert(number_rhs == 0 || rhs.size() % number_rhs == 0);
+         const size_t dimension = (number_rhs == 0) ? 0 : rhs.size() / number_rhs;
+         this->single_rhs.resize(dimension);
+         this->single_result.resize(dimension);
+         result.resize(rhs.size());
+         for (size_t rhs_index = 0; rhs_index < number_rhs; ++rhs_index) {
+            const auto offset = static_cast<std::ptrdiff_t>(rhs_index * dimension);
+            std::copy(rhs.begin() + offset, rhs.begin() + offset + static_cast<std::ptrdiff_t>(dimension), this->single_rhs.begin());
+            this->solve_indefinite_system(matrix_values, this->single_rhs, this->single_result);
+            std::copy(this->single_result.begin(), this->single_result.end(), result.begin() + offset);
+         }
+      }
 
       [[nodiscard]] virtual Inertia get_inertia() const = 0;
       [[nodiscard]] virtual size_t number_negative_eigenvalues() const = 0;
       // [[nodiscard]] virtual bool matrix_is_positive_definite() const = 0;
-      [[nodiscard]] virtual bool matrix_is_singular() const = 0;
       [[nodiscard]] virtual size_t rank() const = 0;
+
+   protected:
+      Vector<ElementType> single_rhs{};
+      Vector<ElementType> single_result{};
    };
 } // namespace
 
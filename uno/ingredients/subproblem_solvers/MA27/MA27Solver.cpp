@@ -5,9 +5,9 @@
 #include <cassert>
 #include <stdexcept>
 #include "MA27Solver.hpp"
-#include "ingredients/subproblem/Subproblem.hpp"
+#include "ingredients/subproblem_solvers/NestedDissectionOrdering.hpp"
 #include "linear_algebra/Vector.hpp"
-#include "optimization/Direction.hpp"
+#include "options/Options.hpp"
 #include "tools/Logger.hpp"
 #include "fortran_interface.h"
 
@@ -111,35 +111,22 @@ namespace uno {
    };
 
 
-   MA27Solver::MA27Solver(): DirectSymmetricIndefiniteLinearSolver() {
+   MA27Solver::MA27Solver(const Options& options): COODirectSymmetricIndefiniteLinearSolver("MA27", options),
+         use_nested_dissection_ordering(options.get_string("linear_solver_ordering") == "METIS") {
+      if (this->use_nested_dissection_ordering && !NestedDissectionOrdering::is_available) {
+         throw std::invalid_argument("The METIS ordering is not available. Recompile Uno with METIS");
+      }
       // initialization: set the default values of the controlling parameters
       MA27_set_default_parameters(this->workspace.icntl.data(), this->workspace.cntl.data());
-      // a suitable pivot order is to be chosen automatically
-      this->workspace.iflag = 0;
+      // the pivot order is either chosen automatically or set by the nested dissection ordering
+      this->workspace.iflag = this->use_nested_dissection_ordering ? 1 : 0;
       // suppress warning messages
       this->workspace.icntl[eICNTL::LP] = 0;
       this->workspace.icntl[eICNTL::MP] = 0;
       this->workspace.icntl[eICNTL::LDIAG] = 0;
    }
 
-   void MA27Solver::initialize_hessian(const Subproblem& subproblem) {
-      this->evaluation_space.initialize_hessian(subproblem);
-
-      // workspace
-      const size_t dimension = subproblem.number_variables;
-      this->workspace.n = static_cast<int>(dimension);
-      this->workspace.nnz = static_cast<int>(this->evaluation_space.number_matrix_nonzeros);
-      // 20% more than 2*nnz + 3*n + 1
-      this->workspace.iw.resize((2 * this->evaluation_space.number_matrix_nonzeros + 3 * dimension + 1) * 6 / 5);
-      this->workspace.ikeep.resize(3 * dimension);
-      this->workspace.iw1.resize(2 * dimension);
-   }
-
-   void MA27Solver::initialize_augmented_system(const Subproblem& subproblem) {
-      this->evaluation_space.initialize_augmented_system(subproblem);
-
-      // workspace
-      const size_t dimension = subproblem.number_variables + subproblem.number_constraints;
+   void MA27Solver::resize_workspace(size_t dimension) {
       this->workspace.n = static_cast<int>(dimension);
       this->workspace.nnz = static_cast<int>(this->evaluation_space.number_matrix_nonzeros);
       // 20% more than 2*nnz + 3*n + 1
@@ -151,6 +138,13 @@ namespace uno {
    void MA27Solver::do_symbolic_analysis() {
       assert(!this->analysis_performed);
 
+      // fill-reducing pivot order provided by the user: IKEEP(i,1) is the position of variable i in the pivot order
+      if (this->use_nested_dissection_ordering) {
+         NestedDissectionOrdering::compute_pivot_positions(static_cast<size_t>(this->workspace.n), static_cast<size_t>(this->workspace.nnz),
+            this->evaluation_space.matrix_row_indices.data(), this->evaluation_space.matrix_column_indices.data(),
+            this->workspace.ikeep.data());
+      }
+
       int liw = static_cast<int>(this->workspace.iw.size());
       MA27_symbolic_analysis(&this->workspace.n, &this->workspace.nnz,              /* size info */
          this->evaluation_space.matrix_row_indices.data(), this->evaluation_space.matrix_column_indices.data(),                     /* matrix indices */
@@ -166,6 +160,10 @@ namespace uno {
          WARNING << "MA27 has issued a warning: IFLAG = " << this->workspace.info[eINFO::IFLAG] << " additional info, IERROR = "
             << this->workspace.info[eINFO::IERROR] << '\n';
       }
+      // forecast fill and flops of the ordering
+      DEBUG << "MA27 symbolic analysis with the " << (this->use_nested_dissection_ordering ? "METIS" : "built-in") <<
+         " ordering: " << this->workspace.info[eINFO::NRLADU] << " entries in the factors (matrix: " << this->workspace.nnz << "), " <<
+         this->workspace.ops << " flops\n";
       this->analysis_performed = true;
    }
 
@@ -211,6 +209,11 @@ namespace uno {
       this->factorization_performed = true;
    }
 
+   // relative pivot tolerance CNTL(1)
+   double& MA27Solver::pivot_tolerance() {
+      return this->workspace.cntl[eCNTL::U];
+   }
+
    void MA27Solver::solve_indefinite_system(const Vector<double>& /*matrix_values*/, const Vector<double>& rhs,
          Vector<double>& result) {
       assert(this->factorization_performed);
@@ -231,19 +234,6 @@ namespace uno {
       }
    }
 
-   void MA27Solver::solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
-         const WarmstartInformation& warmstart_information) {
-      // set up the linear system by evaluating the functions at the current iterate
-      this->evaluation_space.set_up_linear_system(statistics, subproblem, *this, warmstart_information);
-      // solve the linear system
-      this->solve_indefinite_system(this->evaluation_space.matrix_values, this->evaluation_space.rhs, this->evaluation_space.solution);
-      // assemble the full primal-dual direction
-      subproblem.assemble_primal_dual_direction(this->evaluation_space.solution, direction);
-      if (this->matrix_is_singular()) {
-         direction.status = SubproblemStatus::INFEASIBLE;
-      }
-   }
-
    Inertia MA27Solver::get_inertia() const {
       // rank = number_positive_eigenvalues + number_negative_eigenvalues
       // n = rank + number_zero_eigenvalues
@@ -268,10 +258,6 @@ namespace uno {
          static_cast<size_t>(this->workspace.n);
    }
 
-   EvaluationSpace& MA27Solver::get_evaluation_space() {
-      return this->evaluation_space;
-   }
-
    void MA27Solver::check_factorization_status() {
       switch (this->workspace.info[eINFO::IFLAG]) {
          case NSTEPS:
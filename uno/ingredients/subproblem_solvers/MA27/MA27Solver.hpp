@@ -6,8 +6,7 @@
 
 #include <array>
 #include <vector>
-#include "../DirectSymmetricIndefiniteLinearSolver.hpp"
-#include "../COOEvaluationSpace.hpp"
+#include "../COODirectSymmetricIndefiniteLinearSolver.hpp"
 
 namespace uno {
    // forward declaration
@@ -34,19 +33,15 @@ namespace uno {
       const size_t number_factorization_attempts{5};
    };
 
-   class MA27Solver: public DirectSymmetricIndefiniteLinearSolver<double> {
+   class MA27Solver: public COODirectSymmetricIndefiniteLinearSolver {
    public:
-      MA27Solver();
+      explicit MA27Solver(const Options& options);
       ~MA27Solver() override = default;
 
-      void initialize_hessian(const Subproblem& subproblem) override;
-      void initialize_augmented_system(const Subproblem& subproblem) override;
-
       void do_symbolic_analysis() override;
       void do_numerical_factorization(const double* matrix_values) override;
+      using COODirectSymmetricIndefiniteLinearSolver::solve_indefinite_system;
       void solve_indefinite_system(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result) override;
-      void solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
-         const WarmstartInformation& warmstart_information) override;
 
       [[nodiscard]] Inertia get_inertia() const override;
       [[nodiscard]] size_t number_negative_eigenvalues() const override;
@@ -54,17 +49,17 @@ namespace uno {
       [[nodiscard]] bool matrix_is_singular() const override;
       [[nodiscard]] size_t rank() const override;
 
-      [[nodiscard]] EvaluationSpace& get_evaluation_space() override;
-
    private:
       MA27Workspace workspace{};
-      COOEvaluationSpace evaluation_space{};
 
       bool analysis_performed{false};
       bool factorization_performed{false};
+      const bool use_nested_dissection_ordering;
 
       // bool use_iterative_refinement{false}; // Not sure how to do this with ma27
       void check_factorization_status();
+      void resize_workspace(size_t dimension) override;
+      [[nodiscard]] double& pivot_tolerance() override;
    };
 } // namespace
 
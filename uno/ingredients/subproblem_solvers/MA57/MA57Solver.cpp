@@ -4,12 +4,13 @@
 #include <algorithm>
 #include <cassert>
 #include <optional>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 #include "MA57Solver.hpp"
-#include "ingredients/subproblem/Subproblem.hpp"
+#include "ingredients/subproblem_solvers/NestedDissectionOrdering.hpp"
 #include "linear_algebra/Vector.hpp"
-#include "optimization/Direction.hpp"
+#include "options/Options.hpp"
 #include "tools/Logger.hpp"
 #include "fortran_interface.h"
 
@@ -17,7 +18,6 @@
 #define MA57_symbolic_analysis FC_GLOBAL(ma57ad, MA57AD)
 #define MA57_numerical_factorization FC_GLOBAL(ma57bd, MA57BD)
 #define MA57_linear_solve FC_GLOBAL(ma57cd, MA57CD)
-#define MA57_linear_solve_with_iterative_refinement FC_GLOBAL(ma57dd, MA57DD)
 #define MA57_enlarge_workspace FC_GLOBAL(ma57ed, MA57ED)
 
 namespace uno {
@@ -34,10 +34,6 @@ namespace uno {
       void MA57_linear_solve(const int* job, const int* n, double fact[], int* lfact, int ifact[], int* lifact, const int* nrhs,
          double rhs[], const int* lrhs, double work[], int* lwork, int iwork[], int icntl[], int info[]);
 
-      void MA57_linear_solve_with_iterative_refinement(const int* job, const int* n, int* ne, const double a[], const int irn[],
-         const int jcn[], double fact[], int* lfact, int ifact[], int* lifact, const double rhs[], double x[], double resid[],
-         double work[], int iwork[], int icntl[], double cntl[], int info[], double rinfo[]);
-
       // enlarging of workspaces when numerical factorization runs out of memory
       void MA57_enlarge_workspace(const int* n, const int* ic, int keep[], const double fact[], const int* lfact,
          double newfac[], const int* lnew, const int ifact[], const int* lifact, int newifc[], const int* linew,
@@ -74,36 +70,18 @@ namespace uno {
       }
    }  // anonymous namespace
 
-   MA57Solver::MA57Solver(): DirectSymmetricIndefiniteLinearSolver() {
+   MA57Solver::MA57Solver(const Options& options): COODirectSymmetricIndefiniteLinearSolver("MA57", options),
+         use_nested_dissection_ordering(options.get_string("linear_solver_ordering") == "METIS") {
+      if (this->use_nested_dissection_ordering && !NestedDissectionOrdering::is_available) {
+         throw std::invalid_argument("The METIS ordering is not available. Recompile Uno with METIS");
+      }
       // set the default values of the controlling parameters
       MA57_set_default_parameters(this->workspace.cntl.data(), this->workspace.icntl.data());
       // suppress warning messages
       this->workspace.icntl[4] = 0;
-      // iterative refinement enabled
-      this->workspace.icntl[8] = 1;
-   }
-
-   void MA57Solver::initialize_hessian(const Subproblem& subproblem) {
-      this->evaluation_space.initialize_hessian(subproblem);
-
-      // workspace
-      const size_t dimension = subproblem.number_variables;
-      this->workspace.n = static_cast<int>(dimension);
-      this->workspace.nnz = static_cast<int>(this->evaluation_space.number_matrix_nonzeros);
-      this->workspace.lkeep = static_cast<int>(5 * dimension + this->evaluation_space.number_matrix_nonzeros +
-         std::max(dimension, this->evaluation_space.number_matrix_nonzeros) + 42);
-      this->workspace.keep.resize(static_cast<size_t>(this->workspace.lkeep));
-      this->workspace.iwork.resize(5 * dimension);
-      this->workspace.lwork = static_cast<int>(1.2 * static_cast<double>(dimension));
-      this->workspace.work.resize(static_cast<size_t>(this->workspace.lwork));
-      this->workspace.residuals.resize(dimension);
    }
 
-   void MA57Solver::initialize_augmented_system(const Subproblem& subproblem) {
-      this->evaluation_space.initialize_augmented_system(subproblem);
-
-      // workspace
-      const size_t dimension = subproblem.number_variables + subproblem.number_constraints;
+   void MA57Solver::resize_workspace(size_t dimension) {
       this->workspace.n = static_cast<int>(dimension);
       this->workspace.nnz = static_cast<int>(this->evaluation_space.number_matrix_nonzeros);
       this->workspace.lkeep = static_cast<int>(5 * dimension + this->evaluation_space.number_matrix_nonzeros +
@@ -112,12 +90,19 @@ namespace uno {
       this->workspace.iwork.resize(5 * dimension);
       this->workspace.lwork = static_cast<int>(1.2 * static_cast<double>(dimension));
       this->workspace.work.resize(static_cast<size_t>(this->workspace.lwork));
-      this->workspace.residuals.resize(dimension);
    }
 
    void MA57Solver::do_symbolic_analysis() {
       assert(!this->analysis_performed);
 
+      // fill-reducing pivot order provided by the user: KEEP(i) is the position of variable i in the pivot order
+      if (this->use_nested_dissection_ordering) {
+         NestedDissectionOrdering::compute_pivot_positions(static_cast<size_t>(this->workspace.n), static_cast<size_t>(this->workspace.nnz),
+            this->evaluation_space.matrix_row_indices.data(), this->evaluation_space.matrix_column_indices.data(),
+            this->workspace.keep.data());
+         this->workspace.icntl[5] = 1;
+      }
+
       // symbolic analysis
       MA57_symbolic_analysis(&this->workspace.n, &this->workspace.nnz, this->evaluation_space.matrix_row_indices.data(),
          this->evaluation_space.matrix_column_indices.data(), &this->workspace.lkeep, this->workspace.keep.data(),
@@ -127,6 +112,10 @@ namespace uno {
       if (0 < this->workspace.info[0]) {
          WARNING << "MA57 has issued a warning: info(1) = " << workspace.info[0] << '\n';
       }
+      // forecast fill (INFO(5): number of reals in the factors) and flops (RINFO(2): elimination operations) of the ordering
+      DEBUG << "MA57 symbolic analysis with the " << (this->use_nested_dissection_ordering ? "METIS" : "built-in") <<
+         " ordering: " << this->workspace.info[4] << " entries in the factors (matrix: " << this->workspace.nnz << "), " <<
+         this->workspace.rinfo[1] << " flops\n";
 
       // get LFACT and LIFACT and resize FACT and IFACT (no effect if resized to <= size)
       int lfact = 2 * this->workspace.info[8];
@@ -178,42 +167,44 @@ namespace uno {
       this->factorization_performed = true;
    }
 
-   void MA57Solver::solve_indefinite_system(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result) {
+   // relative pivot tolerance CNTL(1)
+   double& MA57Solver::pivot_tolerance() {
+      return this->workspace.cntl[0];
+   }
+
+   void MA57Solver::solve_indefinite_system(const Vector<double>& /*matrix_values*/, const Vector<double>& rhs, Vector<double>& result) {
       assert(this->factorization_performed);
 
       // solve
       const int lrhs = this->workspace.n; // integer, length of rhs
 
-      // solve the linear system
-      if (this->use_iterative_refinement) {
-         MA57_linear_solve_with_iterative_refinement(&this->workspace.job, &this->workspace.n, &this->workspace.nnz,
-            matrix_values.data(), this->evaluation_space.matrix_row_indices.data(), this->evaluation_space.matrix_column_indices.data(),
-            this->workspace.fact.data(), &this->workspace.lfact, this->workspace.ifact.data(), &this->workspace.lifact,
-            rhs.data(), result.data(), this->workspace.residuals.data(), this->workspace.work.data(), this->workspace.iwork.data(),
-            this->workspace.icntl.data(), this->workspace.cntl.data(), this->workspace.info.data(), this->workspace.rinfo.data());
-      }
-      else {
-         // copy rhs into result (overwritten by MA57)
-         result = rhs;
-
-         MA57_linear_solve(&this->workspace.job, &this->workspace.n, this->workspace.fact.data(), &this->workspace.lfact,
-            this->workspace.ifact.data(), &this->workspace.lifact, &this->workspace.nrhs, result.data(), &lrhs,
-            this->workspace.work.data(), &this->workspace.lwork, this->workspace.iwork.data(), this->workspace.icntl.data(),
-            this->workspace.info.data());
-      }
+      // copy rhs into result (overwritten by MA57). The iterative refinement is performed by the evaluation space
+      result = rhs;
+      MA57_linear_solve(&this->workspace.job, &this->workspace.n, this->workspace.fact.data(), &this->workspace.lfact,
+         this->workspace.ifact.data(), &this->workspace.lifact, &this->workspace.nrhs, result.data(), &lrhs,
+         this->workspace.work.data(), &this->workspace.lwork, this->workspace.iwork.data(), this->workspace.icntl.data(),
+         this->workspace.info.data());
    }
 
-   void MA57Solver::solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
-         const WarmstartInformation& warmstart_information) {
-      // set up the linear system by evaluating the functions at the current iterate
-      this->evaluation_space.set_up_linear_system(statistics, subproblem, *this, warmstart_information);
-      // solve the linear system
-      this->solve_indefinite_system(this->evaluation_space.matrix_values, this->evaluation_space.rhs, this->evaluation_space.solution);
-      // assemble the full primal-dual direction
-      subproblem.assemble_primal_dual_direction(this->evaluation_space.solution, direction);
-      if (this->matrix_is_singular()) {
-         direction.status = SubproblemStatus::INFEASIBLE;
+   // native multiple-RHS solve (NRHS right-hand sides stored in an array with leading dimension LRHS = n)
+   void MA57Solver::solve_indefinite_system(const Vector<double>& /*matrix_values*/, const Vector<double>& rhs, Vector<double>& result,
+         size_t number_rhs) {
+      assert(this->factorization_performed);
+      assert(rhs.size() == number_rhs * static_cast<size_t>(this->workspace.n));
+
+      const int nrhs = static_cast<int>(number_rhs);
+      const int lrhs = this->workspace.n;
+      // the workspace of MA57CD should have at least n * nrhs entries
+      const int lwork = std::max(this->workspace.lwork, this->workspace.n * nrhs);
+      if (this->workspace.lwork < lwork) {
+         this->workspace.lwork = lwork;
+         this->workspace.work.resize(static_cast<size_t>(lwork));
       }
+      // copy rhs into result (overwritten by MA57)
+      result = rhs;
+      MA57_linear_solve(&this->workspace.job, &this->workspace.n, this->workspace.fact.data(), &this->workspace.lfact,
+         this->workspace.ifact.data(), &this->workspace.lifact, &nrhs, result.data(), &lrhs, this->workspace.work.data(),
+         &this->workspace.lwork, this->workspace.iwork.data(), this->workspace.icntl.data(), this->workspace.info.data());
    }
 
    Inertia MA57Solver::get_inertia() const {
@@ -245,7 +236,4 @@ namespace uno {
       return static_cast<size_t>(this->workspace.info[24]);
    }
 
-   EvaluationSpace& MA57Solver::get_evaluation_space() {
-      return this->evaluation_space;
-   }
 } // namespace
\ No newline at end of file
@@ -6,14 +6,9 @@
 
 #include <array>
 #include <vector>
-#include "ingredients/subproblem_solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
-#include "ingredients/subproblem_solvers/COOEvaluationSpace.hpp"
+#include "ingredients/subproblem_solvers/COODirectSymmetricIndefiniteLinearSolver.hpp"
 
 namespace uno {
-   // forward declarations
-   class Statistics;
-   class Subproblem;
-
    struct MA57Workspace {
       int n{};
       int nnz{};
@@ -36,24 +31,21 @@ namespace uno {
 
       const int nrhs{1}; // number of right hand side being solved
       const int job{1};
-      std::vector<double> residuals;
 
       MA57Workspace() = default;
    };
 
-   class MA57Solver : public DirectSymmetricIndefiniteLinearSolver<double> {
+   class MA57Solver : public COODirectSymmetricIndefiniteLinearSolver {
    public:
-      MA57Solver();
+      explicit MA57Solver(const Options& options);
       ~MA57Solver() override = default;
 
-      void initialize_hessian(const Subproblem& subproblem) override;
-      void initialize_augmented_system(const Subproblem& subproblem) override;
-
       void do_symbolic_analysis() override;
       void do_numerical_factorization(const double* matrix_values) override;
+      using COODirectSymmetricIndefiniteLinearSolver::solve_indefinite_system;
       void solve_indefinite_system(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result) override;
-      void solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
-         const WarmstartInformation& warmstart_information) override;
+      void solve_indefinite_system(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result,
+         size_t number_rhs) override;
 
       [[nodiscard]] Inertia get_inertia() const override;
       [[nodiscard]] size_t number_negative_eigenvalues() const override;
@@ -61,16 +53,16 @@ namespace uno {
       [[nodiscard]] bool matrix_is_singular() const override;
       [[nodiscard]] size_t rank() const override;
 
-      [[nodiscard]] EvaluationSpace& get_evaluation_space() override;
-
    private:
       MA57Workspace workspace{};
-      COOEvaluationSpace evaluation_space{};
 
       bool analysis_performed{false};
       bool factorization_performed{false};
 
-      bool use_iterative_refinement{false};
+      const bool use_nested_dissection_ordering;
+
+      void resize_workspace(size_t dimension) override;
+      [[nodiscard]] double& pivot_tolerance() override;
    };
 } // namespace
 
@@ -0,0 +1,419 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include "MINRESSolver.hpp"
+#include "ingredients/regularization_strategies/UnstableRegularization.hpp"
+#include "ingredients/subproblem/Subproblem.hpp"
+#include "ingredients/subproblem_solvers/preconditioners/Preconditioner.hpp"
+#include "ingredients/subproblem_solvers/preconditioners/PreconditionerFactory.hpp"
+#include "linear_algebra/COOMatrix.hpp"
+#include "linear_algebra/Norm.hpp"
+#include "linear_algebra/SparseVector.hpp"
+#include "optimization/Direction.hpp"
+#include "optimization/Iterate.hpp"
+#include "optimization/OptimizationProblem.hpp"
+#include "options/Options.hpp"
+#include "tools/CancellationToken.hpp"
+#include "tools/Logger.hpp"
+#include "tools/Statistics.hpp"
+#include "tools/Timer.hpp"
+
+namespace uno {
+   MINRESSolver::MINRESSolver(const Options& options): SymmetricIndefiniteLinearSolver<double>(),
+         maximum_iterations(options.get_unsigned_int("MINRES_max_iterations")),
+         tolerance(options.get_double("MINRES_tolerance")),
+         inexact_forcing(options.get_double("MINRES_inexact_forcing")),
+         curvature_threshold(options.get_double("MINRES_curvature_threshold")),
+         regularization_failure_threshold(options.get_double("regularization_failure_threshold")),
+         primal_regularization_initial_factor(options.get_double("primal_regularization_initial_factor")),
+         dual_regularization_fraction(options.get_double("dual_regularization_fraction")),
+         primal_regularization_lb(options.get_double("primal_regularization_lb")),
+         primal_regularization_decrease_factor(options.get_double("primal_regularization_decrease_factor")),
+         primal_regularization_fast_increase_factor(options.get_double("primal_regularization_fast_increase_factor")),
+         primal_regularization_slow_increase_factor(options.get_double("primal_regularization_slow_increase_factor")),
+         preconditioner(PreconditionerFactory::create(options)) {
+   }
+
+   MINRESSolver::~MINRESSolver() = default;
+
+   void MINRESSolver::initialize_statistics(Statistics& statistics, const Options& options) {
+      this->krylov_iterations_column = statistics.add_column("Krylov it", Statistics::int_width + 2, options.get_int("statistics_Krylov_iterations_column_order"));
+      this->preconditioner_time_column = statistics.add_column("precond time", Statistics::double_width - 5, options.get_int("statistics_preconditioner_time_column_order"));
+      this->regularization_column = statistics.add_column("regulariz", Statistics::double_width - 4, options.get_int("statistics_regularization_column_order"));
+   }
+
+   void MINRESSolver::initialize_hessian(const Subproblem& /*subproblem*/) {
+      throw std::runtime_error("MINRES only solves augmented systems");
+   }
+
+   void MINRESSolver::initialize_augmented_system(const Subproblem& subproblem) {
+      if (!subproblem.has_hessian_operator()) {
+         throw std::runtime_error("The subproblem does not have a Hessian operator and cannot be solved with MINRES");
+      }
+      this->evaluation_space.initialize(subproblem.problem);
+      this->resize_vectors(subproblem.number_variables, subproblem.number_constraints);
+      this->preconditioner->initialize(subproblem, this->evaluation_space);
+   }
+
+   void MINRESSolver::initialize_least_square_system(const OptimizationProblem& problem) {
+      this->evaluation_space.initialize(problem);
+      this->resize_vectors(problem.number_variables, problem.number_constraints);
+   }
+
+   void MINRESSolver::solve_indefinite_system(const Vector<double>& /*matrix_values*/, const Vector<double>& /*rhs*/,
+         Vector<double>& /*result*/) {
+      throw std::runtime_error("MINRES is matrix-free and cannot solve a system given by its matrix values");
+   }
+
+   void MINRESSolver::solve_indefinite_system(const Vector<double>& /*matrix_values*/, const Vector<double>& /*rhs*/,
+         Vector<double>& /*result*/, size_t /*number_rhs*/) {
+      throw std::runtime_error("MINRES is matrix-free and cannot solve a system given by its matrix values");
+   }
+
+   void MINRESSolver::solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
+         const WarmstartInformation& warmstart_information) {
+      this->set_up_and_solve_regularized_system(statistics, subproblem, warmstart_information);
+      // assemble the full primal-dual direction
+      subproblem.assemble_primal_dual_direction(this->solution, direction);
+      if (this->matrix_is_singular()) {
+         direction.status = SubproblemStatus::INFEASIBLE;
+      }
+   }
+
+   // matrix-free: there is no factorization to share, the systems are solved one after the other
+   void MINRESSolver::solve_indefinite_systems(Statistics& statistics, const Subproblem& subproblem,
+         const Subproblem& second_subproblem, const WarmstartInformation& warmstart_information, Vector<double>& solutions) {
+      const size_t dimension = this->solution.size();
+      solutions.resize(2 * dimension);
+      this->set_up_and_solve_regularized_system(statistics, subproblem, warmstart_information);
+      std::copy(this->solution.begin(), this->solution.end(), solutions.begin());
+      if (this->matrix_is_singular()) {
+         return;
+      }
+      // the regularization of the first system is kept
+      second_subproblem.problem.evaluate_objective_gradient(second_subproblem.current_iterate,
+         this->evaluation_space.objective_gradient.data());
+      this->assemble_rhs(second_subproblem, this->evaluation_space.constraints);
+      this->converged = this->minres([&](const Vector<double>& vector, Vector<double>& result) {
+         this->apply_augmented_matrix(second_subproblem, vector, result);
+      }, this->preconditioner.get(), this->relative_tolerance());
+      std::copy(this->solution.begin(), this->solution.end(), solutions.begin() + static_cast<std::ptrdiff_t>(dimension));
+   }
+
+   void MINRESSolver::set_up_and_solve_regularized_system(Statistics& statistics, const Subproblem& subproblem,
+         const WarmstartInformation& warmstart_information) {
+      // evaluate the functions at the current iterate
+      this->evaluation_space.evaluate_functions(subproblem.problem, subproblem.current_iterate, warmstart_information);
+      this->assemble_rhs(subproblem, this->evaluation_space.constraints);
+      this->number_krylov_iterations = 0;
+      this->preconditioner_time = 0.;
+      const Timer timer{};
+      this->preconditioner->evaluate(statistics, subproblem, this->evaluation_space);
+      this->preconditioner_setup_time = timer.get_duration();
+      this->solve_regularized_system(subproblem);
+      statistics.set(this->regularization_column, this->primal_regularization);
+      statistics.set(this->krylov_iterations_column, this->number_krylov_iterations);
+      statistics.set(this->preconditioner_time_column, this->preconditioner_time);
+      DEBUG << "MINRES: " << this->number_krylov_iterations << " iterations, preconditioner set up in " <<
+         this->preconditioner_setup_time << "s and applied in " << this->preconditioner_time << "s\n";
+   }
+
+   void MINRESSolver::solve_indefinite_system_with_corrected_constraints(const Subproblem& subproblem,
+         const std::vector<double>& corrected_constraints, Direction& direction) {
+      // the regularization of the last system is kept
+      this->assemble_rhs(subproblem, corrected_constraints);
+      this->converged = this->minres([&](const Vector<double>& vector, Vector<double>& result) {
+         this->apply_augmented_matrix(subproblem, vector, result);
+      }, this->preconditioner.get(), this->relative_tolerance());
+      subproblem.assemble_primal_dual_direction(this->solution, direction);
+   }
+
+   void MINRESSolver::solve_indefinite_system_with_new_objective_gradient(const Subproblem& subproblem, Vector<double>& solution) {
+      // the regularization of the last system is kept
+      subproblem.problem.evaluate_objective_gradient(subproblem.current_iterate, this->evaluation_space.objective_gradient.data());
+      this->assemble_rhs(subproblem, this->evaluation_space.constraints);
+      this->converged = this->minres([&](const Vector<double>& vector, Vector<double>& result) {
+         this->apply_augmented_matrix(subproblem, vector, result);
+      }, this->preconditioner.get(), this->relative_tolerance());
+      solution = this->solution;
+   }
+
+   void MINRESSolver::solve_least_square_system(const OptimizationProblem& problem, Iterate& iterate, Vector<double>& solution) {
+      // RHS [∇f - z; 0]
+      problem.evaluate_objective_gradient(iterate, this->evaluation_space.objective_gradient.data());
+      this->evaluation_space.evaluate_constraint_jacobian(problem, iterate);
+      for (size_t variable_index: Range(problem.number_variables)) {
+         this->rhs[variable_index] = this->evaluation_space.objective_gradient[variable_index] -
+            iterate.multipliers.lower_bounds[variable_index] - iterate.multipliers.upper_bounds[variable_index];
+      }
+      for (size_t constraint_index: Range(problem.number_constraints)) {
+         this->rhs[problem.number_variables + constraint_index] = 0.;
+      }
+      // matrix [I J^T; J 0] (unpreconditioned)
+      this->converged = this->minres([&](const Vector<double>& vector, Vector<double>& result) {
+         this->apply_least_square_matrix(vector, result);
+      }, nullptr, this->tolerance);
+      solution = this->solution;
+   }
+
+   bool MINRESSolver::matrix_is_singular() const {
+      return !this->converged;
+   }
+
+   EvaluationSpace& MINRESSolver::get_evaluation_space() {
+      return this->evaluation_space;
+   }
+
+   // protected member functions
+
+   void MINRESSolver::resize_vectors(size_t number_variables, size_t number_constraints) {
+      const size_t dimension = number_variables + number_constraints;
+      this->rhs.resize(dimension);
+      this->solution.resize(dimension);
+      this->primal_work.resize(number_variables);
+      this->dual_vector.resize(number_constraints);
+      this->dual_work.resize(number_constraints);
+      for (Vector<double>* vector: {&this->r1, &this->r2, &this->v, &this->y, &this->w, &this->w1, &this->w2}) {
+         vector->resize(dimension);
+      }
+   }
+
+   void MINRESSolver::assemble_rhs(const Subproblem& subproblem, const std::vector<double>& constraints) {
+      const COOMatrix jacobian{this->evaluation_space.jacobian_row_indices.data(), this->evaluation_space.jacobian_column_indices.data(),
+         this->evaluation_space.jacobian_values.data()};
+      subproblem.assemble_augmented_rhs(this->evaluation_space.objective_gradient, constraints, jacobian, this->rhs);
+   }
+
+   // inertia-free regularization: the system is solved with increasing primal regularization until the curvature test holds
+   void MINRESSolver::solve_regularized_system(const Subproblem& subproblem) {
+      this->primal_regularization = 0.;
+      this->dual_regularization = 0.;
+      const auto apply_operator = [&](const Vector<double>& vector, Vector<double>& result) {
+         this->apply_augmented_matrix(subproblem, vector, result);
+      };
+      while (true) {
+         CancellationToken::check();
+         const Timer timer{};
+         this->preconditioner->regularize(subproblem, this->evaluation_space, this->primal_regularization, this->dual_regularization);
+         this->preconditioner_setup_time += timer.get_duration();
+         this->converged = this->minres(apply_operator, this->preconditioner.get(), this->relative_tolerance());
+         this->number_krylov_iterations += this->number_iterations;
+         DEBUG << "MINRES: " << this->number_iterations << " iterations with regularization factors (" << this->primal_regularization <<
+            ", " << this->dual_regularization << ")" << (this->converged ? "" : ", not converged") << '\n';
+         if (!this->converged) {
+            // the system may be singular: activate the dual regularization
+            const double dual_regularization_parameter = this->dual_regularization_fraction * subproblem.dual_regularization_factor();
+            if (this->dual_regularization == 0. && 0 < subproblem.number_constraints && 0. < dual_regularization_parameter) {
+               this->dual_regularization = dual_regularization_parameter;
+               continue;
+            }
+            return;
+         }
+         if (this->satisfies_curvature_test(subproblem)) {
+            if (0. < this->primal_regularization) {
+               this->previous_primal_regularization = this->primal_regularization;
+            }
+            return;
+         }
+
+         // increase the primal regularization
+         if (this->primal_regularization == 0.) {
+            this->primal_regularization = (this->previous_primal_regularization == 0.) ? this->primal_regularization_initial_factor :
+               std::max(this->primal_regularization_lb, this->previous_primal_regularization / this->primal_regularization_decrease_factor);
+         }
+         else {
+            this->primal_regularization *= (this->previous_primal_regularization == 0.) ? this->primal_regularization_fast_increase_factor :
+               this->primal_regularization_slow_increase_factor;
+         }
+         if (this->regularization_failure_threshold < this->primal_regularization) {
+            throw UnstableRegularization();
+         }
+      }
+   }
+
+   // curvature test dx^T (W + Σ + δw I) dx + δc ||dy||^2 >= κ ||dx||^2. The product (W + Σ + δw I) dx is kept for the
+   // quadratic product of the direction
+   bool MINRESSolver::satisfies_curvature_test(const Subproblem& subproblem) {
+      Vector<double>& hessian_direction_product = this->evaluation_space.hessian_direction_product;
+      hessian_direction_product.fill(0.);
+      subproblem.compute_hessian_vector_product(subproblem.current_iterate.primals.data(), this->solution.data(),
+         hessian_direction_product.data());
+      for (size_t variable_index: subproblem.get_primal_regularization_variables()) {
+         hessian_direction_product[variable_index] += this->primal_regularization * this->solution[variable_index];
+      }
+      double curvature = 0.;
+      double squared_norm = 0.;
+      for (size_t variable_index: Range(subproblem.number_variables)) {
+         curvature += this->solution[variable_index] * hessian_direction_product[variable_index];
+         squared_norm += this->solution[variable_index] * this->solution[variable_index];
+      }
+      for (size_t constraint_index: subproblem.get_dual_regularization_constraints()) {
+         const double dual_component = this->solution[subproblem.number_variables + constraint_index];
+         curvature += this->dual_regularization * dual_component * dual_component;
+      }
+      DEBUG << "MINRES: curvature " << curvature << " vs " << this->curvature_threshold * squared_norm << '\n';
+      return (this->curvature_threshold * squared_norm <= curvature);
+   }
+
+   // inexact Newton: the forcing term min(η, sqrt(||rhs||)) goes to 0 as the KKT residual vanishes
+   double MINRESSolver::relative_tolerance() const {
+      if (this->inexact_forcing <= 0.) {
+         return this->tolerance;
+      }
+      return std::max(this->tolerance, std::min(this->inexact_forcing, std::sqrt(norm_inf(this->rhs))));
+   }
+
+   // product with [W + Σ + δw I, J^T; J, -δc I]
+   void MINRESSolver::apply_augmented_matrix(const Subproblem& subproblem, const Vector<double>& vector, Vector<double>& result) {
+      const size_t number_variables = subproblem.number_variables;
+      result.fill(0.);
+      // primal rows
+      subproblem.compute_hessian_vector_product(subproblem.current_iterate.primals.data(), vector.data(), result.data());
+      if (0. < this->primal_regularization) {
+         for (size_t variable_index: subproblem.get_primal_regularization_variables()) {
+            result[variable_index] += this->primal_regularization * vector[variable_index];
+         }
+      }
+      for (size_t constraint_index: Range(subproblem.number_constraints)) {
+         this->dual_vector[constraint_index] = vector[number_variables + constraint_index];
+      }
+      this->evaluation_space.compute_constraint_jacobian_transposed_vector_product(this->dual_vector, this->primal_work);
+      for (size_t variable_index: Range(number_variables)) {
+         result[variable_index] += this->primal_work[variable_index];
+      }
+      // dual rows
+      this->evaluation_space.compute_constraint_jacobian_vector_product(vector, this->dual_work);
+      for (size_t constraint_index: Range(subproblem.number_constraints)) {
+         result[number_variables + constraint_index] = this->dual_work[constraint_index];
+      }
+      if (0. < this->dual_regularization) {
+         for (size_t constraint_index: subproblem.get_dual_regularization_constraints()) {
+            result[number_variables + constraint_index] -= this->dual_regularization * vector[number_variables + constraint_index];
+         }
+      }
+   }
+
+   // product with [I J^T; J 0]
+   void MINRESSolver::apply_least_square_matrix(const Vector<double>& vector, Vector<double>& result) {
+      const size_t number_variables = this->primal_work.size();
+      const size_t number_constraints = this->dual_work.size();
+      for (size_t constraint_index: Range(number_constraints)) {
+         this->dual_vector[constraint_index] = vector[number_variables + constraint_index];
+      }
+      this->evaluation_space.compute_constraint_jacobian_transposed_vector_product(this->dual_vector, this->primal_work);
+      for (size_t variable_index: Range(number_variables)) {
+         result[variable_index] = vector[variable_index] + this->primal_work[variable_index];
+      }
+      this->evaluation_space.compute_constraint_jacobian_vector_product(vector, this->dual_work);
+      for (size_t constraint_index: Range(number_constraints)) {
+         result[number_variables + constraint_index] = this->dual_work[constraint_index];
+      }
+   }
+
+   // preconditioned MINRES (Paige and Saunders, 1975) on the system with RHS this->rhs, starting from 0. The preconditioner
+   // (identity if null) must be positive definite. Returns true if the preconditioned residual was reduced by the relative tolerance
+   template <typename Operator>
+   bool MINRESSolver::minres(const Operator& apply_operator, Preconditioner* krylov_preconditioner, double relative_tolerance) {
+      const auto apply_preconditioner = [&](const Vector<double>& vector, Vector<double>& result) {
+         if (krylov_preconditioner == nullptr) {
+            result = vector;
+            return;
+         }
+         const Timer timer{};
+         krylov_preconditioner->apply(vector, result);
+         this->preconditioner_time += timer.get_duration();
+      };
+
+      this->solution.fill(0.);
+      this->number_iterations = 0;
+      this->r1 = this->rhs;
+      apply_preconditioner(this->r1, this->y);
+      double beta1 = dot(this->r1, this->y);
+      if (beta1 < 0.) {
+         WARNING << "MINRES: the preconditioner is not positive definite\n";
+         return false;
+      }
+      if (beta1 == 0.) {
+         return true;
+      }
+      beta1 = std::sqrt(beta1);
+      this->r2 = this->r1;
+      this->w.fill(0.);
+      this->w2.fill(0.);
+      if (krylov_preconditioner != nullptr) {
+         krylov_preconditioner->start_krylov_process();
+      }
+
+      double old_beta = 0., beta = beta1, dbar = 0., epsilon = 0., phibar = beta1, cs = -1., sn = 0.;
+      const double target_residual = relative_tolerance * beta1;
+      bool has_converged = false;
+      while (this->number_iterations < this->maximum_iterations) {
+         CancellationToken::check();
+         // Lanczos step
+         for (size_t index: Range(this->v.size())) {
+            this->v[index] = this->y[index] / beta;
+         }
+         apply_operator(this->v, this->y);
+         if (0 < this->number_iterations) {
+            for (size_t index: Range(this->y.size())) {
+               this->y[index] -= (beta / old_beta) * this->r1[index];
+            }
+         }
+         const double alpha = dot(this->v, this->y);
+         for (size_t index: Range(this->y.size())) {
+            this->y[index] -= (alpha / beta) * this->r2[index];
+         }
+         std::swap(this->r1, this->r2);
+         this->r2 = this->y;
+         apply_preconditioner(this->r2, this->y);
+         old_beta = beta;
+         beta = dot(this->r2, this->y);
+         if (beta < 0.) {
+            WARNING << "MINRES: the preconditioner is not positive definite\n";
+            break;
+         }
+         beta = std::sqrt(beta);
+         if (krylov_preconditioner != nullptr) {
+            krylov_preconditioner->record_lanczos_step(this->v, alpha, beta);
+         }
+
+         // QR factorization of the tridiagonal matrix (Givens rotations)
+         const double old_epsilon = epsilon;
+         const double delta = cs * dbar + sn * alpha;
+         const double gbar = sn * dbar - cs * alpha;
+         epsilon = sn * beta;
+         dbar = -cs * beta;
+         const double gamma = std::max(std::hypot(gbar, beta), std::numeric_limits<double>::epsilon());
+         cs = gbar / gamma;
+         sn = beta / gamma;
+         const double phi = cs * phibar;
+         phibar *= sn;
+
+         // update the solution
+         std::swap(this->w1, this->w2);
+         std::swap(this->w2, this->w);
+         for (size_t index: Range(this->w.size())) {
+            this->w[index] = (this->v[index] - old_epsilon * this->w1[index] - delta * this->w2[index]) / gamma;
+            this->solution[index] += phi * this->w[index];
+         }
+         ++this->number_iterations;
+         if (phibar <= target_residual) {
+            has_converged = true;
+            break;
+         }
+         // invariant Krylov subspace: the system is inconsistent
+         if (beta == 0.) {
+            break;
+         }
+      }
+      if (krylov_preconditioner != nullptr) {
+         krylov_preconditioner->end_krylov_process();
+      }
+      return has_converged;
+   }
+} // namespace
@@ -0,0 +1,106 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_MINRESSOLVER_H
+#define UNO_MINRESSOLVER_H
+
+#include <memory>
+#include <vector>
+#include "ingredients/subproblem_solvers/SymmetricIndefiniteLinearSolver.hpp"
+#include "ingredients/subproblem_solvers/OperatorEvaluationSpace.hpp"
+#include "linear_algebra/Vector.hpp"
+
+namespace uno {
+   // forward declarations
+   class Options;
+   class Preconditioner;
+
+   // matrix-free solver of the augmented system [W + Σ + δw I, J^T; J, -δc I] with the minimal residual method (MINRES).
+   // Only Hessian-vector products and Jacobian products are used, so the Hessian does not need to be formed.
+   // The inertia is not available: the primal regularization δw is increased until the solution satisfies the inertia-free
+   // curvature test dx^T (W + Σ + δw I) dx + δc ||dy||^2 >= κ ||dx||^2 (Chiang and Zavala, 2016). The dual regularization
+   // δc is activated when MINRES fails to converge (singular or ill-conditioned system).
+   // The Krylov iterations stop when the preconditioned residual is reduced by a relative factor that is either fixed
+   // or given by a forcing sequence that tightens as the RHS (the KKT residual) goes to 0 (inexact Newton steps).
+   // The preconditioner is selected with the option MINRES_preconditioner
+   class MINRESSolver: public SymmetricIndefiniteLinearSolver<double> {
+   public:
+      explicit MINRESSolver(const Options& options);
+      ~MINRESSolver() override;
+
+      void initialize_statistics(Statistics& statistics, const Options& options) override;
+
+      void initialize_hessian(const Subproblem& subproblem) override;
+      void initialize_augmented_system(const Subproblem& subproblem) override;
+      void initialize_least_square_system(const OptimizationProblem& problem) override;
+
+      void solve_indefinite_system(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result) override;
+      void solve_indefinite_system(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result,
+         size_t number_rhs) override;
+      void solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
+         const WarmstartInformation& warmstart_information) override;
+      void solve_indefinite_systems(Statistics& statistics, const Subproblem& subproblem, const Subproblem& second_subproblem,
+         const WarmstartInformation& warmstart_information, Vector<double>& solutions) override;
+      void solve_indefinite_system_with_corrected_constraints(const Subproblem& subproblem,
+         const std::vector<double>& corrected_constraints, Direction& direction) override;
+      void solve_indefinite_system_with_new_objective_gradient(const Subproblem& subproblem, Vector<double>& solution) override;
+      void solve_least_square_system(const OptimizationProblem& problem, Iterate& iterate, Vector<double>& solution) override;
+
+      // the last system could not be solved to the required accuracy, even with dual regularization
+      [[nodiscard]] bool matrix_is_singular() const override;
+
+      [[nodiscard]] EvaluationSpace& get_evaluation_space() override;
+
+   protected:
+      OperatorEvaluationSpace evaluation_space{};
+      const size_t maximum_iterations;
+      const double tolerance;
+      const double inexact_forcing;
+      const double curvature_threshold;
+      // regularization (same parameters as the inertia-based regularization of the direct solvers)
+      const double regularization_failure_threshold;
+      const double primal_regularization_initial_factor;
+      const double dual_regularization_fraction;
+      const double primal_regularization_lb;
+      const double primal_regularization_decrease_factor;
+      const double primal_regularization_fast_increase_factor;
+      const double primal_regularization_slow_increase_factor;
+      double primal_regularization{0.};
+      double previous_primal_regularization{0.};
+      double dual_regularization{0.};
+      const std::unique_ptr<Preconditioner> preconditioner;
+      bool converged{true};
+      size_t number_iterations{0};
+      // statistics of the last solve (all regularization attempts)
+      size_t number_krylov_iterations{0};
+      double preconditioner_setup_time{0.};
+      double preconditioner_time{0.};
+      // handles of the statistics columns
+      size_t krylov_iterations_column{};
+      size_t preconditioner_time_column{};
+      size_t regularization_column{};
+
+      Vector<double> rhs{};
+      Vector<double> solution{};
+      // work vectors of the operator
+      Vector<double> primal_work{};
+      Vector<double> dual_vector{};
+      Vector<double> dual_work{};
+      // vectors of the Lanczos process
+      Vector<double> r1{}, r2{}, v{}, y{}, w{}, w1{}, w2{};
+
+      void resize_vectors(size_t number_variables, size_t number_constraints);
+      void assemble_rhs(const Subproblem& subproblem, const std::vector<double>& constraints);
+      void set_up_and_solve_regularized_system(Statistics& statistics, const Subproblem& subproblem,
+         const WarmstartInformation& warmstart_information);
+      void solve_regularized_system(const Subproblem& subproblem);
+      [[nodiscard]] bool satisfies_curvature_test(const Subproblem& subproblem);
+      [[nodiscard]] double relative_tolerance() const;
+      void apply_augmented_matrix(const Subproblem& subproblem, const Vector<double>& vector, Vector<double>& result);
+      void apply_least_square_matrix(const Vector<double>& vector, Vector<double>& result);
+      template <typename Operator>
+      bool minres(const Operator& apply_operator, Preconditioner* krylov_preconditioner, double relative_tolerance);
+   };
+} // namespace
+
+#endif // UNO_MINRESSOLVER_H
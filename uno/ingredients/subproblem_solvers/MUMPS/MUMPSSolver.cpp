@@ -1,9 +1,9 @@
 // Copyright (c) 2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <algorithm>
 #include "MUMPSSolver.hpp"
-#include "ingredients/subproblem/Subproblem.hpp"
-#include "optimization/Direction.hpp"
+#include "tools/Logger.hpp"
 #if defined(HAS_MPI) && defined(MUMPS_PARALLEL)
 #include "mpi.h"
 #endif
@@ -11,7 +11,7 @@
 #define USE_COMM_WORLD (-987654)
 
 namespace uno {
-   MUMPSSolver::MUMPSSolver(): DirectSymmetricIndefiniteLinearSolver() {
+   MUMPSSolver::MUMPSSolver(const Options& options): COODirectSymmetricIndefiniteLinearSolver("MUMPS", options) {
       this->workspace.sym = MUMPSSolver::GENERAL_SYMMETRIC;
 #if defined(HAS_MPI) && defined(MUMPS_PARALLEL)
       // TODO load number of processes from option file
@@ -46,20 +46,7 @@ namespace uno {
       dmumps_c(&this->workspace);
    }
 
-   void MUMPSSolver::initialize_hessian(const Subproblem& subproblem) {
-      this->evaluation_space.initialize_hessian(subproblem);
-
-      // workspace*
-      const size_t dimension = subproblem.number_variables;
-      this->workspace.n = static_cast<int>(dimension);
-      this->workspace.nnz = static_cast<int>(this->evaluation_space.number_matrix_nonzeros);
-   }
-
-   void MUMPSSolver::initialize_augmented_system(const Subproblem& subproblem) {
-      this->evaluation_space.initialize_augmented_system(subproblem);
-
-      // workspace
-      const size_t dimension = subproblem.number_variables + subproblem.number_constraints;
+   void MUMPSSolver::resize_workspace(size_t dimension) {
       this->workspace.n = static_cast<int>(dimension);
       this->workspace.nnz = static_cast<int>(this->evaluation_space.number_matrix_nonzeros);
    }
@@ -85,6 +72,11 @@ namespace uno {
       this->factorization_performed = true;
    }
 
+   // relative pivot tolerance CNTL(1)
+   double& MUMPSSolver::pivot_tolerance() {
+      return this->workspace.cntl[0];
+   }
+
    void MUMPSSolver::solve_indefinite_system(const Vector<double>& /*matrix_values*/, const Vector<double>& rhs, Vector<double>& result) {
       assert(this->factorization_performed);
 
@@ -94,17 +86,20 @@ namespace uno {
       dmumps_c(&this->workspace);
    }
 
-   void MUMPSSolver::solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
-         const WarmstartInformation& warmstart_information) {
-      // set up the linear system by evaluating the functions at the current iterate
-      this->evaluation_space.set_up_linear_system(statistics, subproblem, *this, warmstart_information);
-      // solve the linear system
-      this->solve_indefinite_system(this->evaluation_space.matrix_values, this->evaluation_space.rhs, this->evaluation_space.solution);
-      // assemble the full primal-dual direction
-      subproblem.assemble_primal_dual_direction(this->evaluation_space.solution, direction);
-      if (this->matrix_is_singular()) {
-         direction.status = SubproblemStatus::INFEASIBLE;
-      }
+   // native multiple-RHS solve (NRHS dense right-hand sides with leading dimension LRHS = n)
+   void MUMPSSolver::solve_indefinite_system(const Vector<double>& /*matrix_values*/, const Vector<double>& rhs, Vector<double>& result,
+         size_t number_rhs) {
+      assert(this->factorization_performed);
+      assert(rhs.size() == number_rhs * static_cast<size_t>(this->workspace.n));
+
+      result = rhs;
+      this->workspace.rhs = result.data();
+      this->workspace.nrhs = static_cast<int>(number_rhs);
+      this->workspace.lrhs = this->workspace.n;
+      this->workspace.job = MUMPSSolver::JOB_SOLVE;
+      dmumps_c(&this->workspace);
+      // restore the single-RHS setting
+      this->workspace.nrhs = 1;
    }
 
    Inertia MUMPSSolver::get_inertia() const {
@@ -134,7 +129,4 @@ namespace uno {
       return this->workspace.n - this->number_zero_eigenvalues();
    }
 
-   EvaluationSpace& MUMPSSolver::get_evaluation_space() {
-      return this->evaluation_space;
-   }
 } // namespace
\ No newline at end of file
@@ -4,25 +4,22 @@
 #ifndef UNO_MUMPSSOLVER_H
 #define UNO_MUMPSSOLVER_H
 
-#include "../DirectSymmetricIndefiniteLinearSolver.hpp"
+#include "../COODirectSymmetricIndefiniteLinearSolver.hpp"
 #include "dmumps_c.h"
-#include "../COOEvaluationSpace.hpp"
 #include "linear_algebra/Vector.hpp"
 
 namespace uno {
-   class MUMPSSolver : public DirectSymmetricIndefiniteLinearSolver<double> {
+   class MUMPSSolver : public COODirectSymmetricIndefiniteLinearSolver {
    public:
-      MUMPSSolver();
+      explicit MUMPSSolver(const Options& options);
       ~MUMPSSolver() override;
 
-      void initialize_hessian(const Subproblem& subproblem) override;
-      void initialize_augmented_system(const Subproblem& subproblem) override;
-
       void do_symbolic_analysis() override;
       void do_numerical_factorization(const double* matrix_values) override;
+      using COODirectSymmetricIndefiniteLinearSolver::solve_indefinite_system;
       void solve_indefinite_system(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result) override;
-      void solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
-         const WarmstartInformation& warmstart_information) override;
+      void solve_indefinite_system(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result,
+         size_t number_rhs) override;
 
       [[nodiscard]] Inertia get_inertia() const override;
       [[nodiscard]] size_t number_negative_eigenvalues() const override;
@@ -31,11 +28,8 @@ namespace uno {
       [[nodiscard]] bool matrix_is_singular() const override;
       [[nodiscard]] size_t rank() const override;
 
-      [[nodiscard]] EvaluationSpace& get_evaluation_space() override;
-
    protected:
       DMUMPS_STRUC_C workspace{};
-      COOEvaluationSpace evaluation_space{};
 
       static const int JOB_INIT = -1;
       static const int JOB_END = -2;
@@ -47,6 +41,9 @@ namespace uno {
 
       bool analysis_performed{false};
       bool factorization_performed{false};
+
+      void resize_workspace(size_t dimension) override;
+      [[nodiscard]] double& pivot_tolerance() override;
    };
 } // namespace
 
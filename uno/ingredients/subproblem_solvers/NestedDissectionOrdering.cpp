@@ -0,0 +1,145 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include "NestedDissectionOrdering.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Logger.hpp"
+
+#ifdef HAS_METIS
+#include "metis.h"
+#endif
+
+namespace uno {
+#ifdef HAS_METIS
+   const bool NestedDissectionOrdering::is_available = true;
+#else
+   const bool NestedDissectionOrdering::is_available = false;
+#endif
+
+   std::unordered_map<size_t, NestedDissectionOrdering::CachedOrdering> NestedDissectionOrdering::cache{};
+   std::mutex NestedDissectionOrdering::cache_mutex{};
+
+   void NestedDissectionOrdering::compute_pivot_positions(size_t dimension, size_t number_nonzeros, const int* row_indices,
+         const int* column_indices, int* pivot_positions) {
+      const size_t pattern_hash = NestedDissectionOrdering::hash_pattern(dimension, number_nonzeros, row_indices, column_indices);
+      {
+         const std::lock_guard<std::mutex> lock(NestedDissectionOrdering::cache_mutex);
+         const auto cached_ordering = NestedDissectionOrdering::cache.find(pattern_hash);
+         if (cached_ordering != NestedDissectionOrdering::cache.end() &&
+               cached_ordering->second.has_pattern(dimension, number_nonzeros, row_indices, column_indices)) {
+            DEBUG << "Nested dissection ordering retrieved from the cache\n";
+            std::copy(cached_ordering->second.pivot_positions.begin(), cached_ordering->second.pivot_positions.end(), pivot_positions);
+            return;
+         }
+      }
+
+      // the ordering is computed outside the critical section
+      std::vector<int> new_pivot_positions(dimension);
+      NestedDissectionOrdering::compute_nested_dissection(dimension, number_nonzeros, row_indices, column_indices, new_pivot_positions);
+      std::copy(new_pivot_positions.begin(), new_pivot_positions.end(), pivot_positions);
+
+      const std::lock_guard<std::mutex> lock(NestedDissectionOrdering::cache_mutex);
+      if (NestedDissectionOrdering::maximum_cache_size <= NestedDissectionOrdering::cache.size()) {
+         NestedDissectionOrdering::cache.clear();
+      }
+      NestedDissectionOrdering::cache[pattern_hash] = {dimension, std::vector<int>(row_indices, row_indices + number_nonzeros),
+         std::vector<int>(column_indices, column_indices + number_nonzeros), std::move(new_pivot_positions)};
+   }
+
+   bool NestedDissectionOrdering::CachedOrdering::has_pattern(size_t dimension, size_t number_nonzeros, const int* row_indices,
+         const int* column_indices) const {
+      return this->dimension == dimension && this->row_indices.size() == number_nonzeros &&
+         std::equal(this->row_indices.begin(), this->row_indices.end(), row_indices) &&
+         std::equal(this->column_indices.begin(), this->column_indices.end(), column_indices);
+   }
+
+   // FNV-1a hash of the dimension and the COO pattern
+   size_t NestedDissectionOrdering::hash_pattern(size_t dimension, size_t number_nonzeros, const int* row_indices,
+         const int* column_indices) {
+      uint64_t hash = 14695981039346656037ULL;
+      const auto combine = [&](uint64_t value) {
+         hash ^= value;
+         hash *= 1099511628211ULL;
+      };
+      combine(dimension);
+      combine(number_nonzeros);
+      for (size_t nonzero_index: Range(number_nonzeros)) {
+         combine(static_cast<uint64_t>(row_indices[nonzero_index]));
+         combine(static_cast<uint64_t>(column_indices[nonzero_index]));
+      }
+      return static_cast<size_t>(hash);
+   }
+
+#ifdef HAS_METIS
+   void NestedDissectionOrdering::compute_nested_dissection(size_t dimension, size_t number_nonzeros, const int* row_indices,
+         const int* column_indices, std::vector<int>& pivot_positions) {
+      // adjacency graph of the matrix in CSR format (both triangles, without the diagonal)
+      std::vector<idx_t> adjacency_pointers(dimension + 1, 0);
+      for (size_t nonzero_index: Range(number_nonzeros)) {
+         const int row_index = row_indices[nonzero_index] - 1;
+         const int column_index = column_indices[nonzero_index] - 1;
+         if (row_index != column_index) {
+            ++adjacency_pointers[static_cast<size_t>(row_index) + 1];
+            ++adjacency_pointers[static_cast<size_t>(column_index) + 1];
+         }
+      }
+      for (size_t vertex_index: Range(dimension)) {
+         adjacency_pointers[vertex_index + 1] += adjacency_pointers[vertex_index];
+      }
+      // trivial ordering for a diagonal matrix
+      if (adjacency_pointers[dimension] == 0) {
+         for (size_t vertex_index: Range(dimension)) {
+            pivot_positions[vertex_index] = static_cast<int>(vertex_index) + 1;
+         }
+         return;
+      }
+      std::vector<idx_t> adjacency(static_cast<size_t>(adjacency_pointers[dimension]));
+      std::vector<idx_t> current_position(adjacency_pointers.begin(), adjacency_pointers.end() - 1);
+      for (size_t nonzero_index: Range(number_nonzeros)) {
+         const auto row_index = static_cast<size_t>(row_indices[nonzero_index] - 1);
+         const auto column_index = static_cast<size_t>(column_indices[nonzero_index] - 1);
+         if (row_index != column_index) {
+            adjacency[static_cast<size_t>(current_position[row_index]++)] = static_cast<idx_t>(column_index);
+            adjacency[static_cast<size_t>(current_position[column_index]++)] = static_cast<idx_t>(row_index);
+         }
+      }
+      // remove the duplicate edges and compress the graph in place
+      idx_t compressed_position = 0;
+      idx_t start = adjacency_pointers[0];
+      for (size_t vertex_index: Range(dimension)) {
+         const idx_t end = adjacency_pointers[vertex_index + 1];
+         std::sort(adjacency.begin() + start, adjacency.begin() + end);
+         const auto unique_end = std::unique(adjacency.begin() + start, adjacency.begin() + end);
+         for (auto neighbor = adjacency.begin() + start; neighbor != unique_end; ++neighbor) {
+            adjacency[static_cast<size_t>(compressed_position++)] = *neighbor;
+         }
+         start = end;
+         adjacency_pointers[vertex_index + 1] = compressed_position;
+      }
+
+      // nested dissection
+      idx_t number_vertices = static_cast<idx_t>(dimension);
+      std::vector<idx_t> options(METIS_NOPTIONS);
+      METIS_SetDefaultOptions(options.data());
+      std::vector<idx_t> permutation(dimension), inverse_permutation(dimension);
+      const int status = METIS_NodeND(&number_vertices, adjacency_pointers.data(), adjacency.data(), nullptr, options.data(),
+         permutation.data(), inverse_permutation.data());
+      if (status != METIS_OK) {
+         throw std::runtime_error("METIS failed to compute the nested dissection ordering");
+      }
+      // the i-th variable is in position inverse_permutation[i] of the pivot order
+      for (size_t vertex_index: Range(dimension)) {
+         pivot_positions[vertex_index] = static_cast<int>(inverse_permutation[vertex_index]) + 1;
+      }
+   }
+#else
+   void NestedDissectionOrdering::compute_nested_dissection(size_t /*dimension*/, size_t /*number_nonzeros*/, const int* /*row_indices*/,
+         const int* /*column_indices*/, std::vector<int>& /*pivot_positions*/) {
+      throw std::runtime_error("The nested dissection ordering requires METIS. Recompile Uno with METIS");
+   }
+#endif
+} // namespace
@@ -0,0 +1,46 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_NESTEDDISSECTIONORDERING_H
+#define UNO_NESTEDDISSECTIONORDERING_H
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace uno {
+   // fill-reducing pivot order of a sparse symmetric matrix computed by METIS nested dissection. The orderings are cached
+   // by sparsity pattern (shared by all the linear solvers), so that repeated solves of problems with the same pattern
+   // skip the ordering stage
+   class NestedDissectionOrdering {
+   public:
+      // whether Uno was linked with METIS
+      static const bool is_available;
+
+      // compute the position of each of the "dimension" variables in the pivot order (Fortran indexing) from the COO pattern
+      // of a triangle of the matrix (Fortran indexing). The diagonal and duplicate entries are ignored
+      static void compute_pivot_positions(size_t dimension, size_t number_nonzeros, const int* row_indices, const int* column_indices,
+         int* pivot_positions);
+
+   protected:
+      // the pattern is stored to rule out hash collisions
+      struct CachedOrdering {
+         size_t dimension;
+         std::vector<int> row_indices;
+         std::vector<int> column_indices;
+         std::vector<int> pivot_positions;
+
+         [[nodiscard]] bool has_pattern(size_t dimension, size_t number_nonzeros, const int* row_indices, const int* column_indices) const;
+      };
+      static constexpr size_t maximum_cache_size{16};
+      static std::unordered_map<size_t, CachedOrdering> cache;
+      static std::mutex cache_mutex;
+
+      [[nodiscard]] static size_t hash_pattern(size_t dimension, size_t number_nonzeros, const int* row_indices, const int* column_indices);
+      static void compute_nested_dissection(size_t dimension, size_t number_nonzeros, const int* row_indices, const int* column_indices,
+         std::vector<int>& pivot_positions);
+   };
+} // namespace
+
+#endif // UNO_NESTEDDISSECTIONORDERING_H
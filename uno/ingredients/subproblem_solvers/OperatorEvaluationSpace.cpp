@@ -0,0 +1,79 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include "OperatorEvaluationSpace.hpp"
+#include "linear_algebra/Indexing.hpp"
+#include "linear_algebra/MatrixOrder.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "optimization/OptimizationProblem.hpp"
+#include "optimization/WarmstartInformation.hpp"
+#include "symbolic/Range.hpp"
+
+namespace uno {
+   void OperatorEvaluationSpace::initialize(const OptimizationProblem& problem) {
+      this->objective_gradient.resize(problem.number_variables);
+      this->constraints.resize(problem.number_constraints);
+
+      // Jacobian
+      const size_t number_jacobian_nonzeros = problem.number_jacobian_nonzeros();
+      this->jacobian_row_indices.resize(number_jacobian_nonzeros);
+      this->jacobian_column_indices.resize(number_jacobian_nonzeros);
+      this->jacobian_values.resize(number_jacobian_nonzeros);
+      problem.compute_constraint_jacobian_sparsity(this->jacobian_row_indices.data(), this->jacobian_column_indices.data(),
+         Indexing::C_indexing, MatrixOrder::COLUMN_MAJOR);
+
+      this->hessian_direction_product.resize(problem.number_variables);
+   }
+
+   void OperatorEvaluationSpace::evaluate_constraint_jacobian(const OptimizationProblem& problem, Iterate& iterate) {
+      problem.evaluate_constraint_jacobian(iterate, this->jacobian_values.data());
+   }
+
+   void OperatorEvaluationSpace::compute_constraint_jacobian_vector_product(const Vector<double>& vector, Vector<double>& result) const {
+      result.fill(0.);
+      for (size_t nonzero_index: Range(this->jacobian_values.size())) {
+         const size_t constraint_index = static_cast<size_t>(this->jacobian_row_indices[nonzero_index]);
+         const size_t variable_index = static_cast<size_t>(this->jacobian_column_indices[nonzero_index]);
+         const double derivative = this->jacobian_values[nonzero_index];
+
+         // a safeguard to make sure we take only the correct part of the Jacobian
+         if (constraint_index < result.size() && variable_index < vector.size()) {
+            result[constraint_index] += derivative * vector[variable_index];
+         }
+      }
+   }
+
+   void OperatorEvaluationSpace::compute_constraint_jacobian_transposed_vector_product(const Vector<double>& vector,
+         Vector<double>& result) const {
+      result.fill(0.);
+      for (size_t nonzero_index: Range(this->jacobian_values.size())) {
+         const size_t constraint_index = static_cast<size_t>(this->jacobian_row_indices[nonzero_index]);
+         const size_t variable_index = static_cast<size_t>(this->jacobian_column_indices[nonzero_index]);
+         const double derivative = this->jacobian_values[nonzero_index];
+
+         if (variable_index < result.size() && constraint_index < vector.size()) {
+            result[variable_index] += derivative * vector[constraint_index];
+         }
+      }
+   }
+
+   double OperatorEvaluationSpace::compute_hessian_quadratic_product(const Vector<double>& vector) const {
+      double quadratic_product = 0.;
+      for (size_t variable_index: Range(std::min(vector.size(), this->hessian_direction_product.size()))) {
+         quadratic_product += vector[variable_index] * this->hessian_direction_product[variable_index];
+      }
+      return quadratic_product;
+   }
+
+   void OperatorEvaluationSpace::evaluate_functions(const OptimizationProblem& problem, Iterate& current_iterate,
+         const WarmstartInformation& warmstart_information) {
+      if (warmstart_information.objective_changed) {
+         problem.evaluate_objective_gradient(current_iterate, this->objective_gradient.data());
+      }
+      if (warmstart_information.constraints_changed) {
+         problem.evaluate_constraints(current_iterate, this->constraints);
+         this->evaluate_constraint_jacobian(problem, current_iterate);
+      }
+   }
+} // namespace
@@ -0,0 +1,45 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_OPERATOREVALUATIONSPACE_H
+#define UNO_OPERATOREVALUATIONSPACE_H
+
+#include <cstddef>
+#include <vector>
+#include "linear_algebra/Vector.hpp"
+#include "optimization/EvaluationSpace.hpp"
+
+namespace uno {
+   // forward declaration
+   class WarmstartInformation;
+
+   // matrix-free evaluation space: the Jacobian is stored in COO format, the Hessian is only available through
+   // Hessian-vector products
+   class OperatorEvaluationSpace: public EvaluationSpace {
+   public:
+      OperatorEvaluationSpace() = default;
+      ~OperatorEvaluationSpace() override = default;
+
+      void initialize(const OptimizationProblem& problem);
+
+      void evaluate_constraint_jacobian(const OptimizationProblem& problem, Iterate& iterate) override;
+      void compute_constraint_jacobian_vector_product(const Vector<double>& vector, Vector<double>& result) const override;
+      void compute_constraint_jacobian_transposed_vector_product(const Vector<double>& vector,
+         Vector<double>& result) const override;
+      // the Hessian is not stored: the quadratic product is only available for the direction computed by the last solve
+      [[nodiscard]] double compute_hessian_quadratic_product(const Vector<double>& vector) const override;
+
+      void evaluate_functions(const OptimizationProblem& problem, Iterate& current_iterate, const WarmstartInformation& warmstart_information);
+
+      Vector<double> objective_gradient{};
+      std::vector<double> constraints{};
+      // COO constraint Jacobian
+      std::vector<int> jacobian_row_indices{};
+      std::vector<int> jacobian_column_indices{};
+      Vector<double> jacobian_values{};
+      // Hessian-vector product with the last direction
+      Vector<double> hessian_direction_product{};
+   };
+} // namespace
+
+#endif // UNO_OPERATOREVALUATIONSPACE_H
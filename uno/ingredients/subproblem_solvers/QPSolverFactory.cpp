@@ -4,6 +4,7 @@
 #include <stdexcept>
 #include "QPSolverFactory.hpp"
 #include "QPSolver.hpp"
+#include "ingredients/subproblem_solvers/TruncatedCG/TruncatedCGSolver.hpp"
 #include "linear_algebra/Vector.hpp"
 #include "options/Options.hpp"
 
@@ -28,14 +29,19 @@ namespace uno {
             return std::make_unique<HiGHSSolver>(options);
          }
 #endif
+         if (QP_solver_name == "TruncatedCG") {
+            return std::make_unique<TruncatedCGSolver>(options);
+         }
          std::string message = "The QP solver ";
          message.append(QP_solver_name).append(" is unknown").append("\n").append("The following values are available: ")
-            .append(join(QPSolverFactory::available_solvers, ", "));
+            .append(join(QPSolverFactory::available_solvers, ", ")).append(" (matrix-free: ")
+            .append(join(QPSolverFactory::matrix_free_solvers, ", ")).append(")");
          throw std::invalid_argument(message);
       }
       catch (const std::out_of_range& exception) {
          std::string message = exception.what();
-         message.append("\n").append("The following values are available: ").append(join(QPSolverFactory::available_solvers, ", "));
+         message.append("\n").append("The following values are available: ").append(join(QPSolverFactory::available_solvers, ", "))
+            .append(" (matrix-free: ").append(join(QPSolverFactory::matrix_free_solvers, ", ")).append(")");
          throw std::out_of_range(message);
       }
    }
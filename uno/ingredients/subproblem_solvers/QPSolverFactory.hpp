@@ -26,6 +26,9 @@ namespace uno {
          "HiGHS",
 #endif
       };
+
+      // list of matrix-free QP solvers (always available, but never selected by default)
+      constexpr static std::initializer_list<const char*> matrix_free_solvers{"TruncatedCG"};
    };
 } // namespace
 
@@ -5,11 +5,15 @@
 #define UNO_SYMMETRICINDEFINITELINEARSOLVER_H
 
 #include <cstddef>
+#include <vector>
 
 namespace uno {
    // forward declarations
    class Direction;
    class EvaluationSpace;
+   class Iterate;
+   class OptimizationProblem;
+   class Options;
    class Statistics;
    class Subproblem;
    template <typename ElementType>
@@ -22,13 +26,37 @@ namespace uno {
       SymmetricIndefiniteLinearSolver() = default;
       virtual ~SymmetricIndefiniteLinearSolver() = default;
 
+      // columns of the statistics table specific to the solver (none by default)
+      virtual void initialize_statistics(Statistics& /*statistics*/, const Options& /*options*/) { }
       virtual void initialize_hessian(const Subproblem& subproblem) = 0;
       virtual void initialize_augmented_system(const Subproblem& subproblem) = 0;
+      virtual void initialize_least_square_system(const OptimizationProblem& problem) = 0;
 
       virtual void solve_indefinite_system(const Vector<double>& matrix_values, const Vector<ElementType>& rhs,
          Vector<ElementType>& result) = 0;
+      // solve the system for several right-hand sides with the same factorization. The right-hand sides and the solutions
+      // are stored contiguously (column after column)
+      virtual void solve_indefinite_system(const Vector<double>& matrix_values, const Vector<ElementType>& rhs,
+         Vector<ElementType>& result, size_t number_rhs) = 0;
       virtual void solve_indefinite_system(Statistics& statistics, const Subproblem& subproblem, Direction& direction,
          const WarmstartInformation& warmstart_information) = 0;
+      // probing: assemble and factorize the system of the subproblem (as above), then solve it at once for the RHS of the
+      // subproblem and of a second subproblem that differs only by its objective gradient. The (unscaled) solutions are
+      // stored contiguously
+      virtual void solve_indefinite_systems(Statistics& statistics, const Subproblem& subproblem, const Subproblem& second_subproblem,
+         const WarmstartInformation& warmstart_information, Vector<ElementType>& solutions) = 0;
+      // second-order correction: solve the system with the current factorization and corrected constraint values in the RHS
+      virtual void solve_indefinite_system_with_corrected_constraints(const Subproblem& subproblem,
+         const std::vector<double>& corrected_constraints, Direction& direction) = 0;
+      // predictor-corrector: solve the system with the current factorization and the reevaluated objective gradient of
+      // the subproblem in the RHS. The (unscaled) solution of the linear system is returned
+      virtual void solve_indefinite_system_with_new_objective_gradient(const Subproblem& subproblem,
+         Vector<ElementType>& solution) = 0;
+      // least-square multiplier estimate: factorize [I J^T; J 0] at the iterate and solve the system with the RHS [∇f - z; 0].
+      // The (unscaled) solution of the linear system is returned
+      virtual void solve_least_square_system(const OptimizationProblem& problem, Iterate& iterate, Vector<ElementType>& solution) = 0;
+
+      [[nodiscard]] virtual bool matrix_is_singular() const = 0;
 
       [[nodiscard]] virtual EvaluationSpace& get_evaluation_space() = 0;
    };
@@ -5,6 +5,7 @@
 #include <string>
 #include "SymmetricIndefiniteLinearSolverFactory.hpp"
 #include "DirectSymmetricIndefiniteLinearSolver.hpp"
+#include "ingredients/subproblem_solvers/MINRES/MINRESSolver.hpp"
 #include "linear_algebra/Vector.hpp"
 
 #if defined(HAS_HSL) || defined(HAS_MA57)
@@ -28,14 +29,15 @@ namespace uno {
 #endif
 
 namespace uno {
-   std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> SymmetricIndefiniteLinearSolverFactory::create(const std::string& linear_solver) {
+   std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> SymmetricIndefiniteLinearSolverFactory::create(const std::string& linear_solver,
+         [[maybe_unused]] const Options& options) {
 #if defined(HAS_HSL) || defined(HAS_MA57)
       if (linear_solver == "MA57"
    #ifdef HAS_HSL
          && LIBHSL_isfunctional()
    #endif
             ) {
-         return std::make_unique<MA57Solver>();
+         return std::make_unique<MA57Solver>(options);
       }
 #endif
 
@@ -45,21 +47,32 @@ namespace uno {
          && LIBHSL_isfunctional()
    # endif
       ) {
-         return std::make_unique<MA27Solver>();
+         return std::make_unique<MA27Solver>(options);
       }
 #endif // HAS_HSL || HAS_MA27
 
 #ifdef HAS_MUMPS
       if (linear_solver == "MUMPS") {
-         return std::make_unique<MUMPSSolver>();
+         return std::make_unique<MUMPSSolver>(options);
       }
 #endif
       std::string message = "The linear solver ";
       message.append(linear_solver).append(" is unknown").append("\n").append("The following values are available: ")
             .append(join(SymmetricIndefiniteLinearSolverFactory::available_solvers(), ", "));
+      if (linear_solver == "MINRES") {
+         message.append("\nMINRES is matrix-free and cannot be used to compute the inertia of a matrix");
+      }
       throw std::invalid_argument(message);
    }
 
+   std::unique_ptr<SymmetricIndefiniteLinearSolver<double>> SymmetricIndefiniteLinearSolverFactory::create_augmented_system_solver(
+         const std::string& linear_solver, const Options& options) {
+      if (linear_solver == "MINRES") {
+         return std::make_unique<MINRESSolver>(options);
+      }
+      return SymmetricIndefiniteLinearSolverFactory::create(linear_solver, options);
+   }
+
    // return the list of available solvers
    std::vector<std::string> SymmetricIndefiniteLinearSolverFactory::available_solvers() {
       std::vector<std::string> solvers{};
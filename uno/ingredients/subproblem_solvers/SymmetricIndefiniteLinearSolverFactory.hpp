@@ -4,21 +4,33 @@
 #ifndef UNO_LINEARSOLVERFACTORY_H
 #define UNO_LINEARSOLVERFACTORY_H
 
+#include <initializer_list>
 #include <memory>
 #include <string>
 #include <vector>
 
 namespace uno {
-   // forward declaration
+   // forward declarations
    template <class ElementType>
    class DirectSymmetricIndefiniteLinearSolver;
+   class Options;
+   template <class ElementType>
+   class SymmetricIndefiniteLinearSolver;
 
    class SymmetricIndefiniteLinearSolverFactory {
    public:
-      static std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> create(const std::string& linear_solver);
+      static std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> create(const std::string& linear_solver,
+         const Options& options);
+
+      // create a solver of the augmented systems: a direct solver or a matrix-free solver
+      static std::unique_ptr<SymmetricIndefiniteLinearSolver<double>> create_augmented_system_solver(const std::string& linear_solver,
+         const Options& options);
 
       // return the list of available solvers
       static std::vector<std::string> available_solvers();
+
+      // list of matrix-free solvers (always available, but never selected by default)
+      constexpr static std::initializer_list<const char*> matrix_free_solvers{"MINRES"};
    };
 } // namespace
 
@@ -0,0 +1,413 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "TruncatedCGSolver.hpp"
+#include "ingredients/subproblem/Subproblem.hpp"
+#include "linear_algebra/Norm.hpp"
+#include "linear_algebra/SparseVector.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "optimization/Direction.hpp"
+#include "optimization/Iterate.hpp"
+#include "optimization/WarmstartInformation.hpp"
+#include "options/Options.hpp"
+#include "tools/CancellationToken.hpp"
+#include "tools/Infinity.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   TruncatedCGSolver::TruncatedCGSolver(const Options& options):
+         QPSolver(),
+         maximum_iterations(options.get_unsigned_int("truncated_CG_max_iterations")),
+         tolerance(options.get_double("truncated_CG_tolerance")),
+         normal_step_fraction(options.get_double("truncated_CG_normal_step_fraction")),
+         primal_tolerance(options.get_double("primal_tolerance")) {
+   }
+
+   void TruncatedCGSolver::initialize_memory(const Subproblem& subproblem) {
+      if (!subproblem.has_hessian_operator()) {
+         throw std::runtime_error("The truncated CG solver requires Hessian-vector products");
+      }
+      if (!subproblem.problem.get_inequality_constraints().empty()) {
+         throw std::runtime_error("The truncated CG solver can only solve subproblems with equality constraints. Reformulate "
+            "the inequality constraints with slacks");
+      }
+      this->evaluation_space.initialize(subproblem.problem);
+
+      this->lower_bounds.resize(subproblem.number_variables);
+      this->upper_bounds.resize(subproblem.number_variables);
+      this->constraint_rhs.resize(subproblem.number_constraints);
+      this->squared_scaling.resize(subproblem.number_variables);
+
+      this->primals.resize(subproblem.number_variables);
+      this->residual.resize(subproblem.number_variables);
+      this->projected_residual.resize(subproblem.number_variables);
+      this->search_direction.resize(subproblem.number_variables);
+      this->hessian_search_direction.resize(subproblem.number_variables);
+      this->variables_work.resize(subproblem.number_variables);
+      this->multipliers.resize(subproblem.number_constraints);
+      this->constraints_rhs_work.resize(subproblem.number_constraints);
+      this->constraints_residual.resize(subproblem.number_constraints);
+      this->constraints_direction.resize(subproblem.number_constraints);
+      this->constraints_work.resize(subproblem.number_constraints);
+   }
+
+   void TruncatedCGSolver::solve(Statistics& /*statistics*/, Subproblem& subproblem, const Vector<double>& /*initial_point*/,
+         Direction& direction, const WarmstartInformation& warmstart_information) {
+      this->set_up_subproblem(subproblem, warmstart_information);
+      direction.status = SubproblemStatus::OPTIMAL;
+      direction.multipliers.reset();
+
+      // normal step: the variables that would leave the box are fixed and the normal step is recomputed
+      this->compute_scaling(subproblem.number_variables);
+      this->compute_normal_step(subproblem, this->primals);
+      while (this->fix_variables_moving_outside_bounds(subproblem.number_variables, this->primals)) {
+         this->compute_normal_step(subproblem, this->primals);
+      }
+
+      // tangential step
+      if (direction.status == SubproblemStatus::OPTIMAL) {
+         this->compute_tangential_step(subproblem, direction);
+      }
+      // multipliers
+      if (direction.status == SubproblemStatus::OPTIMAL) {
+         this->set_multipliers(subproblem, this->primals, direction.multipliers);
+      }
+      for (size_t variable_index: Range(subproblem.number_variables)) {
+         direction.primals[variable_index] = this->primals[variable_index];
+      }
+   }
+
+   EvaluationSpace& TruncatedCGSolver::get_evaluation_space() {
+      return this->evaluation_space;
+   }
+
+   // protected member functions
+
+   void TruncatedCGSolver::set_up_subproblem(const Subproblem& subproblem, const WarmstartInformation& warmstart_information) {
+      // evaluate the functions and derivatives
+      this->evaluation_space.evaluate_functions(subproblem.problem, subproblem.current_iterate, warmstart_information);
+
+      // variable bounds
+      if (warmstart_information.variable_bounds_changed) {
+         subproblem.set_variables_bounds(this->lower_bounds, this->upper_bounds);
+      }
+
+      // RHS of the linearized equality constraints
+      if (warmstart_information.constraint_bounds_changed || warmstart_information.constraints_changed) {
+         for (size_t constraint_index: Range(subproblem.number_constraints)) {
+            this->constraint_rhs[constraint_index] = subproblem.problem.constraint_lower_bound(constraint_index) -
+               this->evaluation_space.constraints[constraint_index];
+         }
+      }
+   }
+
+   // the variables are scaled by the width of their box (capped at 1), which favors the variables with large boxes (e.g.
+   // the elastic variables) in the normal step. The variables with equal bounds are fixed
+   void TruncatedCGSolver::compute_scaling(size_t number_variables) {
+      for (size_t variable_index: Range(number_variables)) {
+         const double width = std::min(1., this->upper_bounds[variable_index] - this->lower_bounds[variable_index]);
+         this->squared_scaling[variable_index] = (0. < width) ? width * width : 0.;
+      }
+   }
+
+   // scaled least-norm solution of J d = r, that is d = S^2 J^T u with (J S^2 J^T) u = r, truncated to a fraction of the
+   // box. If the linearized constraints cannot be satisfied within the box, the subproblem is declared infeasible
+   void TruncatedCGSolver::compute_normal_step(const Subproblem& subproblem, Vector<double>& normal_step) {
+      normal_step.fill(0.);
+      if (subproblem.number_constraints == 0) {
+         return;
+      }
+      this->solve_normal_equations(this->constraint_rhs, this->multipliers);
+      this->evaluation_space.compute_constraint_jacobian_transposed_vector_product(this->multipliers, this->variables_work);
+      for (size_t variable_index: Range(subproblem.number_variables)) {
+         normal_step[variable_index] = this->squared_scaling[variable_index] * this->variables_work[variable_index];
+      }
+   }
+
+   // fix the variables that the step would move outside the fraction of the box (in particular the variables on a bound,
+   // for which the box is empty in one direction). Returns true if at least one variable was fixed
+   bool TruncatedCGSolver::fix_variables_moving_outside_bounds(size_t number_variables, const Vector<double>& step) {
+      bool variable_fixed = false;
+      for (size_t variable_index: Range(number_variables)) {
+         if (0. < this->squared_scaling[variable_index] &&
+               ((step[variable_index] < 0. && step[variable_index] < this->normal_step_fraction * this->lower_bounds[variable_index]) ||
+               (0. < step[variable_index] && this->normal_step_fraction * this->upper_bounds[variable_index] < step[variable_index]))) {
+            this->squared_scaling[variable_index] = 0.;
+            variable_fixed = true;
+         }
+      }
+      return variable_fixed;
+   }
+
+   // fix the variables on a bound whose reduced derivative (at the current multiplier estimate) points outwards.
+   // Returns true if at least one variable was fixed
+   bool TruncatedCGSolver::fix_variables_with_outward_reduced_gradient(size_t number_variables) {
+      this->project(this->residual, this->projected_residual);
+      if (this->multipliers.empty()) {
+         this->variables_work.fill(0.);
+      }
+      else {
+         this->evaluation_space.compute_constraint_jacobian_transposed_vector_product(this->multipliers, this->variables_work);
+      }
+      bool variable_fixed = false;
+      for (size_t variable_index: Range(number_variables)) {
+         const double reduced_derivative = this->residual[variable_index] - this->variables_work[variable_index];
+         if (0. < this->squared_scaling[variable_index] &&
+               ((this->primals[variable_index] <= this->lower_bounds[variable_index] && 0. < reduced_derivative) ||
+               (this->upper_bounds[variable_index] <= this->primals[variable_index] && reduced_derivative < 0.))) {
+            this->squared_scaling[variable_index] = 0.;
+            variable_fixed = true;
+         }
+      }
+      return variable_fixed;
+   }
+
+   // the free variables that the last CG step (along the direction) brought to a bound are projected onto the bound and fixed.
+   // The projection moves the point: the Hessian-vector product and the residual g + H d are recomputed
+   void TruncatedCGSolver::fix_blocking_variables(const Subproblem& subproblem, const Vector<double>& direction) {
+      bool point_projected = false;
+      for (size_t variable_index: Range(subproblem.number_variables)) {
+         if (0. < this->squared_scaling[variable_index]) {
+            if (direction[variable_index] < 0. && this->primals[variable_index] <= this->lower_bounds[variable_index] +
+                  this->primal_tolerance * std::max(1., std::abs(this->lower_bounds[variable_index]))) {
+               point_projected |= (this->primals[variable_index] != this->lower_bounds[variable_index]);
+               this->primals[variable_index] = this->lower_bounds[variable_index];
+               this->squared_scaling[variable_index] = 0.;
+            }
+            else if (0. < direction[variable_index] && this->upper_bounds[variable_index] - this->primal_tolerance *
+                  std::max(1., std::abs(this->upper_bounds[variable_index])) <= this->primals[variable_index]) {
+               point_projected |= (this->primals[variable_index] != this->upper_bounds[variable_index]);
+               this->primals[variable_index] = this->upper_bounds[variable_index];
+               this->squared_scaling[variable_index] = 0.;
+            }
+         }
+      }
+      if (point_projected) {
+         Vector<double>& hessian_direction_product = this->evaluation_space.hessian_direction_product;
+         this->compute_hessian_vector_product(subproblem, this->primals, hessian_direction_product);
+         for (size_t variable_index: Range(subproblem.number_variables)) {
+            this->residual[variable_index] = this->evaluation_space.objective_gradient[variable_index] +
+               hessian_direction_product[variable_index];
+         }
+      }
+   }
+
+   void TruncatedCGSolver::compute_tangential_step(const Subproblem& subproblem, Direction& direction) {
+      const size_t number_variables = subproblem.number_variables;
+
+      // the linearized constraints must be satisfied by the normal step
+      if (0 < subproblem.number_constraints) {
+         this->evaluation_space.compute_constraint_jacobian_vector_product(this->primals, this->constraints_work);
+         double linearized_infeasibility = 0.;
+         for (size_t constraint_index: Range(subproblem.number_constraints)) {
+            linearized_infeasibility = std::max(linearized_infeasibility,
+               std::abs(this->constraints_work[constraint_index] - this->constraint_rhs[constraint_index]));
+         }
+         if (this->primal_tolerance * std::max(1., norm_inf(this->constraint_rhs)) < linearized_infeasibility) {
+            DEBUG << "Truncated CG: the linearized constraints are inconsistent (residual " << linearized_infeasibility << ")\n";
+            direction.status = SubproblemStatus::INFEASIBLE;
+            return;
+         }
+      }
+      // the normal step must lie in a fraction of the box
+      double normal_step_length = 1.;
+      for (size_t variable_index: Range(number_variables)) {
+         if (this->primals[variable_index] < 0. && is_finite(this->lower_bounds[variable_index])) {
+            normal_step_length = std::min(normal_step_length,
+               this->normal_step_fraction * this->lower_bounds[variable_index] / this->primals[variable_index]);
+         }
+         else if (0. < this->primals[variable_index] && is_finite(this->upper_bounds[variable_index])) {
+            normal_step_length = std::min(normal_step_length,
+               this->normal_step_fraction * this->upper_bounds[variable_index] / this->primals[variable_index]);
+         }
+      }
+      if (normal_step_length < 1.) {
+         DEBUG << "Truncated CG: the linearized constraints cannot be satisfied within the trust region\n";
+         this->primals.scale(std::max(0., normal_step_length));
+         direction.status = SubproblemStatus::INFEASIBLE;
+         return;
+      }
+
+      // residual of the QP at the normal step: g + H d
+      Vector<double>& hessian_direction_product = this->evaluation_space.hessian_direction_product;
+      this->compute_hessian_vector_product(subproblem, this->primals, hessian_direction_product);
+      for (size_t variable_index: Range(number_variables)) {
+         this->residual[variable_index] = this->evaluation_space.objective_gradient[variable_index] +
+            hessian_direction_product[variable_index];
+      }
+      // the variables on a bound whose reduced derivative g + H d - J^T y points outwards are fixed. Since the multiplier
+      // estimate y depends on the free variables, the variables are fixed until the estimate is consistent
+      while (this->fix_variables_with_outward_reduced_gradient(number_variables)) { }
+
+      // projected conjugate gradient, restarted on the faces of the box and truncated along a direction of negative curvature
+      this->project(this->residual, this->projected_residual);
+      double residual_product = dot(this->residual, this->projected_residual);
+      const double initial_residual_product = residual_product;
+      for (size_t variable_index: Range(number_variables)) {
+         this->search_direction[variable_index] = -this->projected_residual[variable_index];
+      }
+      size_t iteration = 0;
+      // the projected residuals are only accurate up to the tolerance of the projection (the normal equations are solved
+      // iteratively): the products of residuals are therefore compared with a relative tolerance (not its square)
+      while (iteration < this->maximum_iterations && this->tolerance * initial_residual_product < residual_product) {
+         CancellationToken::check();
+         this->compute_hessian_vector_product(subproblem, this->search_direction, this->hessian_search_direction);
+         const double curvature = dot(this->search_direction, this->hessian_search_direction);
+         const double step_to_boundary = this->compute_step_to_boundary(number_variables, this->primals, this->search_direction);
+         const bool negative_curvature = (curvature <= 0.);
+         const double step_length = negative_curvature ? step_to_boundary : std::min(residual_product / curvature, step_to_boundary);
+         if (!is_finite(step_length)) {
+            DEBUG << "Truncated CG: direction of negative curvature without bounds\n";
+            direction.status = SubproblemStatus::UNBOUNDED_PROBLEM;
+            return;
+         }
+         for (size_t variable_index: Range(number_variables)) {
+            this->primals[variable_index] += step_length * this->search_direction[variable_index];
+            hessian_direction_product[variable_index] += step_length * this->hessian_search_direction[variable_index];
+            this->residual[variable_index] += step_length * this->hessian_search_direction[variable_index];
+         }
+         ++iteration;
+         if (negative_curvature) {
+            DEBUG << "Truncated CG: negative curvature at iteration " << iteration << '\n';
+            break;
+         }
+         bool restart = false;
+         if (step_to_boundary <= step_length) {
+            // the variables that reached a bound are fixed and the CG is restarted on the face of the box
+            DEBUG << "Truncated CG: boundary reached at iteration " << iteration << '\n';
+            this->fix_blocking_variables(subproblem, this->search_direction);
+            while (this->fix_variables_with_outward_reduced_gradient(number_variables)) { }
+            restart = true;
+         }
+         // update the residual and the search direction
+         this->project(this->residual, this->projected_residual);
+         const double new_residual_product = dot(this->residual, this->projected_residual);
+         const double beta = restart ? 0. : new_residual_product / residual_product;
+         residual_product = new_residual_product;
+         for (size_t variable_index: Range(number_variables)) {
+            this->search_direction[variable_index] = -this->projected_residual[variable_index] + beta * this->search_direction[variable_index];
+         }
+      }
+      DEBUG << "Truncated CG: " << iteration << " iterations\n";
+
+      // project the direction onto the box (round-off errors). If the projection moves the point, the Hessian-vector product
+      // used in the objective and the multipliers is recomputed
+      bool point_projected = false;
+      for (size_t variable_index: Range(number_variables)) {
+         const double projected_primal = std::min(std::max(this->primals[variable_index], this->lower_bounds[variable_index]),
+            this->upper_bounds[variable_index]);
+         point_projected |= (projected_primal != this->primals[variable_index]);
+         this->primals[variable_index] = projected_primal;
+      }
+      if (point_projected) {
+         this->compute_hessian_vector_product(subproblem, this->primals, hessian_direction_product);
+      }
+      direction.subproblem_objective = dot(this->evaluation_space.objective_gradient, this->primals) +
+         0.5 * dot(this->primals, hessian_direction_product);
+   }
+
+   // scaled projection onto the null space of J: S^2 (v - J^T y) with (J S^2 J^T) y = J S^2 v.
+   // y is kept in this->multipliers
+   void TruncatedCGSolver::project(const Vector<double>& vector, Vector<double>& result) {
+      const size_t number_variables = vector.size();
+      if (this->multipliers.empty()) {
+         for (size_t variable_index: Range(number_variables)) {
+            result[variable_index] = this->squared_scaling[variable_index] * vector[variable_index];
+         }
+         return;
+      }
+      for (size_t variable_index: Range(number_variables)) {
+         this->variables_work[variable_index] = this->squared_scaling[variable_index] * vector[variable_index];
+      }
+      this->evaluation_space.compute_constraint_jacobian_vector_product(this->variables_work, this->constraints_rhs_work);
+      this->solve_normal_equations(this->constraints_rhs_work, this->multipliers);
+      this->evaluation_space.compute_constraint_jacobian_transposed_vector_product(this->multipliers, this->variables_work);
+      for (size_t variable_index: Range(number_variables)) {
+         result[variable_index] = this->squared_scaling[variable_index] * (vector[variable_index] - this->variables_work[variable_index]);
+      }
+   }
+
+   // conjugate gradient on the (positive semidefinite) normal equations (J S^2 J^T) u = rhs
+   void TruncatedCGSolver::solve_normal_equations(const Vector<double>& rhs, Vector<double>& solution) {
+      solution.fill(0.);
+      this->constraints_residual = rhs;
+      this->constraints_direction = rhs;
+      double residual_norm_squared = dot(rhs, rhs);
+      const double initial_residual_norm_squared = residual_norm_squared;
+      size_t iteration = 0;
+      while (iteration < this->maximum_iterations && 0. < residual_norm_squared &&
+            this->tolerance * this->tolerance * initial_residual_norm_squared < residual_norm_squared) {
+         // product (J S^2 J^T) p
+         this->evaluation_space.compute_constraint_jacobian_transposed_vector_product(this->constraints_direction, this->variables_work);
+         for (size_t variable_index: Range(this->variables_work.size())) {
+            this->variables_work[variable_index] *= this->squared_scaling[variable_index];
+         }
+         this->evaluation_space.compute_constraint_jacobian_vector_product(this->variables_work, this->constraints_work);
+         const double curvature = dot(this->constraints_direction, this->constraints_work);
+         if (curvature <= 0.) {
+            break;
+         }
+         const double step_length = residual_norm_squared / curvature;
+         for (size_t constraint_index: Range(solution.size())) {
+            solution[constraint_index] += step_length * this->constraints_direction[constraint_index];
+            this->constraints_residual[constraint_index] -= step_length * this->constraints_work[constraint_index];
+         }
+         const double new_residual_norm_squared = dot(this->constraints_residual, this->constraints_residual);
+         const double beta = new_residual_norm_squared / residual_norm_squared;
+         residual_norm_squared = new_residual_norm_squared;
+         for (size_t constraint_index: Range(solution.size())) {
+            this->constraints_direction[constraint_index] = this->constraints_residual[constraint_index] +
+               beta * this->constraints_direction[constraint_index];
+         }
+         ++iteration;
+      }
+   }
+
+   void TruncatedCGSolver::compute_hessian_vector_product(const Subproblem& subproblem, const Vector<double>& vector,
+         Vector<double>& result) const {
+      result.fill(0.);
+      subproblem.compute_hessian_vector_product(subproblem.current_iterate.primals.data(), vector.data(), result.data());
+   }
+
+   // largest step length along the direction such that the point remains within the box
+   double TruncatedCGSolver::compute_step_to_boundary(size_t number_variables, const Vector<double>& point,
+         const Vector<double>& direction) const {
+      double step_length = INF<double>;
+      for (size_t variable_index: Range(number_variables)) {
+         if (direction[variable_index] < 0. && is_finite(this->lower_bounds[variable_index])) {
+            step_length = std::min(step_length, (this->lower_bounds[variable_index] - point[variable_index]) / direction[variable_index]);
+         }
+         else if (0. < direction[variable_index] && is_finite(this->upper_bounds[variable_index])) {
+            step_length = std::min(step_length, (this->upper_bounds[variable_index] - point[variable_index]) / direction[variable_index]);
+         }
+      }
+      return std::max(0., step_length);
+   }
+
+   // least-square estimate of the constraint multipliers y at the solution and bound multipliers z = g + H d - J^T y
+   // of the active bounds
+   void TruncatedCGSolver::set_multipliers(const Subproblem& subproblem, const Vector<double>& primals, Multipliers& direction_multipliers) {
+      const Vector<double>& hessian_direction_product = this->evaluation_space.hessian_direction_product;
+      for (size_t variable_index: Range(subproblem.number_variables)) {
+         this->residual[variable_index] = this->evaluation_space.objective_gradient[variable_index] +
+            hessian_direction_product[variable_index];
+      }
+      this->project(this->residual, this->projected_residual);
+      this->evaluation_space.compute_constraint_jacobian_transposed_vector_product(this->multipliers, this->variables_work);
+      for (size_t constraint_index: Range(subproblem.number_constraints)) {
+         direction_multipliers.constraints[constraint_index] = this->multipliers[constraint_index];
+      }
+      for (size_t variable_index: Range(subproblem.number_variables)) {
+         const double bound_multiplier = this->residual[variable_index] - this->variables_work[variable_index];
+         if (primals[variable_index] <= this->lower_bounds[variable_index] && 0. < bound_multiplier) {
+            direction_multipliers.lower_bounds[variable_index] = bound_multiplier;
+         }
+         else if (this->upper_bounds[variable_index] <= primals[variable_index] && bound_multiplier < 0.) {
+            direction_multipliers.upper_bounds[variable_index] = bound_multiplier;
+         }
+      }
+   }
+} // namespace
@@ -0,0 +1,76 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_TRUNCATEDCGSOLVER_H
+#define UNO_TRUNCATEDCGSOLVER_H
+
+#include <vector>
+#include "ingredients/subproblem_solvers/QPSolver.hpp"
+#include "ingredients/subproblem_solvers/OperatorEvaluationSpace.hpp"
+#include "linear_algebra/Vector.hpp"
+
+namespace uno {
+   // forward declarations
+   class Multipliers;
+   class Options;
+   class Subproblem;
+
+   // matrix-free solver for trust-region subproblems with equality constraints and bounds:
+   //   min g^T d + 1/2 d^T H d   s.t.   J d = r,   l <= d <= u   (l and u include the trust region)
+   // The direction is the sum of a normal step (scaled least-norm solution of J d = r) and a tangential step computed with
+   // the projected conjugate gradient method (Gould, Hribar and Nocedal, 2001). When it encounters a bound, the blocking
+   // variables are fixed and the CG is restarted on the face of the box; it is truncated along a direction of negative
+   // curvature (Steihaug, 1983). Only Hessian-vector products and Jacobian products are used.
+   // Inequality constraints should be reformulated with slacks
+   class TruncatedCGSolver : public QPSolver {
+   public:
+      explicit TruncatedCGSolver(const Options& options);
+
+      void initialize_memory(const Subproblem& subproblem) override;
+
+      void solve(Statistics& statistics, Subproblem& subproblem, const Vector<double>& initial_point,
+         Direction& direction, const WarmstartInformation& warmstart_information) override;
+
+      [[nodiscard]] EvaluationSpace& get_evaluation_space() override;
+
+   protected:
+      OperatorEvaluationSpace evaluation_space{};
+      const size_t maximum_iterations;
+      const double tolerance;
+      const double normal_step_fraction;
+      const double primal_tolerance;
+      std::vector<double> lower_bounds{}, upper_bounds{}; // bounds of the variables
+      Vector<double> constraint_rhs{}; // RHS r of the linearized constraints
+      // diagonal scaling of the variables (0 for the variables fixed at a bound)
+      Vector<double> squared_scaling{};
+
+      // vectors of the conjugate gradient methods
+      Vector<double> primals{};
+      Vector<double> residual{};
+      Vector<double> projected_residual{};
+      Vector<double> search_direction{};
+      Vector<double> hessian_search_direction{};
+      Vector<double> variables_work{};
+      Vector<double> multipliers{};
+      Vector<double> constraints_rhs_work{};
+      Vector<double> constraints_residual{};
+      Vector<double> constraints_direction{};
+      Vector<double> constraints_work{};
+
+      void set_up_subproblem(const Subproblem& subproblem, const WarmstartInformation& warmstart_information);
+      void compute_scaling(size_t number_variables);
+      void compute_normal_step(const Subproblem& subproblem, Vector<double>& normal_step);
+      [[nodiscard]] bool fix_variables_moving_outside_bounds(size_t number_variables, const Vector<double>& step);
+      [[nodiscard]] bool fix_variables_with_outward_reduced_gradient(size_t number_variables);
+      void fix_blocking_variables(const Subproblem& subproblem, const Vector<double>& direction);
+      void compute_tangential_step(const Subproblem& subproblem, Direction& direction);
+      void project(const Vector<double>& vector, Vector<double>& result);
+      void solve_normal_equations(const Vector<double>& rhs, Vector<double>& solution);
+      void compute_hessian_vector_product(const Subproblem& subproblem, const Vector<double>& vector, Vector<double>& result) const;
+      [[nodiscard]] double compute_step_to_boundary(size_t number_variables, const Vector<double>& point,
+         const Vector<double>& direction) const;
+      void set_multipliers(const Subproblem& subproblem, const Vector<double>& primals, Multipliers& direction_multipliers);
+   };
+} // namespace
+
+#endif // UNO_TRUNCATEDCGSOLVER_H
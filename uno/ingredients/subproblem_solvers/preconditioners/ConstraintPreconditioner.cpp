@@ -0,0 +1,95 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include "ConstraintPreconditioner.hpp"
+#include "ingredients/subproblem/Subproblem.hpp"
+#include "ingredients/subproblem_solvers/OperatorEvaluationSpace.hpp"
+#include "ingredients/subproblem_solvers/SymmetricIndefiniteLinearSolverFactory.hpp"
+#include "options/Options.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   ConstraintPreconditioner::ConstraintPreconditioner(const Options& options): JacobiPreconditioner(),
+         linear_solver(SymmetricIndefiniteLinearSolverFactory::create(options.get_string("MINRES_preconditioner_linear_solver"), options)) {
+   }
+
+   void ConstraintPreconditioner::initialize(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space) {
+      JacobiPreconditioner::initialize(subproblem, evaluation_space);
+      this->number_variables = subproblem.number_variables;
+      const size_t number_jacobian_nonzeros = evaluation_space.jacobian_values.size();
+      // the pattern of [I J^T; J 0] is that of the least-square system (identity block, then Jacobian block)
+      this->linear_solver->initialize_least_square_system(subproblem.problem);
+      this->matrix_values.resize(subproblem.number_variables + number_jacobian_nonzeros);
+      for (size_t variable_index: Range(subproblem.number_variables)) {
+         this->matrix_values[variable_index] = 1.;
+      }
+      this->factorized_jacobian_values.resize(number_jacobian_nonzeros);
+      this->augmented_rhs.resize(subproblem.number_variables + subproblem.number_constraints);
+      this->augmented_solution.resize(subproblem.number_variables + subproblem.number_constraints);
+   }
+
+   void ConstraintPreconditioner::evaluate(Statistics& statistics, const Subproblem& subproblem,
+         const OperatorEvaluationSpace& evaluation_space) {
+      JacobiPreconditioner::evaluate(statistics, subproblem, evaluation_space);
+      if (subproblem.number_constraints == 0) {
+         return;
+      }
+      // refactorize J J^T only if the Jacobian changed
+      if (this->factorization_performed && std::equal(evaluation_space.jacobian_values.begin(), evaluation_space.jacobian_values.end(),
+            this->factorized_jacobian_values.begin())) {
+         DEBUG << "Constraint preconditioner: the factorization of J J^T is reused\n";
+         return;
+      }
+      this->factorized_jacobian_values = evaluation_space.jacobian_values;
+      std::copy(evaluation_space.jacobian_values.begin(), evaluation_space.jacobian_values.end(),
+         this->matrix_values.begin() + static_cast<std::ptrdiff_t>(subproblem.number_variables));
+      if (!this->analysis_performed) {
+         this->linear_solver->do_symbolic_analysis();
+         this->analysis_performed = true;
+      }
+      this->linear_solver->do_numerical_factorization(this->matrix_values.data());
+      this->factorization_performed = true;
+      this->jacobian_has_full_rank = !this->linear_solver->matrix_is_singular();
+      if (!this->jacobian_has_full_rank) {
+         WARNING << "Constraint preconditioner: the Jacobian is rank-deficient, the diagonal of J D^{-1} J^T is used instead\n";
+      }
+   }
+
+   void ConstraintPreconditioner::regularize(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space,
+         double primal_regularization, double dual_regularization) {
+      this->compute_primal_diagonal(subproblem, primal_regularization);
+      if (this->jacobian_has_full_rank) {
+         // ω = n / sum 1/D_i
+         double inverse_sum = 0.;
+         for (size_t variable_index: Range(subproblem.number_variables)) {
+            inverse_sum += 1. / this->diagonal[variable_index];
+         }
+         this->scaling = static_cast<double>(subproblem.number_variables) / inverse_sum;
+      }
+      else {
+         this->compute_dual_diagonal(subproblem, evaluation_space, dual_regularization);
+      }
+   }
+
+   void ConstraintPreconditioner::apply(const Vector<double>& vector, Vector<double>& result) {
+      if (!this->jacobian_has_full_rank) {
+         JacobiPreconditioner::apply(vector, result);
+         return;
+      }
+      const size_t dimension = this->augmented_rhs.size();
+      for (size_t variable_index: Range(this->number_variables)) {
+         result[variable_index] = vector[variable_index] / this->diagonal[variable_index];
+         this->augmented_rhs[variable_index] = 0.;
+      }
+      for (size_t index: Range(this->number_variables, dimension)) {
+         this->augmented_rhs[index] = vector[index];
+      }
+      // [I J^T; J 0] [u; w] = [0; r] yields w = -(J J^T)^{-1} r
+      this->linear_solver->solve_indefinite_system(this->matrix_values, this->augmented_rhs, this->augmented_solution);
+      for (size_t index: Range(this->number_variables, dimension)) {
+         result[index] = -this->scaling * this->augmented_solution[index];
+      }
+   }
+} // namespace
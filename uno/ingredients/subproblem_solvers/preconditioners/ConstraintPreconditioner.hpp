@@ -0,0 +1,45 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_CONSTRAINTPRECONDITIONER_H
+#define UNO_CONSTRAINTPRECONDITIONER_H
+
+#include <memory>
+#include "JacobiPreconditioner.hpp"
+#include "ingredients/subproblem_solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
+
+namespace uno {
+   // forward declaration
+   class Options;
+
+   // block-diagonal constraint preconditioner diag(D, (J J^T) / ω) where D is the diagonal of the Jacobi preconditioner and
+   // ω is the harmonic mean of D, so that (J J^T) / ω approximates the Schur complement J D^{-1} J^T.
+   // J J^T is factorized in the augmented form [I J^T; J 0] by a direct solver. Since it does not depend on the barrier
+   // terms or the regularization, the factorization is reused until the Jacobian changes (e.g. for linear constraints, it
+   // is computed once). If J is rank-deficient, the diagonal of the Schur complement is used instead
+   class ConstraintPreconditioner: public JacobiPreconditioner {
+   public:
+      explicit ConstraintPreconditioner(const Options& options);
+      ~ConstraintPreconditioner() override = default;
+
+      void initialize(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space) override;
+      void evaluate(Statistics& statistics, const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space) override;
+      void regularize(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space,
+         double primal_regularization, double dual_regularization) override;
+      void apply(const Vector<double>& vector, Vector<double>& result) override;
+
+   protected:
+      const std::unique_ptr<DirectSymmetricIndefiniteLinearSolver<double>> linear_solver;
+      size_t number_variables{0};
+      Vector<double> matrix_values{}; // [I J^T; J 0]
+      Vector<double> factorized_jacobian_values{};
+      bool analysis_performed{false};
+      bool factorization_performed{false};
+      bool jacobian_has_full_rank{false};
+      double scaling{1.}; // ω
+      Vector<double> augmented_rhs{};
+      Vector<double> augmented_solution{};
+   };
+} // namespace
+
+#endif // UNO_CONSTRAINTPRECONDITIONER_H
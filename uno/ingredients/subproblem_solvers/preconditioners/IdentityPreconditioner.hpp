@@ -0,0 +1,27 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_IDENTITYPRECONDITIONER_H
+#define UNO_IDENTITYPRECONDITIONER_H
+
+#include "Preconditioner.hpp"
+#include "linear_algebra/Vector.hpp"
+
+namespace uno {
+   class IdentityPreconditioner: public Preconditioner {
+   public:
+      IdentityPreconditioner() = default;
+      ~IdentityPreconditioner() override = default;
+
+      void initialize(const Subproblem& /*subproblem*/, const OperatorEvaluationSpace& /*evaluation_space*/) override { }
+      void evaluate(Statistics& /*statistics*/, const Subproblem& /*subproblem*/, const OperatorEvaluationSpace& /*evaluation_space*/) override { }
+      void regularize(const Subproblem& /*subproblem*/, const OperatorEvaluationSpace& /*evaluation_space*/,
+         double /*primal_regularization*/, double /*dual_regularization*/) override { }
+
+      void apply(const Vector<double>& vector, Vector<double>& result) override {
+         result = vector;
+      }
+   };
+} // namespace
+
+#endif // UNO_IDENTITYPRECONDITIONER_H
@@ -0,0 +1,211 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "IncompleteLDLPreconditioner.hpp"
+#include "ingredients/subproblem/Subproblem.hpp"
+#include "ingredients/subproblem_solvers/OperatorEvaluationSpace.hpp"
+#include "linear_algebra/Indexing.hpp"
+#include "options/Options.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   IncompleteLDLPreconditioner::IncompleteLDLPreconditioner(const Options& options): Preconditioner(),
+         pivot_tolerance(options.get_double("MINRES_ILDL_pivot_tolerance")) {
+   }
+
+   void IncompleteLDLPreconditioner::initialize(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space) {
+      this->number_variables = subproblem.number_variables;
+      this->use_hessian_matrix = subproblem.has_hessian_matrix();
+      this->compute_pattern(subproblem, evaluation_space);
+      this->matrix_values.resize(this->column_indices.size());
+      this->factors.resize(this->column_indices.size());
+      this->row_position.resize(subproblem.number_variables + subproblem.number_constraints);
+      if (this->use_hessian_matrix) {
+         this->hessian_values.resize(subproblem.number_hessian_nonzeros());
+      }
+      else {
+         this->barrier_diagonal.resize(subproblem.number_variables);
+      }
+   }
+
+   void IncompleteLDLPreconditioner::evaluate(Statistics& statistics, const Subproblem& subproblem,
+         const OperatorEvaluationSpace& evaluation_space) {
+      std::fill(this->matrix_values.begin(), this->matrix_values.end(), 0.);
+      // (1, 1) block
+      if (this->use_hessian_matrix) {
+         subproblem.evaluate_lagrangian_hessian(statistics, this->hessian_values.data());
+         for (size_t nonzero_index: Range(this->hessian_values.size())) {
+            this->matrix_values[this->hessian_lower_positions[nonzero_index]] += this->hessian_values[nonzero_index];
+            if (this->hessian_upper_positions[nonzero_index] != this->hessian_lower_positions[nonzero_index]) {
+               this->matrix_values[this->hessian_upper_positions[nonzero_index]] += this->hessian_values[nonzero_index];
+            }
+         }
+      }
+      else {
+         subproblem.evaluate_barrier_diagonal(this->barrier_diagonal.data());
+         for (size_t variable_index: Range(subproblem.number_variables)) {
+            this->matrix_values[this->diagonal_positions[variable_index]] += this->barrier_diagonal[variable_index];
+         }
+      }
+      // (2, 1) and (1, 2) blocks
+      for (size_t nonzero_index: Range(evaluation_space.jacobian_values.size())) {
+         this->matrix_values[this->jacobian_lower_positions[nonzero_index]] += evaluation_space.jacobian_values[nonzero_index];
+         this->matrix_values[this->jacobian_upper_positions[nonzero_index]] += evaluation_space.jacobian_values[nonzero_index];
+      }
+   }
+
+   void IncompleteLDLPreconditioner::regularize(const Subproblem& subproblem, const OperatorEvaluationSpace& /*evaluation_space*/,
+         double primal_regularization, double dual_regularization) {
+      this->factors = this->matrix_values;
+      if (0. < primal_regularization) {
+         for (size_t variable_index: subproblem.get_primal_regularization_variables()) {
+            this->factors[this->diagonal_positions[variable_index]] += primal_regularization;
+         }
+      }
+      if (0. < dual_regularization) {
+         for (size_t constraint_index: subproblem.get_dual_regularization_constraints()) {
+            this->factors[this->diagonal_positions[subproblem.number_variables + constraint_index]] -= dual_regularization;
+         }
+      }
+      this->factorize();
+   }
+
+   // result = (L |D| L^T)^{-1} vector
+   void IncompleteLDLPreconditioner::apply(const Vector<double>& vector, Vector<double>& result) {
+      const size_t dimension = this->diagonal_positions.size();
+      result = vector;
+      // L y = vector
+      for (size_t row_index: Range(dimension)) {
+         for (size_t position = this->row_pointers[row_index]; position < this->diagonal_positions[row_index]; ++position) {
+            result[row_index] -= this->factors[position] * result[this->column_indices[position]];
+         }
+      }
+      // |D| z = y
+      for (size_t row_index: Range(dimension)) {
+         result[row_index] /= std::abs(this->factors[this->diagonal_positions[row_index]]);
+      }
+      // L^T x = z
+      for (size_t row_index = dimension; 0 < row_index--;) {
+         for (size_t position = this->row_pointers[row_index]; position < this->diagonal_positions[row_index]; ++position) {
+            result[this->column_indices[position]] -= this->factors[position] * result[row_index];
+         }
+      }
+   }
+
+   // protected member functions
+
+   // symmetric pattern of the augmented matrix: Hessian (or diagonal), Jacobian and its transpose, and the diagonal
+   void IncompleteLDLPreconditioner::compute_pattern(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space) {
+      const size_t dimension = subproblem.number_variables + subproblem.number_constraints;
+      std::vector<std::vector<size_t>> row_columns(dimension);
+      for (size_t index: Range(dimension)) {
+         row_columns[index].push_back(index);
+      }
+      std::vector<int> hessian_row_indices{}, hessian_column_indices{};
+      if (this->use_hessian_matrix) {
+         hessian_row_indices.resize(subproblem.number_regularized_hessian_nonzeros());
+         hessian_column_indices.resize(subproblem.number_regularized_hessian_nonzeros());
+         subproblem.compute_regularized_hessian_sparsity(hessian_row_indices.data(), hessian_column_indices.data(), Indexing::C_indexing);
+         // the regularization entries are handled separately
+         hessian_row_indices.resize(subproblem.number_hessian_nonzeros());
+         hessian_column_indices.resize(subproblem.number_hessian_nonzeros());
+         for (size_t nonzero_index: Range(hessian_row_indices.size())) {
+            const auto row_index = static_cast<size_t>(hessian_row_indices[nonzero_index]);
+            const auto column_index = static_cast<size_t>(hessian_column_indices[nonzero_index]);
+            row_columns[row_index].push_back(column_index);
+            row_columns[column_index].push_back(row_index);
+         }
+      }
+      for (size_t nonzero_index: Range(evaluation_space.jacobian_values.size())) {
+         const size_t row_index = subproblem.number_variables + static_cast<size_t>(evaluation_space.jacobian_row_indices[nonzero_index]);
+         const auto column_index = static_cast<size_t>(evaluation_space.jacobian_column_indices[nonzero_index]);
+         row_columns[row_index].push_back(column_index);
+         row_columns[column_index].push_back(row_index);
+      }
+
+      // CSR format
+      this->row_pointers.resize(dimension + 1);
+      this->row_pointers[0] = 0;
+      this->column_indices.clear();
+      this->diagonal_positions.resize(dimension);
+      for (size_t row_index: Range(dimension)) {
+         std::vector<size_t>& columns = row_columns[row_index];
+         std::sort(columns.begin(), columns.end());
+         columns.erase(std::unique(columns.begin(), columns.end()), columns.end());
+         this->column_indices.insert(this->column_indices.end(), columns.begin(), columns.end());
+         this->row_pointers[row_index + 1] = this->column_indices.size();
+         this->diagonal_positions[row_index] = this->row_pointers[row_index] +
+            static_cast<size_t>(std::lower_bound(columns.begin(), columns.end(), row_index) - columns.begin());
+      }
+      const auto position = [&](size_t row_index, size_t column_index) {
+         const auto row_start = this->column_indices.begin() + static_cast<std::ptrdiff_t>(this->row_pointers[row_index]);
+         const auto row_end = this->column_indices.begin() + static_cast<std::ptrdiff_t>(this->row_pointers[row_index + 1]);
+         return static_cast<size_t>(std::lower_bound(row_start, row_end, column_index) - this->column_indices.begin());
+      };
+      this->hessian_lower_positions.resize(hessian_row_indices.size());
+      this->hessian_upper_positions.resize(hessian_row_indices.size());
+      for (size_t nonzero_index: Range(hessian_row_indices.size())) {
+         const auto row_index = static_cast<size_t>(hessian_row_indices[nonzero_index]);
+         const auto column_index = static_cast<size_t>(hessian_column_indices[nonzero_index]);
+         this->hessian_lower_positions[nonzero_index] = position(std::max(row_index, column_index), std::min(row_index, column_index));
+         this->hessian_upper_positions[nonzero_index] = position(std::min(row_index, column_index), std::max(row_index, column_index));
+      }
+      this->jacobian_lower_positions.resize(evaluation_space.jacobian_values.size());
+      this->jacobian_upper_positions.resize(evaluation_space.jacobian_values.size());
+      for (size_t nonzero_index: Range(evaluation_space.jacobian_values.size())) {
+         const size_t row_index = subproblem.number_variables + static_cast<size_t>(evaluation_space.jacobian_row_indices[nonzero_index]);
+         const auto column_index = static_cast<size_t>(evaluation_space.jacobian_column_indices[nonzero_index]);
+         this->jacobian_lower_positions[nonzero_index] = position(row_index, column_index);
+         this->jacobian_upper_positions[nonzero_index] = position(column_index, row_index);
+      }
+      DEBUG << "Incomplete LDL^T preconditioner with " << this->column_indices.size() << " nonzeros\n";
+   }
+
+   // ILU(0) in IKJ order on the symmetric matrix: the strict lower triangle of the factors holds L, the diagonal holds D
+   // and the strict upper triangle holds D L^T
+   void IncompleteLDLPreconditioner::factorize() {
+      const size_t dimension = this->diagonal_positions.size();
+      double largest_entry = 0.;
+      for (double entry: this->factors) {
+         largest_entry = std::max(largest_entry, std::abs(entry));
+      }
+      const double pivot_threshold = this->pivot_tolerance * std::max(1., largest_entry);
+      constexpr size_t not_in_row = std::numeric_limits<size_t>::max();
+      std::fill(this->row_position.begin(), this->row_position.end(), not_in_row);
+
+      size_t number_perturbed_pivots = 0;
+      for (size_t row_index: Range(dimension)) {
+         for (size_t position = this->row_pointers[row_index]; position < this->row_pointers[row_index + 1]; ++position) {
+            this->row_position[this->column_indices[position]] = position;
+         }
+         // eliminate the entries of the strict lower triangle
+         for (size_t position = this->row_pointers[row_index]; position < this->diagonal_positions[row_index]; ++position) {
+            const size_t pivot_index = this->column_indices[position];
+            const double multiplier = this->factors[position] / this->factors[this->diagonal_positions[pivot_index]];
+            this->factors[position] = multiplier;
+            // update the entries of the row that are in the pattern of the pivot row (no fill-in)
+            for (size_t pivot_position = this->diagonal_positions[pivot_index] + 1; pivot_position < this->row_pointers[pivot_index + 1];
+                  ++pivot_position) {
+               const size_t updated_position = this->row_position[this->column_indices[pivot_position]];
+               if (updated_position != not_in_row) {
+                  this->factors[updated_position] -= multiplier * this->factors[pivot_position];
+               }
+            }
+         }
+         // perturb the small pivots with the sign of the block
+         double& pivot = this->factors[this->diagonal_positions[row_index]];
+         if (std::abs(pivot) < pivot_threshold) {
+            pivot = (row_index < this->number_variables) ? pivot_threshold : -pivot_threshold;
+            ++number_perturbed_pivots;
+         }
+         for (size_t position = this->row_pointers[row_index]; position < this->row_pointers[row_index + 1]; ++position) {
+            this->row_position[this->column_indices[position]] = not_in_row;
+         }
+      }
+      DEBUG << "Incomplete LDL^T factorization: " << number_perturbed_pivots << " perturbed pivots\n";
+   }
+} // namespace
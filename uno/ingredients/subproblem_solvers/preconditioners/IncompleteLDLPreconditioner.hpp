@@ -0,0 +1,53 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_INCOMPLETELDLPRECONDITIONER_H
+#define UNO_INCOMPLETELDLPRECONDITIONER_H
+
+#include <vector>
+#include "Preconditioner.hpp"
+#include "linear_algebra/Vector.hpp"
+
+namespace uno {
+   // forward declaration
+   class Options;
+
+   // incomplete factorization L D L^T of the augmented matrix without fill-in (the factors have the sparsity of the augmented
+   // matrix). The preconditioner L |D| L^T is positive definite. The (1, 1) block is the Lagrangian Hessian if the Hessian
+   // model provides a matrix, and the barrier diagonal otherwise. Small pivots are perturbed away from 0 with the sign of
+   // their block (positive for the variables, negative for the constraints)
+   class IncompleteLDLPreconditioner: public Preconditioner {
+   public:
+      explicit IncompleteLDLPreconditioner(const Options& options);
+      ~IncompleteLDLPreconditioner() override = default;
+
+      void initialize(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space) override;
+      void evaluate(Statistics& statistics, const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space) override;
+      void regularize(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space,
+         double primal_regularization, double dual_regularization) override;
+      void apply(const Vector<double>& vector, Vector<double>& result) override;
+
+   protected:
+      const double pivot_tolerance;
+      size_t number_variables{0};
+      bool use_hessian_matrix{false};
+      // symmetric matrix in CSR format (both triangles, sorted column indices, diagonal always present)
+      std::vector<size_t> row_pointers{};
+      std::vector<size_t> column_indices{};
+      std::vector<size_t> diagonal_positions{};
+      // positions of the Hessian and Jacobian COO entries in the CSR format (lower, upper)
+      std::vector<size_t> hessian_lower_positions{}, hessian_upper_positions{};
+      std::vector<size_t> jacobian_lower_positions{}, jacobian_upper_positions{};
+      Vector<double> hessian_values{};
+      Vector<double> barrier_diagonal{};
+      std::vector<double> matrix_values{};
+      // factors: strict lower triangle of L and D (on the diagonal) in place of the matrix
+      std::vector<double> factors{};
+      std::vector<size_t> row_position{}; // work array of the factorization
+
+      void compute_pattern(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space);
+      void factorize();
+   };
+} // namespace
+
+#endif // UNO_INCOMPLETELDLPRECONDITIONER_H
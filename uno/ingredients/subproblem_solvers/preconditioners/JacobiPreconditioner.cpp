@@ -0,0 +1,73 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include "JacobiPreconditioner.hpp"
+#include "ingredients/subproblem/Subproblem.hpp"
+#include "ingredients/subproblem_solvers/OperatorEvaluationSpace.hpp"
+#include "symbolic/Range.hpp"
+
+namespace uno {
+   void JacobiPreconditioner::initialize(const Subproblem& subproblem, const OperatorEvaluationSpace& /*evaluation_space*/) {
+      this->barrier_diagonal.resize(subproblem.number_variables);
+      this->diagonal.resize(subproblem.number_variables + subproblem.number_constraints);
+   }
+
+   void JacobiPreconditioner::evaluate(Statistics& /*statistics*/, const Subproblem& subproblem,
+         const OperatorEvaluationSpace& /*evaluation_space*/) {
+      subproblem.evaluate_barrier_diagonal(this->barrier_diagonal.data());
+   }
+
+   void JacobiPreconditioner::regularize(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space,
+         double primal_regularization, double dual_regularization) {
+      this->compute_primal_diagonal(subproblem, primal_regularization);
+      this->compute_dual_diagonal(subproblem, evaluation_space, dual_regularization);
+   }
+
+   void JacobiPreconditioner::apply(const Vector<double>& vector, Vector<double>& result) {
+      for (size_t index: Range(this->diagonal.size())) {
+         result[index] = vector[index] / this->diagonal[index];
+      }
+   }
+
+   // D = max(1, Σ + δw): the barrier terms dominate for the variables close to their bounds
+   void JacobiPreconditioner::compute_primal_diagonal(const Subproblem& subproblem, double primal_regularization) {
+      for (size_t variable_index: Range(subproblem.number_variables)) {
+         this->diagonal[variable_index] = this->barrier_diagonal[variable_index];
+      }
+      if (0. < primal_regularization) {
+         for (size_t variable_index: subproblem.get_primal_regularization_variables()) {
+            this->diagonal[variable_index] += primal_regularization;
+         }
+      }
+      for (size_t variable_index: Range(subproblem.number_variables)) {
+         this->diagonal[variable_index] = std::max(1., this->diagonal[variable_index]);
+      }
+   }
+
+   // diagonal of the Schur complement J D^{-1} J^T + δc I
+   void JacobiPreconditioner::compute_dual_diagonal(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space,
+         double dual_regularization) {
+      const size_t number_variables = subproblem.number_variables;
+      for (size_t constraint_index: Range(subproblem.number_constraints)) {
+         this->diagonal[number_variables + constraint_index] = 0.;
+      }
+      for (size_t nonzero_index: Range(evaluation_space.jacobian_values.size())) {
+         const auto constraint_index = static_cast<size_t>(evaluation_space.jacobian_row_indices[nonzero_index]);
+         const auto variable_index = static_cast<size_t>(evaluation_space.jacobian_column_indices[nonzero_index]);
+         const double derivative = evaluation_space.jacobian_values[nonzero_index];
+         this->diagonal[number_variables + constraint_index] += derivative * derivative / this->diagonal[variable_index];
+      }
+      if (0. < dual_regularization) {
+         for (size_t constraint_index: subproblem.get_dual_regularization_constraints()) {
+            this->diagonal[number_variables + constraint_index] += dual_regularization;
+         }
+      }
+      // empty constraint gradients
+      for (size_t constraint_index: Range(subproblem.number_constraints)) {
+         if (this->diagonal[number_variables + constraint_index] == 0.) {
+            this->diagonal[number_variables + constraint_index] = 1.;
+         }
+      }
+   }
+} // namespace
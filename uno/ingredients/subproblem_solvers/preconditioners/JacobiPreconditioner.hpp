@@ -0,0 +1,34 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_JACOBIPRECONDITIONER_H
+#define UNO_JACOBIPRECONDITIONER_H
+
+#include "Preconditioner.hpp"
+#include "linear_algebra/Vector.hpp"
+
+namespace uno {
+   // block-diagonal preconditioner diag(D, diag(J D^{-1} J^T) + δc I) built from the barrier diagonal Σ of the interior-point
+   // problem: D = max(1, Σ + δw). The primal block ignores the Hessian of the Lagrangian, which is only available as an operator
+   class JacobiPreconditioner: public Preconditioner {
+   public:
+      JacobiPreconditioner() = default;
+      ~JacobiPreconditioner() override = default;
+
+      void initialize(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space) override;
+      void evaluate(Statistics& statistics, const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space) override;
+      void regularize(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space,
+         double primal_regularization, double dual_regularization) override;
+      void apply(const Vector<double>& vector, Vector<double>& result) override;
+
+   protected:
+      Vector<double> barrier_diagonal{};
+      Vector<double> diagonal{}; // D and the diagonal of the approximate Schur complement
+
+      void compute_primal_diagonal(const Subproblem& subproblem, double primal_regularization);
+      void compute_dual_diagonal(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space,
+         double dual_regularization);
+   };
+} // namespace
+
+#endif // UNO_JACOBIPRECONDITIONER_H
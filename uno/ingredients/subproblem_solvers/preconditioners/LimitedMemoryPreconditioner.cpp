@@ -0,0 +1,177 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include "LimitedMemoryPreconditioner.hpp"
+#include "ingredients/subproblem/Subproblem.hpp"
+#include "linear_algebra/SparseVector.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   LimitedMemoryPreconditioner::LimitedMemoryPreconditioner(std::unique_ptr<Preconditioner> preconditioner, size_t number_recycled_vectors,
+         size_t lanczos_basis_size): Preconditioner(),
+         preconditioner(std::move(preconditioner)), number_recycled_vectors(number_recycled_vectors),
+         lanczos_basis_size(std::max(lanczos_basis_size, number_recycled_vectors)) {
+   }
+
+   void LimitedMemoryPreconditioner::initialize(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space) {
+      this->preconditioner->initialize(subproblem, evaluation_space);
+      const size_t dimension = subproblem.number_variables + subproblem.number_constraints;
+      this->lanczos_vectors.assign(this->lanczos_basis_size, Vector<double>(dimension));
+      this->alphas.reserve(this->lanczos_basis_size);
+      this->betas.reserve(this->lanczos_basis_size);
+      this->ritz_vectors.assign(this->number_recycled_vectors, Vector<double>(dimension));
+      this->ritz_coefficients.resize(this->number_recycled_vectors);
+      this->number_ritz_vectors = 0;
+   }
+
+   void LimitedMemoryPreconditioner::evaluate(Statistics& statistics, const Subproblem& subproblem,
+         const OperatorEvaluationSpace& evaluation_space) {
+      this->preconditioner->evaluate(statistics, subproblem, evaluation_space);
+   }
+
+   void LimitedMemoryPreconditioner::regularize(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space,
+         double primal_regularization, double dual_regularization) {
+      this->preconditioner->regularize(subproblem, evaluation_space, primal_regularization, dual_regularization);
+   }
+
+   void LimitedMemoryPreconditioner::apply(const Vector<double>& vector, Vector<double>& result) {
+      this->preconditioner->apply(vector, result);
+      for (size_t ritz_index: Range(this->number_ritz_vectors)) {
+         const Vector<double>& ritz_vector = this->ritz_vectors[ritz_index];
+         const double coefficient = this->ritz_coefficients[ritz_index] * dot(ritz_vector, vector);
+         for (size_t index: Range(result.size())) {
+            result[index] += coefficient * ritz_vector[index];
+         }
+      }
+   }
+
+   void LimitedMemoryPreconditioner::start_krylov_process() {
+      this->number_lanczos_vectors = 0;
+      this->alphas.clear();
+      this->betas.clear();
+   }
+
+   void LimitedMemoryPreconditioner::record_lanczos_step(const Vector<double>& lanczos_vector, double alpha, double beta) {
+      if (this->number_lanczos_vectors < this->lanczos_basis_size) {
+         this->lanczos_vectors[this->number_lanczos_vectors] = lanczos_vector;
+         this->alphas.push_back(alpha);
+         this->betas.push_back(beta);
+         ++this->number_lanczos_vectors;
+      }
+   }
+
+   // compute the Ritz pairs of the Lanczos tridiagonal matrix and recycle those with the smallest |θ|
+   void LimitedMemoryPreconditioner::end_krylov_process() {
+      const size_t basis_size = this->number_lanczos_vectors;
+      // if the Krylov space is too small, the previous Ritz vectors are kept
+      if (basis_size < 2) {
+         return;
+      }
+      std::vector<double> tridiagonal_matrix(basis_size * basis_size, 0.);
+      for (size_t index: Range(basis_size)) {
+         tridiagonal_matrix[index * basis_size + index] = this->alphas[index];
+         if (index + 1 < basis_size) {
+            tridiagonal_matrix[index * basis_size + index + 1] = this->betas[index];
+            tridiagonal_matrix[(index + 1) * basis_size + index] = this->betas[index];
+         }
+      }
+      std::vector<double> eigenvectors(basis_size * basis_size);
+      LimitedMemoryPreconditioner::compute_eigendecomposition(basis_size, tridiagonal_matrix, eigenvectors);
+
+      // sort the Ritz values by increasing magnitude
+      std::vector<size_t> ritz_indices(basis_size);
+      std::iota(ritz_indices.begin(), ritz_indices.end(), 0);
+      const auto ritz_value = [&](size_t ritz_index) {
+         return std::abs(tridiagonal_matrix[ritz_index * basis_size + ritz_index]);
+      };
+      std::sort(ritz_indices.begin(), ritz_indices.end(), [&](size_t index1, size_t index2) {
+         return ritz_value(index1) < ritz_value(index2);
+      });
+      const double largest_ritz_value = ritz_value(ritz_indices.back());
+      const double smallest_recycled_value = std::sqrt(std::numeric_limits<double>::epsilon()) * largest_ritz_value;
+
+      this->number_ritz_vectors = 0;
+      for (size_t ritz_index: ritz_indices) {
+         if (this->number_ritz_vectors == this->number_recycled_vectors || largest_ritz_value <= ritz_value(ritz_index)) {
+            break;
+         }
+         if (ritz_value(ritz_index) <= smallest_recycled_value) {
+            continue;
+         }
+         // u = V s
+         Vector<double>& ritz_vector = this->ritz_vectors[this->number_ritz_vectors];
+         ritz_vector.fill(0.);
+         for (size_t lanczos_index: Range(basis_size)) {
+            const double coefficient = eigenvectors[lanczos_index * basis_size + ritz_index];
+            for (size_t index: Range(ritz_vector.size())) {
+               ritz_vector[index] += coefficient * this->lanczos_vectors[lanczos_index][index];
+            }
+         }
+         this->ritz_coefficients[this->number_ritz_vectors] = largest_ritz_value / ritz_value(ritz_index) - 1.;
+         ++this->number_ritz_vectors;
+      }
+      DEBUG << "Limited-memory preconditioner: " << this->number_ritz_vectors << " Ritz vectors recycled from a Krylov space of dimension " <<
+         basis_size << '\n';
+   }
+
+   // cyclic Jacobi method for a small dense symmetric matrix (row-major). On return, the diagonal of the matrix contains the
+   // eigenvalues and the columns of "eigenvectors" the orthonormal eigenvectors
+   void LimitedMemoryPreconditioner::compute_eigendecomposition(size_t dimension, std::vector<double>& matrix,
+         std::vector<double>& eigenvectors) {
+      std::fill(eigenvectors.begin(), eigenvectors.end(), 0.);
+      for (size_t index: Range(dimension)) {
+         eigenvectors[index * dimension + index] = 1.;
+      }
+      constexpr size_t maximum_sweeps = 50;
+      for (size_t sweep = 0; sweep < maximum_sweeps; ++sweep) {
+         double off_diagonal_norm = 0.;
+         double diagonal_norm = 0.;
+         for (size_t row_index: Range(dimension)) {
+            diagonal_norm += matrix[row_index * dimension + row_index] * matrix[row_index * dimension + row_index];
+            for (size_t column_index: Range(row_index + 1, dimension)) {
+               off_diagonal_norm += matrix[row_index * dimension + column_index] * matrix[row_index * dimension + column_index];
+            }
+         }
+         if (off_diagonal_norm <= std::numeric_limits<double>::epsilon() * std::numeric_limits<double>::epsilon() * diagonal_norm) {
+            return;
+         }
+         for (size_t p: Range(dimension)) {
+            for (size_t q: Range(p + 1, dimension)) {
+               const double apq = matrix[p * dimension + q];
+               if (apq == 0.) {
+                  continue;
+               }
+               // rotation that annihilates the (p, q) entry
+               const double theta = (matrix[q * dimension + q] - matrix[p * dimension + p]) / (2. * apq);
+               const double t = ((0. <= theta) ? 1. : -1.) / (std::abs(theta) + std::sqrt(theta * theta + 1.));
+               const double c = 1. / std::sqrt(t * t + 1.);
+               const double s = t * c;
+               for (size_t index: Range(dimension)) {
+                  const double aip = matrix[index * dimension + p];
+                  const double aiq = matrix[index * dimension + q];
+                  matrix[index * dimension + p] = c * aip - s * aiq;
+                  matrix[index * dimension + q] = s * aip + c * aiq;
+               }
+               for (size_t index: Range(dimension)) {
+                  const double api = matrix[p * dimension + index];
+                  const double aqi = matrix[q * dimension + index];
+                  matrix[p * dimension + index] = c * api - s * aqi;
+                  matrix[q * dimension + index] = s * api + c * aqi;
+               }
+               for (size_t index: Range(dimension)) {
+                  const double vip = eigenvectors[index * dimension + p];
+                  const double viq = eigenvectors[index * dimension + q];
+                  eigenvectors[index * dimension + p] = c * vip - s * viq;
+                  eigenvectors[index * dimension + q] = s * vip + c * viq;
+               }
+            }
+         }
+      }
+      WARNING << "The eigendecomposition of the Lanczos matrix did not converge\n";
+   }
+} // namespace
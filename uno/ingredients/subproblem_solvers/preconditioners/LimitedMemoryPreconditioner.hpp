@@ -0,0 +1,52 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_LIMITEDMEMORYPRECONDITIONER_H
+#define UNO_LIMITEDMEMORYPRECONDITIONER_H
+
+#include <memory>
+#include <vector>
+#include "Preconditioner.hpp"
+#include "linear_algebra/Vector.hpp"
+
+namespace uno {
+   // limited-memory preconditioner (Gratton, Sartenaer and Tshimanga, 2011) that recycles the Krylov spaces of the previous
+   // solves. The first Lanczos vectors V of a solve preconditioned by P are kept. The Ritz pairs (θ_i, u_i = V s_i) of
+   // P^{-1} K with the smallest |θ_i| define the preconditioner of the next solve:
+   //   P_new^{-1} = P^{-1} + sum_i (σ / |θ_i| - 1) u_i u_i^T,   with σ = max_i |θ_i|,
+   // which maps the small Ritz values to ±σ. The update is positive semidefinite, so P_new is positive definite even though
+   // the Ritz vectors are only approximate eigenvectors of the next (slightly different) system
+   class LimitedMemoryPreconditioner: public Preconditioner {
+   public:
+      LimitedMemoryPreconditioner(std::unique_ptr<Preconditioner> preconditioner, size_t number_recycled_vectors,
+         size_t lanczos_basis_size);
+      ~LimitedMemoryPreconditioner() override = default;
+
+      void initialize(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space) override;
+      void evaluate(Statistics& statistics, const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space) override;
+      void regularize(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space,
+         double primal_regularization, double dual_regularization) override;
+      void apply(const Vector<double>& vector, Vector<double>& result) override;
+
+      void start_krylov_process() override;
+      void record_lanczos_step(const Vector<double>& lanczos_vector, double alpha, double beta) override;
+      void end_krylov_process() override;
+
+   protected:
+      const std::unique_ptr<Preconditioner> preconditioner; // P
+      const size_t number_recycled_vectors;
+      const size_t lanczos_basis_size;
+      // Lanczos basis of the current solve and the tridiagonal matrix
+      std::vector<Vector<double>> lanczos_vectors{};
+      std::vector<double> alphas{}, betas{};
+      size_t number_lanczos_vectors{0};
+      // recycled Ritz vectors and the coefficients of the update
+      std::vector<Vector<double>> ritz_vectors{};
+      std::vector<double> ritz_coefficients{};
+      size_t number_ritz_vectors{0};
+
+      static void compute_eigendecomposition(size_t dimension, std::vector<double>& matrix, std::vector<double>& eigenvectors);
+   };
+} // namespace
+
+#endif // UNO_LIMITEDMEMORYPRECONDITIONER_H
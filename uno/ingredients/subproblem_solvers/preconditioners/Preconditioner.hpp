@@ -0,0 +1,39 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_PRECONDITIONER_H
+#define UNO_PRECONDITIONER_H
+
+namespace uno {
+   // forward declarations
+   class OperatorEvaluationSpace;
+   class Statistics;
+   class Subproblem;
+   template <typename ElementType>
+   class Vector;
+
+   // symmetric positive definite preconditioner P of the augmented matrix [W + Σ + δw I, J^T; J, -δc I] for Krylov methods.
+   // P is built in two stages: evaluate() gathers the data of the current iterate (once per iteration), regularize()
+   // builds P for given regularization factors (possibly several times per iteration)
+   class Preconditioner {
+   public:
+      Preconditioner() = default;
+      virtual ~Preconditioner() = default;
+
+      virtual void initialize(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space) = 0;
+      // the Jacobian stored in the evaluation space is evaluated at the current iterate
+      virtual void evaluate(Statistics& statistics, const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space) = 0;
+      virtual void regularize(const Subproblem& subproblem, const OperatorEvaluationSpace& evaluation_space,
+         double primal_regularization, double dual_regularization) = 0;
+      // result = P^{-1} vector
+      virtual void apply(const Vector<double>& vector, Vector<double>& result) = 0;
+
+      // Lanczos process of the Krylov method preconditioned by P: the Lanczos vectors v_k are P-orthonormal and
+      // tridiagonalize the augmented matrix (diagonal alpha_k, off-diagonal beta_{k+1}). Ignored by default
+      virtual void start_krylov_process() { }
+      virtual void record_lanczos_step(const Vector<double>& /*lanczos_vector*/, double /*alpha*/, double /*beta*/) { }
+      virtual void end_krylov_process() { }
+   };
+} // namespace
+
+#endif // UNO_PRECONDITIONER_H
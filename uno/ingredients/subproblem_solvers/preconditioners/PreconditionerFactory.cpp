@@ -0,0 +1,41 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <stdexcept>
+#include <string>
+#include "PreconditionerFactory.hpp"
+#include "ConstraintPreconditioner.hpp"
+#include "IdentityPreconditioner.hpp"
+#include "IncompleteLDLPreconditioner.hpp"
+#include "JacobiPreconditioner.hpp"
+#include "LimitedMemoryPreconditioner.hpp"
+#include "options/Options.hpp"
+
+namespace uno {
+   std::unique_ptr<Preconditioner> PreconditionerFactory::create(const Options& options) {
+      const std::string& preconditioner_name = options.get_string("MINRES_preconditioner");
+      std::unique_ptr<Preconditioner> preconditioner;
+      if (preconditioner_name == "identity") {
+         preconditioner = std::make_unique<IdentityPreconditioner>();
+      }
+      else if (preconditioner_name == "jacobi") {
+         preconditioner = std::make_unique<JacobiPreconditioner>();
+      }
+      else if (preconditioner_name == "incomplete_LDL") {
+         preconditioner = std::make_unique<IncompleteLDLPreconditioner>(options);
+      }
+      else if (preconditioner_name == "constraint") {
+         preconditioner = std::make_unique<ConstraintPreconditioner>(options);
+      }
+      else {
+         throw std::invalid_argument("Preconditioner " + preconditioner_name + " does not exist");
+      }
+
+      const size_t number_recycled_vectors = options.get_unsigned_int("MINRES_recycled_vectors");
+      if (0 < number_recycled_vectors) {
+         return std::make_unique<LimitedMemoryPreconditioner>(std::move(preconditioner), number_recycled_vectors,
+            options.get_unsigned_int("MINRES_Lanczos_basis_size"));
+      }
+      return preconditioner;
+   }
+} // namespace
@@ -0,0 +1,27 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_PRECONDITIONERFACTORY_H
+#define UNO_PRECONDITIONERFACTORY_H
+
+#include <array>
+#include <memory>
+
+namespace uno {
+   // forward declarations
+   class Options;
+   class Preconditioner;
+
+   class PreconditionerFactory {
+   public:
+      // preconditioner of MINRES (option MINRES_preconditioner). If MINRES_recycled_vectors is positive, it is augmented
+      // with the Ritz vectors recycled from the previous Krylov spaces
+      static std::unique_ptr<Preconditioner> create(const Options& options);
+
+      constexpr static std::array available_preconditioners{
+         "identity", "jacobi", "incomplete_LDL", "constraint"
+      };
+   };
+} // namespace
+
+#endif // UNO_PRECONDITIONERFACTORY_H
@@ -4,8 +4,11 @@
 #ifndef UNO_NORM_H
 #define UNO_NORM_H
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <string>
+#include <type_traits>
 #include "symbolic/Range.hpp"
 
 namespace uno {
@@ -51,6 +54,83 @@ namespace uno {
       return result;
    }
 
+   //************************************************
+   // kernels for contiguous arrays of real numbers //
+   //************************************************
+   // arrays that expose their contiguous storage (Vector, std::vector) use dedicated kernels with multiple independent
+   // accumulators (which breaks the dependency chain and lets the compiler vectorize) and pairwise summation of
+   // fixed-size blocks (the rounding error grows as O(log n) instead of O(n)). Expressions use the generic functions
+   template <typename Array, typename = void>
+   struct is_contiguous_real_array: std::false_type { };
+
+   template <typename Array>
+   struct is_contiguous_real_array<Array, std::void_t<decltype(std::declval<const Array&>().data()), decltype(std::declval<const Array&>().size())>>:
+      std::bool_constant<std::is_floating_point_v<typename Array::value_type> &&
+         std::is_same_v<decltype(std::declval<const Array&>().data()), const typename Array::value_type*>> { };
+
+   template <typename Array>
+   constexpr bool is_contiguous_real_array_v = is_contiguous_real_array<Array>::value;
+
+   namespace kernels {
+      constexpr size_t number_accumulators = 4;
+      constexpr size_t block_size = 128; // multiple of number_accumulators
+
+      // sum of transform(x[i]) over a block of at most block_size elements
+      template <typename ElementType, typename Transform>
+      ElementType block_sum(const ElementType* x, size_t size, const Transform& transform) {
+         ElementType accumulator0{0}, accumulator1{0}, accumulator2{0}, accumulator3{0};
+         size_t index = 0;
+         for (; index + number_accumulators <= size; index += number_accumulators) {
+            accumulator0 += transform(x[index]);
+            accumulator1 += transform(x[index + 1]);
+            accumulator2 += transform(x[index + 2]);
+            accumulator3 += transform(x[index + 3]);
+         }
+         for (; index < size; index++) {
+            accumulator0 += transform(x[index]);
+         }
+         return (accumulator0 + accumulator1) + (accumulator2 + accumulator3);
+      }
+
+      // pairwise summation: recursively split the array until it fits in a block
+      template <typename ElementType, typename Transform>
+      ElementType pairwise_sum(const ElementType* x, size_t size, const Transform& transform) {
+         if (size <= block_size) {
+            return block_sum(x, size, transform);
+         }
+         // split on a multiple of the block size
+         const size_t half_size = ((size / 2 + block_size - 1) / block_size) * block_size;
+         return pairwise_sum(x, half_size, transform) + pairwise_sum(x + half_size, size - half_size, transform);
+      }
+
+      template <typename ElementType>
+      ElementType sum_of_absolute_values(const ElementType* x, size_t size) {
+         return pairwise_sum(x, size, [](ElementType element) { return std::abs(element); });
+      }
+
+      template <typename ElementType>
+      ElementType sum_of_squares(const ElementType* x, size_t size) {
+         return pairwise_sum(x, size, [](ElementType element) { return element * element; });
+      }
+
+      // the maximum is exact: no pairwise summation needed. NaN entries are ignored, as in the generic function
+      template <typename ElementType>
+      ElementType max_absolute_value(const ElementType* x, size_t size) {
+         ElementType accumulator0{0}, accumulator1{0}, accumulator2{0}, accumulator3{0};
+         size_t index = 0;
+         for (; index + number_accumulators <= size; index += number_accumulators) {
+            accumulator0 = std::max(accumulator0, std::abs(x[index]));
+            accumulator1 = std::max(accumulator1, std::abs(x[index + 1]));
+            accumulator2 = std::max(accumulator2, std::abs(x[index + 2]));
+            accumulator3 = std::max(accumulator3, std::abs(x[index + 3]));
+         }
+         for (; index < size; index++) {
+            accumulator0 = std::max(accumulator0, std::abs(x[index]));
+         }
+         return std::max(std::max(accumulator0, accumulator1), std::max(accumulator2, accumulator3));
+      }
+   } // namespace
+
    //***********
    // l1 norm //
    //***********
@@ -61,7 +141,12 @@ namespace uno {
 
    template <typename Array, typename ElementType = typename Array::value_type>
    ElementType norm_1(const Array& x) {
-      return generic_norm(x, norm_1_accumulation<ElementType>);
+      if constexpr (is_contiguous_real_array_v<Array>) {
+         return kernels::sum_of_absolute_values(x.data(), x.size());
+      }
+      else {
+         return generic_norm(x, norm_1_accumulation<ElementType>);
+      }
    }
 
    // l1 norm of several arrays
@@ -80,7 +165,12 @@ namespace uno {
 
    template <typename Array, typename ElementType = typename Array::value_type>
    ElementType norm_2_squared(const Array& x) {
-      return generic_norm(x, norm_2_squared_accumulation<ElementType>);
+      if constexpr (is_contiguous_real_array_v<Array>) {
+         return kernels::sum_of_squares(x.data(), x.size());
+      }
+      else {
+         return generic_norm(x, norm_2_squared_accumulation<ElementType>);
+      }
    }
 
    // l2 squared norm of several arrays
@@ -113,7 +203,12 @@ namespace uno {
 
    template <typename Array, typename ElementType = typename Array::value_type>
    ElementType norm_inf(const Array& x) {
-      return generic_norm(x, norm_inf_accumulation<ElementType>);
+      if constexpr (is_contiguous_real_array_v<Array>) {
+         return kernels::max_absolute_value(x.data(), x.size());
+      }
+      else {
+         return generic_norm(x, norm_inf_accumulation<ElementType>);
+      }
    }
 
    // inf norm of several arrays
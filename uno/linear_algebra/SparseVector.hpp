@@ -4,9 +4,12 @@
 #ifndef UNO_SPARSEVECTOR_H
 #define UNO_SPARSEVECTOR_H
 
+#include <algorithm>
 #include <cassert>
-#include <functional>
+#include <cmath>
 #include <ostream>
+#include <type_traits>
+#include <utility>
 #include <vector>
 #include "symbolic/Range.hpp"
 
@@ -14,7 +17,9 @@ namespace uno {
    // SparseVector is a sparse vector that uses contiguous memory. It contains:
    // - a vector of indices of type size_t
    // - a vector of values of type ElementType
-   // the indices are neither unique nor sorted
+   // the indices are neither unique nor sorted in general. The vector keeps track of whether the indices were inserted in
+   // strictly increasing order ("finalized"); finalize() sorts the indices and sums the duplicates. The merge-based
+   // operations (axpy, sparse-sparse dot) require finalized vectors
    template <typename ElementType>
    class SparseVector {
    public:
@@ -50,10 +55,25 @@ namespace uno {
       void reserve(size_t capacity);
 
       void insert(size_t index, ElementType value);
-      void transform(const std::function<ElementType(ElementType)>& f);
+      template <typename Function>
+      void transform(const Function& f);
       void clear();
       [[nodiscard]] bool is_empty() const;
 
+      // sorted-index maintenance
+      void finalize();
+      [[nodiscard]] bool is_finalized() const;
+
+      // scatter-gather with a dense workspace of zeros (e.g. a Vector), reusable across calls
+      template <typename Array>
+      void scatter(Array& workspace, ElementType factor = ElementType(1)) const;
+      template <typename Array>
+      void gather(Array& workspace);
+
+      // raw access to the nonzeros
+      [[nodiscard]] const size_t* indices_data() const { return this->indices.data(); }
+      [[nodiscard]] const ElementType* values_data() const { return this->values.data(); }
+
       [[nodiscard]] iterator begin() const { return iterator(*this, 0); }
       [[nodiscard]] iterator end() const { return iterator(*this, this->number_nonzeros); }
 
@@ -64,6 +84,10 @@ namespace uno {
       std::vector<size_t> indices{};
       std::vector<ElementType> values{};
       size_t number_nonzeros{0};
+      bool finalized{true}; // indices are strictly increasing
+
+      template <typename U>
+      friend void axpy(U alpha, const SparseVector<U>& x, SparseVector<U>& y);
    };
 
    // SparseVector methods
@@ -85,6 +109,9 @@ namespace uno {
 
    template <typename ElementType>
    void SparseVector<ElementType>::insert(size_t index, ElementType value) {
+      if (0 < this->number_nonzeros && index <= this->indices[this->number_nonzeros - 1]) {
+         this->finalized = false;
+      }
       this->indices.emplace_back(index);
       this->values.emplace_back(value);
       ++this->number_nonzeros;
@@ -95,6 +122,7 @@ namespace uno {
       this->indices.clear();
       this->values.clear();
       this->number_nonzeros = 0;
+      this->finalized = true;
    }
 
    template <typename ElementType>
@@ -103,12 +131,70 @@ namespace uno {
    }
 
    template <typename ElementType>
-   void SparseVector<ElementType>::transform(const std::function<ElementType (ElementType)>& f) {
+   template <typename Function>
+   void SparseVector<ElementType>::transform(const Function& f) {
       for (size_t index: Range(this->number_nonzeros)) {
          this->values[index] = f(this->values[index]);
       }
    }
 
+   // sort the indices and sum the values of duplicate indices
+   template <typename ElementType>
+   void SparseVector<ElementType>::finalize() {
+      if (this->finalized) {
+         return;
+      }
+      std::vector<std::pair<size_t, ElementType>> entries(this->number_nonzeros);
+      for (size_t nonzero_index: Range(this->number_nonzeros)) {
+         entries[nonzero_index] = {this->indices[nonzero_index], this->values[nonzero_index]};
+      }
+      std::stable_sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+         return a.first < b.first;
+      });
+      // compact the duplicates
+      size_t current_position = 0;
+      for (size_t nonzero_index: Range(entries.size())) {
+         if (0 < current_position && entries[nonzero_index].first == this->indices[current_position - 1]) {
+            this->values[current_position - 1] += entries[nonzero_index].second;
+         }
+         else {
+            this->indices[current_position] = entries[nonzero_index].first;
+            this->values[current_position] = entries[nonzero_index].second;
+            ++current_position;
+         }
+      }
+      this->indices.resize(current_position);
+      this->values.resize(current_position);
+      this->number_nonzeros = current_position;
+      this->finalized = true;
+   }
+
+   template <typename ElementType>
+   bool SparseVector<ElementType>::is_finalized() const {
+      return this->finalized;
+   }
+
+   // workspace += factor * x
+   template <typename ElementType>
+   template <typename Array>
+   void SparseVector<ElementType>::scatter(Array& workspace, ElementType factor) const {
+      for (size_t nonzero_index: Range(this->number_nonzeros)) {
+         workspace[this->indices[nonzero_index]] += factor * this->values[nonzero_index];
+      }
+   }
+
+   // read the workspace entries at the indices of x and reset them to zero
+   // precondition: the indices are unique (the workspace entry is read once)
+   template <typename ElementType>
+   template <typename Array>
+   void SparseVector<ElementType>::gather(Array& workspace) {
+      for (size_t nonzero_index: Range(this->number_nonzeros)) {
+         const size_t index = this->indices[nonzero_index];
+         this->values[nonzero_index] = workspace[index];
+         workspace[index] = ElementType(0);
+      }
+   }
+
    template <typename ElementType>
    std::ostream& operator<<(std::ostream& stream, const SparseVector<ElementType>& x) {
       stream << "sparse vector with " << x.size() << " nonzeros\n";
@@ -143,14 +229,98 @@ namespace uno {
    ElementType dot(const Vector& x, const SparseVector<ElementType>& y) {
       static_assert(std::is_same_v<typename Vector::value_type, ElementType>);
 
+      const size_t* indices = y.indices_data();
+      const ElementType* values = y.values_data();
+      const size_t number_nonzeros = y.size();
       ElementType dot_product = ElementType(0);
-      for (const auto [index, y_element]: y) {
+      for (size_t nonzero_index: Range(number_nonzeros)) {
+#if defined(__GNUC__)
+         // the accesses to x are indirect: prefetch the entries needed a few iterations ahead (only for stored entries)
+         if constexpr (std::is_lvalue_reference_v<decltype(x[0])>) {
+            constexpr size_t prefetch_distance = 8;
+            if (nonzero_index + prefetch_distance < number_nonzeros) {
+               __builtin_prefetch(&x[indices[nonzero_index + prefetch_distance]]);
+            }
+         }
+#endif
+         const size_t index = indices[nonzero_index];
          assert(index < x.size() && "Vector.dot: the sparse vector y is larger than the dense vector x");
-         dot_product += x[index] * y_element;
+         dot_product += x[index] * values[nonzero_index];
+      }
+      return dot_product;
+   }
+
+   // precondition: x and y are finalized
+   template <typename ElementType>
+   ElementType dot(const SparseVector<ElementType>& x, const SparseVector<ElementType>& y) {
+      assert(x.is_finalized() && y.is_finalized() && "dot: the sparse vectors should be finalized");
+      ElementType dot_product = ElementType(0);
+      size_t x_index = 0, y_index = 0;
+      while (x_index < x.size() && y_index < y.size()) {
+         const size_t x_position = x.indices_data()[x_index];
+         const size_t y_position = y.indices_data()[y_index];
+         if (x_position == y_position) {
+            dot_product += x.values_data()[x_index] * y.values_data()[y_index];
+            ++x_index;
+            ++y_index;
+         }
+         else if (x_position < y_position) {
+            ++x_index;
+         }
+         else {
+            ++y_index;
+         }
       }
       return dot_product;
    }
 
+   // y += alpha * x (sorted merge, the result is finalized)
+   // precondition: x and y are finalized
+   template <typename ElementType>
+   void axpy(ElementType alpha, const SparseVector<ElementType>& x, SparseVector<ElementType>& y) {
+      assert(x.is_finalized() && y.is_finalized() && "axpy: the sparse vectors should be finalized");
+      const size_t y_size = y.number_nonzeros;
+      const size_t total_size = y_size + x.number_nonzeros;
+      y.indices.resize(total_size);
+      y.values.resize(total_size);
+      // merge from the back, so that the entries of y are not overwritten before they are read
+      size_t x_remaining = x.number_nonzeros, y_remaining = y_size, position = total_size;
+      while (0 < x_remaining) {
+         --position;
+         if (0 < y_remaining && x.indices[x_remaining - 1] <= y.indices[y_remaining - 1]) {
+            y.indices[position] = y.indices[y_remaining - 1];
+            y.values[position] = y.values[y_remaining - 1];
+            if (x.indices[x_remaining - 1] == y.indices[y_remaining - 1]) {
+               y.values[position] += alpha * x.values[x_remaining - 1];
+               --x_remaining;
+            }
+            --y_remaining;
+         }
+         else {
+            y.indices[position] = x.indices[x_remaining - 1];
+            y.values[position] = alpha * x.values[x_remaining - 1];
+            --x_remaining;
+         }
+      }
+      // the remaining entries of y are already in place if no duplicate was merged. Otherwise, compact the gap
+      const size_t gap = position - y_remaining;
+      if (0 < gap) {
+         for (size_t index: Range(position, total_size)) {
+            y.indices[index - gap] = y.indices[index];
+            y.values[index - gap] = y.values[index];
+         }
+      }
+      y.indices.resize(total_size - gap);
+      y.values.resize(total_size - gap);
+      y.number_nonzeros = total_size - gap;
+   }
+
+   // y += x
+   template <typename ElementType>
+   void merge(const SparseVector<ElementType>& x, SparseVector<ElementType>& y) {
+      axpy(ElementType(1), x, y);
+   }
+
    // precondition: factor != 0
    template <typename ElementType>
    void scale(SparseVector<ElementType>& x, ElementType factor) {
@@ -31,6 +31,10 @@ namespace uno {
          return this->model.has_hessian_matrix();
       }
 
+      [[nodiscard]] bool has_thread_safe_evaluations() const override {
+         return this->model.has_thread_safe_evaluations();
+      }
+
       // function evaluations
       [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override {
          return this->model.evaluate_objective(x);
@@ -0,0 +1,145 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include "CachedModel.hpp"
+#include "options/Options.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   CachedModel::CachedModel(const Model& original_model, const Options& options):
+         Model(original_model.name, original_model.number_variables, original_model.number_constraints, original_model.objective_sign),
+         model(original_model),
+         objective_cache(options.get_unsigned_int("evaluation_cache_capacity")),
+         constraint_cache(options.get_unsigned_int("evaluation_cache_capacity")),
+         objective_gradient_cache(options.get_unsigned_int("evaluation_cache_capacity")),
+         jacobian_cache(options.get_unsigned_int("evaluation_cache_capacity")),
+         hessian_cache(options.get_unsigned_int("evaluation_cache_capacity")) {
+   }
+
+   // the values are cached only once the evaluation of the original model succeeded (it may throw).
+   // The caches are locked during the queries, but not during the evaluations of the original model (they may run concurrently)
+
+   double CachedModel::evaluate_objective(const Vector<double>& x) const {
+      {
+         std::lock_guard<std::mutex> lock(this->mutex);
+         this->set_key(x);
+         if (const double* objective = this->objective_cache.find(this->key)) {
+            return *objective;
+         }
+      }
+      const double objective = this->model.evaluate_objective(x);
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->set_key(x);
+      this->objective_cache.insert(this->key) = objective;
+      return objective;
+   }
+
+   void CachedModel::evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const {
+      {
+         std::lock_guard<std::mutex> lock(this->mutex);
+         this->set_key(x);
+         if (const std::vector<double>* cached_constraints = this->constraint_cache.find(this->key)) {
+            std::copy(cached_constraints->begin(), cached_constraints->end(), constraints.begin());
+            return;
+         }
+      }
+      this->model.evaluate_constraints(x, constraints);
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->set_key(x);
+      std::vector<double>& cached_constraints = this->constraint_cache.insert(this->key);
+      cached_constraints.assign(constraints.begin(), constraints.begin() + static_cast<std::ptrdiff_t>(this->number_constraints));
+   }
+
+   void CachedModel::evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const {
+      {
+         std::lock_guard<std::mutex> lock(this->mutex);
+         this->set_key(x);
+         if (const Vector<double>* cached_gradient = this->objective_gradient_cache.find(this->key)) {
+            std::copy(cached_gradient->begin(), cached_gradient->end(), gradient.begin());
+            return;
+         }
+      }
+      this->model.evaluate_objective_gradient(x, gradient);
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->set_key(x);
+      Vector<double>& cached_gradient = this->objective_gradient_cache.insert(this->key);
+      cached_gradient.resize(this->number_variables);
+      std::copy(gradient.begin(), gradient.begin() + static_cast<std::ptrdiff_t>(this->number_variables), cached_gradient.begin());
+   }
+
+   void CachedModel::compute_constraint_jacobian_sparsity(int* row_indices, int* column_indices, int solver_indexing,
+         MatrixOrder matrix_order) const {
+      this->model.compute_constraint_jacobian_sparsity(row_indices, column_indices, solver_indexing, matrix_order);
+      // the subsequent Jacobian evaluations are in this order
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->jacobian_order = matrix_order;
+   }
+
+   void CachedModel::evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const {
+      MatrixOrder matrix_order;
+      {
+         std::lock_guard<std::mutex> lock(this->mutex);
+         matrix_order = this->jacobian_order;
+         this->set_key(x, matrix_order);
+         if (const std::vector<double>* cached_jacobian = this->jacobian_cache.find(this->key)) {
+            std::copy(cached_jacobian->begin(), cached_jacobian->end(), jacobian_values);
+            return;
+         }
+      }
+      this->model.evaluate_constraint_jacobian(x, jacobian_values);
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->set_key(x, matrix_order);
+      std::vector<double>& cached_jacobian = this->jacobian_cache.insert(this->key);
+      cached_jacobian.assign(jacobian_values, jacobian_values + this->number_jacobian_nonzeros());
+   }
+
+   void CachedModel::evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+         double* hessian_values) const {
+      {
+         std::lock_guard<std::mutex> lock(this->mutex);
+         this->set_key(x, objective_multiplier, multipliers);
+         if (const std::vector<double>* cached_hessian = this->hessian_cache.find(this->key)) {
+            std::copy(cached_hessian->begin(), cached_hessian->end(), hessian_values);
+            return;
+         }
+      }
+      this->model.evaluate_lagrangian_hessian(x, objective_multiplier, multipliers, hessian_values);
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->set_key(x, objective_multiplier, multipliers);
+      std::vector<double>& cached_hessian = this->hessian_cache.insert(this->key);
+      cached_hessian.assign(hessian_values, hessian_values + this->number_hessian_nonzeros());
+   }
+
+   void CachedModel::print_hit_rates() const {
+      const auto print_hit_rate = [](const char* function_name, size_t hits, size_t misses) {
+         DISCRETE << "- " << function_name << ": " << hits << " hit(s) out of " << (hits + misses) << " evaluation(s)\n";
+      };
+      DISCRETE << "Evaluation cache:\n";
+      print_hit_rate("objective", this->objective_cache.hits(), this->objective_cache.misses());
+      print_hit_rate("constraints", this->constraint_cache.hits(), this->constraint_cache.misses());
+      print_hit_rate("objective gradient", this->objective_gradient_cache.hits(), this->objective_gradient_cache.misses());
+      print_hit_rate("Jacobian", this->jacobian_cache.hits(), this->jacobian_cache.misses());
+      print_hit_rate("Hessian", this->hessian_cache.hits(), this->hessian_cache.misses());
+   }
+
+   // private member functions
+
+   void CachedModel::set_key(const Vector<double>& x) const {
+      this->key.assign(x.begin(), x.begin() + static_cast<std::ptrdiff_t>(this->number_variables));
+   }
+
+   void CachedModel::set_key(const Vector<double>& x, MatrixOrder matrix_order) const {
+      this->set_key(x);
+      this->key.push_back(static_cast<double>(matrix_order));
+   }
+
+   void CachedModel::set_key(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers) const {
+      this->set_key(x);
+      this->key.push_back(objective_multiplier);
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         this->key.push_back(multipliers[constraint_index]);
+      }
+   }
+} // namespace
@@ -0,0 +1,100 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_CACHEDMODEL_H
+#define UNO_CACHEDMODEL_H
+
+#include <mutex>
+#include <vector>
+#include "EvaluationCache.hpp"
+#include "Model.hpp"
+#include "linear_algebra/MatrixOrder.hpp"
+#include "linear_algebra/Vector.hpp"
+
+namespace uno {
+   // forward declaration
+   class Options;
+
+   // the evaluations of the original model (objective, constraints, objective gradient, Jacobian and Lagrangian Hessian)
+   // are stored in separate LRU caches of evaluation_cache_capacity entries, keyed by the primal point (and the
+   // multipliers for the Hessian). The same point is evaluated once, e.g. when switching to the restoration phase or
+   // when the trust-region subproblem is re-solved at the unchanged current iterate.
+   // Since the order of the Jacobian nonzeros follows the last sparsity query, the matrix order of that query is part of
+   // the Jacobian key: the values cached in another order are not returned.
+   // The cache is thread-safe if the original model is
+   class CachedModel: public Model {
+   public:
+      CachedModel(const Model& original_model, const Options& options);
+
+      // availability of linear operators
+      [[nodiscard]] bool has_jacobian_operator() const override { return this->model.has_jacobian_operator(); }
+      [[nodiscard]] bool has_jacobian_transposed_operator() const override { return this->model.has_jacobian_transposed_operator(); }
+      [[nodiscard]] bool has_hessian_operator() const override { return this->model.has_hessian_operator(); }
+      [[nodiscard]] bool has_hessian_matrix() const override { return this->model.has_hessian_matrix(); }
+      [[nodiscard]] bool has_thread_safe_evaluations() const override { return this->model.has_thread_safe_evaluations(); }
+
+      // function evaluations
+      [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override;
+      void evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override;
+
+      // dense objective gradient
+      void evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const override;
+
+      // sparsity patterns of Jacobian and Hessian
+      void compute_constraint_jacobian_sparsity(int* row_indices, int* column_indices, int solver_indexing,
+         MatrixOrder matrix_order) const override;
+      void compute_hessian_sparsity(int* row_indices, int* column_indices, int solver_indexing) const override {
+         this->model.compute_hessian_sparsity(row_indices, column_indices, solver_indexing);
+      }
+
+      // numerical evaluations of Jacobian and Hessian
+      void evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const override;
+      void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+         double* hessian_values) const override;
+      // the products are not cached (the vector changes at each call)
+      void compute_hessian_vector_product(const double* x, const double* vector, double objective_multiplier,
+            const Vector<double>& multipliers, double* result) const override {
+         this->model.compute_hessian_vector_product(x, vector, objective_multiplier, multipliers, result);
+      }
+
+      [[nodiscard]] double variable_lower_bound(size_t variable_index) const override { return this->model.variable_lower_bound(variable_index); }
+      [[nodiscard]] double variable_upper_bound(size_t variable_index) const override { return this->model.variable_upper_bound(variable_index); }
+      [[nodiscard]] const SparseVector<size_t>& get_slacks() const override { return this->model.get_slacks(); }
+      [[nodiscard]] const Vector<size_t>& get_fixed_variables() const override { return this->model.get_fixed_variables(); }
+
+      [[nodiscard]] double constraint_lower_bound(size_t constraint_index) const override { return this->model.constraint_lower_bound(constraint_index); }
+      [[nodiscard]] double constraint_upper_bound(size_t constraint_index) const override { return this->model.constraint_upper_bound(constraint_index); }
+      [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override { return this->model.get_equality_constraints(); }
+      [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override { return this->model.get_inequality_constraints(); }
+      [[nodiscard]] const Collection<size_t>& get_linear_constraints() const override { return this->model.get_linear_constraints(); }
+
+      void initial_primal_point(Vector<double>& x) const override { this->model.initial_primal_point(x); }
+      void initial_dual_point(Vector<double>& multipliers) const override { this->model.initial_dual_point(multipliers); }
+      void postprocess_solution(Iterate& iterate) const override { this->model.postprocess_solution(iterate); }
+
+      [[nodiscard]] size_t number_jacobian_nonzeros() const override { return this->model.number_jacobian_nonzeros(); }
+      [[nodiscard]] size_t number_hessian_nonzeros() const override { return this->model.number_hessian_nonzeros(); }
+
+      void print_hit_rates() const;
+
+   private:
+      const Model& model;
+      mutable EvaluationCache<double> objective_cache;
+      mutable EvaluationCache<std::vector<double>> constraint_cache;
+      mutable EvaluationCache<Vector<double>> objective_gradient_cache;
+      mutable EvaluationCache<std::vector<double>> jacobian_cache;
+      mutable EvaluationCache<std::vector<double>> hessian_cache;
+      // key of the last query: the primal point (followed by the matrix order for the Jacobian, and by the objective
+      // multiplier and the multipliers for the Hessian)
+      mutable std::vector<double> key;
+      // order of the last Jacobian sparsity query
+      mutable MatrixOrder jacobian_order{MatrixOrder::COLUMN_MAJOR};
+      mutable std::mutex mutex{};
+
+      void set_key(const Vector<double>& x) const;
+      void set_key(const Vector<double>& x, MatrixOrder matrix_order) const;
+      void set_key(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers) const;
+   };
+} // namespace
+
+#endif // UNO_CACHEDMODEL_H
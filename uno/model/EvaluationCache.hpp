@@ -0,0 +1,85 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_EVALUATIONCACHE_H
+#define UNO_EVALUATIONCACHE_H
+
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <list>
+#include <vector>
+
+namespace uno {
+   // least-recently-used cache of the evaluations of a function, keyed by a vector of doubles (e.g. the primal point).
+   // The keys are compared bitwise after a hash comparison, so a cached value is returned only for exactly the same key.
+   // Once the cache is full, the least recently used entry (and its buffers) is recycled: a warm cache does not allocate
+   template <typename Value>
+   class EvaluationCache {
+   public:
+      explicit EvaluationCache(size_t capacity): capacity(capacity) { }
+
+      // returns the cached value if the key was found (the entry becomes the most recently used), nullptr otherwise
+      [[nodiscard]] const Value* find(const std::vector<double>& key) {
+         const uint64_t hash = EvaluationCache::hash(key);
+         for (auto entry_iterator = this->entries.begin(); entry_iterator != this->entries.end(); ++entry_iterator) {
+            if (entry_iterator->hash == hash && EvaluationCache::equal(entry_iterator->key, key)) {
+               this->entries.splice(this->entries.begin(), this->entries, entry_iterator);
+               ++this->number_hits;
+               return &this->entries.front().value;
+            }
+         }
+         ++this->number_misses;
+         return nullptr;
+      }
+
+      // returns the value of a new entry (most recently used) that the caller fills
+      [[nodiscard]] Value& insert(const std::vector<double>& key) {
+         if (this->entries.size() < this->capacity) {
+            this->entries.emplace_front();
+         }
+         else {
+            // recycle the least recently used entry
+            this->entries.splice(this->entries.begin(), this->entries, std::prev(this->entries.end()));
+         }
+         Entry& entry = this->entries.front();
+         entry.hash = EvaluationCache::hash(key);
+         entry.key = key;
+         return entry.value;
+      }
+
+      void clear() { this->entries.clear(); }
+
+      [[nodiscard]] size_t hits() const { return this->number_hits; }
+      [[nodiscard]] size_t misses() const { return this->number_misses; }
+
+   protected:
+      struct Entry {
+         uint64_t hash{0};
+         std::vector<double> key{};
+         Value value{};
+      };
+
+      const size_t capacity;
+      std::list<Entry> entries{}; // from the most recently used to the least recently used
+      size_t number_hits{0};
+      size_t number_misses{0};
+
+      // FNV-1a hash of the bit patterns
+      [[nodiscard]] static uint64_t hash(const std::vector<double>& key) {
+         uint64_t hash = 14695981039346656037ULL;
+         for (double element: key) {
+            uint64_t bits;
+            std::memcpy(&bits, &element, sizeof(double));
+            hash = (hash ^ bits) * 1099511628211ULL;
+         }
+         return hash;
+      }
+
+      [[nodiscard]] static bool equal(const std::vector<double>& key1, const std::vector<double>& key2) {
+         return key1.size() == key2.size() && (key1.empty() || std::memcmp(key1.data(), key2.data(), key1.size() * sizeof(double)) == 0);
+      }
+   };
+} // namespace
+
+#endif // UNO_EVALUATIONCACHE_H
@@ -0,0 +1,260 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "FiniteDifferenceModel.hpp"
+#include "options/Options.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   // forward differences of functions: the error is minimized with steps of the order of sqrt(eps). The Hessian is a
+   // difference of differences: the steps of both levels are of the order of cbrt(eps)
+   static const double FIRST_ORDER_RELATIVE_STEP = std::sqrt(std::numeric_limits<double>::epsilon());
+   static const double SECOND_ORDER_RELATIVE_STEP = std::cbrt(std::numeric_limits<double>::epsilon());
+
+   FiniteDifferenceModel::FiniteDifferenceModel(const Model& original_model, const Options& options):
+         Model(original_model.name + " -> finite differences", original_model.number_variables, original_model.number_constraints,
+            original_model.objective_sign),
+         model(original_model),
+         thread_pool(std::max(size_t(1), options.get_unsigned_int("finite_difference_threads"))),
+         workspaces(this->thread_pool.size()),
+         jacobian_row_indices(original_model.number_jacobian_nonzeros()),
+         jacobian_column_indices(original_model.number_jacobian_nonzeros()),
+         constraints(original_model.number_constraints),
+         current_point(original_model.number_variables),
+         gradient_steps(original_model.number_variables),
+         hessian_steps(original_model.number_variables) {
+      for (Workspace& workspace: this->workspaces) {
+         workspace.point.resize(this->number_variables);
+         workspace.perturbed_point.resize(this->number_variables);
+         workspace.constraints.resize(this->number_constraints);
+         workspace.perturbed_constraints.resize(this->number_constraints);
+      }
+      this->compute_jacobian_coloring();
+      this->compute_hessian_coloring();
+      this->jacobian_differences.resize(this->jacobian_coloring.number_colors, std::vector<double>(this->number_constraints));
+      // the Hessian-vector product requires two Lagrangian gradients
+      this->lagrangian_gradients.resize(std::max(size_t(2), this->hessian_coloring.number_colors + 1),
+         Vector<double>(this->number_variables));
+      DEBUG << "Finite differences: " << this->jacobian_coloring.number_colors << " Jacobian colors and " <<
+         this->hessian_coloring.number_colors << " Hessian colors for " << this->number_variables << " variables, " <<
+         this->thread_pool.size() << " thread(s)\n";
+   }
+
+   void FiniteDifferenceModel::evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const {
+      const std::lock_guard<std::mutex> lock(this->evaluation_mutex);
+      this->compute_steps(x, FIRST_ORDER_RELATIVE_STEP, this->gradient_steps);
+      const double objective = this->model.evaluate_objective(x);
+      for (Workspace& workspace: this->workspaces) {
+         workspace.point = x;
+      }
+      this->thread_pool.parallel_for(this->number_variables, [&](size_t variable_index, size_t thread_index) {
+         Vector<double>& point = this->workspaces[thread_index].point;
+         point[variable_index] += this->gradient_steps[variable_index];
+         gradient[variable_index] = (this->model.evaluate_objective(point) - objective) / this->gradient_steps[variable_index];
+         point[variable_index] = x[variable_index];
+      });
+   }
+
+   void FiniteDifferenceModel::compute_constraint_jacobian_sparsity(int* row_indices, int* column_indices, int solver_indexing,
+         MatrixOrder matrix_order) const {
+      const std::lock_guard<std::mutex> lock(this->evaluation_mutex);
+      this->model.compute_constraint_jacobian_sparsity(row_indices, column_indices, solver_indexing, matrix_order);
+      // the order of the nonzeros may depend on the matrix order: register the row and column of each nonzero
+      for (size_t nonzero_index: Range(this->number_jacobian_nonzeros())) {
+         this->jacobian_row_indices[nonzero_index] = static_cast<size_t>(row_indices[nonzero_index] - solver_indexing);
+         this->jacobian_column_indices[nonzero_index] = static_cast<size_t>(column_indices[nonzero_index] - solver_indexing);
+      }
+   }
+
+   // compressed forward differences: the columns of a given color are perturbed simultaneously
+   void FiniteDifferenceModel::evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const {
+      const std::lock_guard<std::mutex> lock(this->evaluation_mutex);
+      this->compute_steps(x, FIRST_ORDER_RELATIVE_STEP, this->gradient_steps);
+      this->model.evaluate_constraints(x, this->constraints);
+      this->thread_pool.parallel_for(this->jacobian_coloring.number_colors, [&](size_t color, size_t thread_index) {
+         Vector<double>& point = this->workspaces[thread_index].point;
+         point = x;
+         for (size_t variable_index: this->jacobian_color_columns[color]) {
+            point[variable_index] += this->gradient_steps[variable_index];
+         }
+         this->model.evaluate_constraints(point, this->jacobian_differences[color]);
+      });
+      for (size_t nonzero_index: Range(this->number_jacobian_nonzeros())) {
+         const size_t constraint_index = this->jacobian_row_indices[nonzero_index];
+         const size_t variable_index = this->jacobian_column_indices[nonzero_index];
+         const std::vector<double>& perturbed_constraints = this->jacobian_differences[this->jacobian_coloring.colors[variable_index]];
+         jacobian_values[nonzero_index] = (perturbed_constraints[constraint_index] - this->constraints[constraint_index]) /
+            this->gradient_steps[variable_index];
+      }
+   }
+
+   // compressed differences of the Lagrangian gradient: the variables of a given color are perturbed simultaneously
+   void FiniteDifferenceModel::evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier,
+         const Vector<double>& multipliers, double* hessian_values) const {
+      const std::lock_guard<std::mutex> lock(this->evaluation_mutex);
+      this->compute_steps(x, SECOND_ORDER_RELATIVE_STEP, this->gradient_steps);
+      this->compute_steps(x, SECOND_ORDER_RELATIVE_STEP, this->hessian_steps);
+      // the gradient at x (index 0) and at the perturbed points (one per color)
+      this->thread_pool.parallel_for(this->hessian_coloring.number_colors + 1, [&](size_t index, size_t thread_index) {
+         Workspace& workspace = this->workspaces[thread_index];
+         workspace.perturbed_point = x;
+         if (0 < index) {
+            for (size_t variable_index: this->hessian_color_variables[index - 1]) {
+               workspace.perturbed_point[variable_index] += this->hessian_steps[variable_index];
+            }
+         }
+         this->evaluate_lagrangian_gradient(workspace.perturbed_point, objective_multiplier, multipliers, workspace,
+            this->lagrangian_gradients[index]);
+      });
+      const Vector<double>& gradient = this->lagrangian_gradients[0];
+      for (size_t nonzero_index: Range(this->number_hessian_nonzeros())) {
+         const size_t row_index = this->hessian_source_rows[nonzero_index];
+         const size_t variable_index = this->hessian_source_variables[nonzero_index];
+         const Vector<double>& perturbed_gradient = this->lagrangian_gradients[this->hessian_source_colors[nonzero_index] + 1];
+         hessian_values[nonzero_index] = (perturbed_gradient[row_index] - gradient[row_index]) / this->hessian_steps[variable_index];
+      }
+   }
+
+   // directional difference of the Lagrangian gradient
+   void FiniteDifferenceModel::compute_hessian_vector_product(const double* x, const double* vector, double objective_multiplier,
+         const Vector<double>& multipliers, double* result) const {
+      const std::lock_guard<std::mutex> lock(this->evaluation_mutex);
+      double vector_norm = 0.;
+      double point_norm = 0.;
+      for (size_t variable_index: Range(this->number_variables)) {
+         this->current_point[variable_index] = x[variable_index];
+         vector_norm = std::max(vector_norm, std::abs(vector[variable_index]));
+         point_norm = std::max(point_norm, std::abs(x[variable_index]));
+      }
+      if (vector_norm == 0.) {
+         std::fill(result, result + this->number_variables, 0.);
+         return;
+      }
+      this->compute_steps(this->current_point, SECOND_ORDER_RELATIVE_STEP, this->gradient_steps);
+      const double step = SECOND_ORDER_RELATIVE_STEP * std::max(1., point_norm) / vector_norm;
+      this->thread_pool.parallel_for(2, [&](size_t index, size_t thread_index) {
+         Workspace& workspace = this->workspaces[thread_index];
+         workspace.perturbed_point = this->current_point;
+         if (index == 1) {
+            for (size_t variable_index: Range(this->number_variables)) {
+               workspace.perturbed_point[variable_index] += step * vector[variable_index];
+            }
+         }
+         this->evaluate_lagrangian_gradient(workspace.perturbed_point, objective_multiplier, multipliers, workspace,
+            this->lagrangian_gradients[index]);
+      });
+      for (size_t variable_index: Range(this->number_variables)) {
+         result[variable_index] = (this->lagrangian_gradients[1][variable_index] - this->lagrangian_gradients[0][variable_index]) / step;
+      }
+   }
+
+   // protected member functions
+
+   void FiniteDifferenceModel::compute_jacobian_coloring() {
+      std::vector<int> row_indices(this->number_jacobian_nonzeros());
+      std::vector<int> column_indices(this->number_jacobian_nonzeros());
+      this->compute_constraint_jacobian_sparsity(row_indices.data(), column_indices.data(), 0, MatrixOrder::COLUMN_MAJOR);
+      this->jacobian_coloring = GraphColoring::column_coloring(this->number_constraints, this->number_variables,
+         this->jacobian_row_indices, this->jacobian_column_indices);
+
+      this->jacobian_color_columns.resize(this->jacobian_coloring.number_colors);
+      for (size_t variable_index: Range(this->number_variables)) {
+         this->jacobian_color_columns[this->jacobian_coloring.colors[variable_index]].push_back(variable_index);
+      }
+      this->jacobian_column_rows.resize(this->number_variables);
+      for (size_t nonzero_index: Range(this->number_jacobian_nonzeros())) {
+         this->jacobian_column_rows[this->jacobian_column_indices[nonzero_index]].push_back(this->jacobian_row_indices[nonzero_index]);
+      }
+   }
+
+   void FiniteDifferenceModel::compute_hessian_coloring() {
+      const size_t number_nonzeros = this->number_hessian_nonzeros();
+      std::vector<int> row_indices(number_nonzeros);
+      std::vector<int> column_indices(number_nonzeros);
+      this->model.compute_hessian_sparsity(row_indices.data(), column_indices.data(), 0);
+      std::vector<size_t> rows(number_nonzeros);
+      std::vector<size_t> columns(number_nonzeros);
+      for (size_t nonzero_index: Range(number_nonzeros)) {
+         rows[nonzero_index] = static_cast<size_t>(row_indices[nonzero_index]);
+         columns[nonzero_index] = static_cast<size_t>(column_indices[nonzero_index]);
+      }
+      this->hessian_coloring = GraphColoring::star_coloring(this->number_variables, rows, columns);
+      const std::vector<size_t>& colors = this->hessian_coloring.colors;
+
+      this->hessian_color_variables.resize(this->hessian_coloring.number_colors);
+      for (size_t variable_index: Range(this->number_variables)) {
+         this->hessian_color_variables[colors[variable_index]].push_back(variable_index);
+      }
+
+      // recovery of the nonzeros: the nonzero (i, j) is read in the row i of the compressed column color(j) if j is the
+      // only neighbor of i with this color, otherwise in the row j of the compressed column color(i)
+      const std::vector<std::vector<size_t>> adjacency = GraphColoring::adjacency_lists(this->number_variables, rows, columns);
+      const auto is_only_neighbor_with_color = [&](size_t vertex, size_t neighbor) {
+         return std::count_if(adjacency[vertex].begin(), adjacency[vertex].end(), [&](size_t other_neighbor) {
+            return colors[other_neighbor] == colors[neighbor];
+         }) == 1;
+      };
+      this->hessian_source_rows.resize(number_nonzeros);
+      this->hessian_source_colors.resize(number_nonzeros);
+      this->hessian_source_variables.resize(number_nonzeros);
+      for (size_t nonzero_index: Range(number_nonzeros)) {
+         size_t row_index = rows[nonzero_index];
+         size_t column_index = columns[nonzero_index];
+         if (row_index != column_index && !is_only_neighbor_with_color(row_index, column_index)) {
+            std::swap(row_index, column_index);
+         }
+         this->hessian_source_rows[nonzero_index] = row_index;
+         this->hessian_source_colors[nonzero_index] = colors[column_index];
+         this->hessian_source_variables[nonzero_index] = column_index;
+      }
+   }
+
+   // relative steps, reversed when they would cross the upper bound of the variable
+   void FiniteDifferenceModel::compute_steps(const Vector<double>& x, double relative_step, Vector<double>& steps) const {
+      for (size_t variable_index: Range(this->number_variables)) {
+         steps[variable_index] = relative_step * std::max(1., std::abs(x[variable_index]));
+         if (this->model.variable_upper_bound(variable_index) < x[variable_index] + steps[variable_index]) {
+            steps[variable_index] = -steps[variable_index];
+         }
+      }
+   }
+
+   // sequential forward differences of the Lagrangian gradient rho grad f(x) - J(x)^T y, with the steps this->gradient_steps
+   void FiniteDifferenceModel::evaluate_lagrangian_gradient(const Vector<double>& x, double objective_multiplier,
+         const Vector<double>& multipliers, Workspace& workspace, Vector<double>& gradient) const {
+      gradient.fill(0.);
+      workspace.point = x;
+      // objective gradient
+      if (objective_multiplier != 0.) {
+         const double objective = this->model.evaluate_objective(x);
+         for (size_t variable_index: Range(this->number_variables)) {
+            workspace.point[variable_index] += this->gradient_steps[variable_index];
+            gradient[variable_index] = objective_multiplier * (this->model.evaluate_objective(workspace.point) - objective) /
+               this->gradient_steps[variable_index];
+            workspace.point[variable_index] = x[variable_index];
+         }
+      }
+      // Jacobian-transposed product, with compressed differences
+      if (0 < this->number_constraints) {
+         this->model.evaluate_constraints(x, workspace.constraints);
+         for (const std::vector<size_t>& color_columns: this->jacobian_color_columns) {
+            for (size_t variable_index: color_columns) {
+               workspace.point[variable_index] += this->gradient_steps[variable_index];
+            }
+            this->model.evaluate_constraints(workspace.point, workspace.perturbed_constraints);
+            for (size_t variable_index: color_columns) {
+               workspace.point[variable_index] = x[variable_index];
+               for (size_t constraint_index: this->jacobian_column_rows[variable_index]) {
+                  const double derivative = (workspace.perturbed_constraints[constraint_index] - workspace.constraints[constraint_index]) /
+                     this->gradient_steps[variable_index];
+                  gradient[variable_index] -= multipliers[constraint_index] * derivative;
+               }
+            }
+         }
+      }
+   }
+} // namespace
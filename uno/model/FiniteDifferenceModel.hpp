@@ -0,0 +1,134 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_FINITEDIFFERENCEMODEL_H
+#define UNO_FINITEDIFFERENCEMODEL_H
+
+#include <mutex>
+#include <vector>
+#include "Model.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "tools/GraphColoring.hpp"
+#include "tools/ThreadPool.hpp"
+
+namespace uno {
+   // forward declaration
+   class Options;
+
+   // derivatives of a model that provides only function values and the sparsity patterns of its Jacobian and Lagrangian
+   // Hessian. The derivatives of the original model are never evaluated:
+   // - objective gradient: forward differences (one objective evaluation per variable);
+   // - constraint Jacobian: compressed forward differences along the colors of a Curtis-Powell-Reid coloring of the
+   //   columns (one constraint evaluation per color);
+   // - Lagrangian Hessian: compressed differences of the (finite-difference) Lagrangian gradient along the colors of a
+   //   star coloring of the Hessian pattern (one Lagrangian gradient per color);
+   // - Hessian-vector products: directional differences of the Lagrangian gradient.
+   // The perturbed evaluations are distributed over finite_difference_threads threads; with more than one thread, the
+   // function evaluations of the original model must be thread-safe.
+   // The derivative evaluations are const but share the mutable buffers (steps, perturbed points, differences) and the
+   // thread pool: they are serialized by a mutex, so that the model may be shared by concurrent solves (that query the
+   // Jacobian sparsity in the same matrix order)
+   class FiniteDifferenceModel: public Model {
+   public:
+      FiniteDifferenceModel(const Model& original_model, const Options& options);
+
+      // availability of linear operators
+      [[nodiscard]] bool has_jacobian_operator() const override { return true; }
+      [[nodiscard]] bool has_jacobian_transposed_operator() const override { return true; }
+      [[nodiscard]] bool has_hessian_operator() const override { return true; }
+      [[nodiscard]] bool has_hessian_matrix() const override { return true; }
+      [[nodiscard]] bool has_thread_safe_evaluations() const override { return this->model.has_thread_safe_evaluations(); }
+
+      // function evaluations
+      [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override { return this->model.evaluate_objective(x); }
+      void evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override {
+         this->model.evaluate_constraints(x, constraints);
+      }
+
+      // dense objective gradient
+      void evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const override;
+
+      // sparsity patterns of Jacobian and Hessian
+      void compute_constraint_jacobian_sparsity(int* row_indices, int* column_indices, int solver_indexing,
+         MatrixOrder matrix_order) const override;
+      void compute_hessian_sparsity(int* row_indices, int* column_indices, int solver_indexing) const override {
+         this->model.compute_hessian_sparsity(row_indices, column_indices, solver_indexing);
+      }
+
+      // numerical evaluations of Jacobian and Hessian
+      void evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const override;
+      void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+         double* hessian_values) const override;
+      void compute_hessian_vector_product(const double* x, const double* vector, double objective_multiplier,
+         const Vector<double>& multipliers, double* result) const override;
+
+      [[nodiscard]] double variable_lower_bound(size_t variable_index) const override { return this->model.variable_lower_bound(variable_index); }
+      [[nodiscard]] double variable_upper_bound(size_t variable_index) const override { return this->model.variable_upper_bound(variable_index); }
+      [[nodiscard]] const SparseVector<size_t>& get_slacks() const override { return this->model.get_slacks(); }
+      [[nodiscard]] const Vector<size_t>& get_fixed_variables() const override { return this->model.get_fixed_variables(); }
+
+      [[nodiscard]] double constraint_lower_bound(size_t constraint_index) const override { return this->model.constraint_lower_bound(constraint_index); }
+      [[nodiscard]] double constraint_upper_bound(size_t constraint_index) const override { return this->model.constraint_upper_bound(constraint_index); }
+      [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override { return this->model.get_equality_constraints(); }
+      [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override { return this->model.get_inequality_constraints(); }
+      [[nodiscard]] const Collection<size_t>& get_linear_constraints() const override { return this->model.get_linear_constraints(); }
+
+      void initial_primal_point(Vector<double>& x) const override { this->model.initial_primal_point(x); }
+      void initial_dual_point(Vector<double>& multipliers) const override { this->model.initial_dual_point(multipliers); }
+      void postprocess_solution(Iterate& iterate) const override { this->model.postprocess_solution(iterate); }
+
+      [[nodiscard]] size_t number_jacobian_nonzeros() const override { return this->model.number_jacobian_nonzeros(); }
+      [[nodiscard]] size_t number_hessian_nonzeros() const override { return this->model.number_hessian_nonzeros(); }
+
+      [[nodiscard]] size_t number_jacobian_colors() const { return this->jacobian_coloring.number_colors; }
+      [[nodiscard]] size_t number_hessian_colors() const { return this->hessian_coloring.number_colors; }
+
+   protected:
+      // per-thread buffers of the perturbed evaluations
+      struct Workspace {
+         Vector<double> point;
+         Vector<double> perturbed_point;
+         std::vector<double> constraints;
+         std::vector<double> perturbed_constraints;
+      };
+
+      const Model& model;
+      // the buffers below and the thread pool are used by one derivative evaluation at a time
+      mutable std::mutex evaluation_mutex;
+      mutable ThreadPool thread_pool;
+      mutable std::vector<Workspace> workspaces;
+
+      // Jacobian: coloring of the columns, columns of each color and rows of each column
+      Coloring jacobian_coloring{};
+      std::vector<std::vector<size_t>> jacobian_color_columns;
+      std::vector<std::vector<size_t>> jacobian_column_rows;
+      // row and column of each Jacobian nonzero, in the order of the last sparsity query
+      mutable std::vector<size_t> jacobian_row_indices;
+      mutable std::vector<size_t> jacobian_column_indices;
+      mutable std::vector<double> constraints;
+      mutable std::vector<std::vector<double>> jacobian_differences;
+
+      // Hessian: coloring of the variables and variables of each color. Each nonzero is recovered from the row
+      // hessian_source_rows[k] of the compressed column hessian_source_colors[k], divided by the step of the variable
+      // hessian_source_variables[k]
+      Coloring hessian_coloring{};
+      std::vector<std::vector<size_t>> hessian_color_variables;
+      std::vector<size_t> hessian_source_rows;
+      std::vector<size_t> hessian_source_colors;
+      std::vector<size_t> hessian_source_variables;
+      // Lagrangian gradients at the current point (index 0) and at the perturbed points (one per color)
+      mutable std::vector<Vector<double>> lagrangian_gradients;
+
+      mutable Vector<double> current_point;
+      mutable Vector<double> gradient_steps;
+      mutable Vector<double> hessian_steps;
+
+      void compute_jacobian_coloring();
+      void compute_hessian_coloring();
+      void compute_steps(const Vector<double>& x, double relative_step, Vector<double>& steps) const;
+      void evaluate_lagrangian_gradient(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+         Workspace& workspace, Vector<double>& gradient) const;
+   };
+} // namespace
+
+#endif // UNO_FINITEDIFFERENCEMODEL_H
@@ -31,6 +31,10 @@ namespace uno {
       return this->model.has_hessian_matrix();
    }
 
+   bool FixedBoundsConstraintsModel::has_thread_safe_evaluations() const {
+      return this->model.has_thread_safe_evaluations();
+   }
+
    double FixedBoundsConstraintsModel::evaluate_objective(const Vector<double>& x) const {
       return this->model.evaluate_objective(x);
    }
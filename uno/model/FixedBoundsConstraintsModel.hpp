@@ -25,6 +25,7 @@ namespace uno {
       [[nodiscard]] bool has_jacobian_transposed_operator() const override;
       [[nodiscard]] bool has_hessian_operator() const override;
       [[nodiscard]] bool has_hessian_matrix() const override;
+      [[nodiscard]] bool has_thread_safe_evaluations() const override;
 
       // function evaluations
       [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override;
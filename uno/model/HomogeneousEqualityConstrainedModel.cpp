@@ -46,6 +46,10 @@ namespace uno {
       return this->model.has_hessian_matrix();
    }
 
+   bool HomogeneousEqualityConstrainedModel::has_thread_safe_evaluations() const {
+      return this->model.has_thread_safe_evaluations();
+   }
+
    double HomogeneousEqualityConstrainedModel::evaluate_objective(const Vector<double>& x) const {
       return this->model.evaluate_objective(x);
    }
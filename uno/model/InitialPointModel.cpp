@@ -0,0 +1,20 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+#include "InitialPointModel.hpp"
+
+namespace uno {
+   InitialPointModel::InitialPointModel(const Model& original_model, Vector<double> initial_primals):
+         Model(original_model.name, original_model.number_variables, original_model.number_constraints, original_model.objective_sign),
+         model(original_model),
+         initial_primals(std::move(initial_primals)) {
+      assert(this->initial_primals.size() == this->number_variables && "The initial point does not have the right size");
+   }
+
+   void InitialPointModel::initial_primal_point(Vector<double>& x) const {
+      std::copy(this->initial_primals.begin(), this->initial_primals.end(), x.begin());
+   }
+} // namespace
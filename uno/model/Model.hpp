@@ -40,6 +40,9 @@ namespace uno {
       [[nodiscard]] virtual bool has_jacobian_transposed_operator() const = 0;
       [[nodiscard]] virtual bool has_hessian_operator() const = 0;
       [[nodiscard]] virtual bool has_hessian_matrix() const = 0;
+      // the function evaluations (objective and constraints) may be called concurrently, e.g. by the speculative line search.
+      // Models that keep an internal evaluation state (e.g. AMPL) are not thread-safe
+      [[nodiscard]] virtual bool has_thread_safe_evaluations() const { return false; }
 
       // function evaluations
       [[nodiscard]] virtual double evaluate_objective(const Vector<double>& x) const = 0;
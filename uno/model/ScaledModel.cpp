@@ -0,0 +1,185 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include "ScaledModel.hpp"
+#include "linear_algebra/Indexing.hpp"
+#include "optimization/Iterate.hpp"
+#include "options/Options.hpp"
+#include "symbolic/Range.hpp"
+#include "tools/Logger.hpp"
+
+namespace uno {
+   ScaledModel::ScaledModel(const Model& original_model, const Options& options):
+         Model(original_model.name + " -> scaled", original_model.number_variables, original_model.number_constraints,
+            original_model.objective_sign),
+         model(original_model),
+         gradient_threshold(options.get_double("function_scaling_threshold")),
+         scaling_factor(options.get_double("function_scaling_factor")),
+         minimum_scaling(options.get_double("function_scaling_min_value")),
+         progress_norm(norm_from_string(options.get_string("progress_norm"))),
+         residual_norm(norm_from_string(options.get_string("residual_norm"))),
+         constraint_scaling(original_model.number_constraints, 1.),
+         jacobian_row_indices(original_model.number_jacobian_nonzeros()),
+         scaled_multipliers(original_model.number_constraints) {
+      assert(0. < this->gradient_threshold && "The function scaling threshold should be positive");
+      assert(0. < this->scaling_factor && "The function scaling factor should be positive");
+      this->compute_scaling();
+   }
+
+   double ScaledModel::evaluate_objective(const Vector<double>& x) const {
+      return this->objective_scaling * this->model.evaluate_objective(x);
+   }
+
+   void ScaledModel::evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const {
+      this->model.evaluate_constraints(x, constraints);
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         constraints[constraint_index] *= this->constraint_scaling[constraint_index];
+      }
+   }
+
+   void ScaledModel::evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const {
+      this->model.evaluate_objective_gradient(x, gradient);
+      gradient.scale(this->objective_scaling);
+   }
+
+   void ScaledModel::compute_constraint_jacobian_sparsity(int* row_indices, int* column_indices, int solver_indexing,
+         MatrixOrder matrix_order) const {
+      this->model.compute_constraint_jacobian_sparsity(row_indices, column_indices, solver_indexing, matrix_order);
+      // the order of the nonzeros may depend on the matrix order: register the constraint of each nonzero
+      for (size_t nonzero_index: Range(this->number_jacobian_nonzeros())) {
+         this->jacobian_row_indices[nonzero_index] = static_cast<size_t>(row_indices[nonzero_index] - solver_indexing);
+      }
+   }
+
+   void ScaledModel::evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const {
+      this->model.evaluate_constraint_jacobian(x, jacobian_values);
+      for (size_t nonzero_index: Range(this->number_jacobian_nonzeros())) {
+         jacobian_values[nonzero_index] *= this->constraint_scaling[this->jacobian_row_indices[nonzero_index]];
+      }
+   }
+
+   // the Lagrangian Hessian of the scaled model is the Lagrangian Hessian of the original model with scaled multipliers
+   void ScaledModel::evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+         double* hessian_values) const {
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         this->scaled_multipliers[constraint_index] = this->constraint_scaling[constraint_index] * multipliers[constraint_index];
+      }
+      this->model.evaluate_lagrangian_hessian(x, this->objective_scaling * objective_multiplier, this->scaled_multipliers, hessian_values);
+   }
+
+   void ScaledModel::compute_hessian_vector_product(const double* x, const double* vector, double objective_multiplier,
+         const Vector<double>& multipliers, double* result) const {
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         this->scaled_multipliers[constraint_index] = this->constraint_scaling[constraint_index] * multipliers[constraint_index];
+      }
+      this->model.compute_hessian_vector_product(x, vector, this->objective_scaling * objective_multiplier, this->scaled_multipliers,
+         result);
+   }
+
+   double ScaledModel::constraint_lower_bound(size_t constraint_index) const {
+      return this->constraint_scaling[constraint_index] * this->model.constraint_lower_bound(constraint_index);
+   }
+
+   double ScaledModel::constraint_upper_bound(size_t constraint_index) const {
+      return this->constraint_scaling[constraint_index] * this->model.constraint_upper_bound(constraint_index);
+   }
+
+   void ScaledModel::initial_dual_point(Vector<double>& multipliers) const {
+      this->model.initial_dual_point(multipliers);
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         multipliers[constraint_index] *= this->objective_scaling / this->constraint_scaling[constraint_index];
+      }
+   }
+
+   // map the solution of the scaled model back to the original model
+   void ScaledModel::postprocess_solution(Iterate& iterate) const {
+      // multipliers: in the optimality phase, the scaled Lagrangian is divided by the objective scaling
+      const double multiplier_scaling = (0. < iterate.objective_multiplier) ? 1. / this->objective_scaling : 1.;
+      for (size_t constraint_index: Range(this->number_constraints)) {
+         iterate.multipliers.constraints[constraint_index] *= multiplier_scaling * this->constraint_scaling[constraint_index];
+      }
+      for (size_t variable_index: Range(this->number_variables)) {
+         iterate.multipliers.lower_bounds[variable_index] *= multiplier_scaling;
+         iterate.multipliers.upper_bounds[variable_index] *= multiplier_scaling;
+      }
+      // dual residuals: the scaled Lagrangian gradient and the complementarity products scale like the multipliers
+      iterate.residuals.stationarity *= multiplier_scaling;
+      iterate.residuals.complementarity *= multiplier_scaling;
+
+      // objective and constraints
+      iterate.evaluations.objective /= this->objective_scaling;
+      for (size_t variable_index: Range(this->number_variables)) {
+         iterate.evaluations.objective_gradient[variable_index] /= this->objective_scaling;
+      }
+      if (this->is_constrained()) {
+         // the constraints of the reformulated models (e.g. with slacks) may differ from the original ones: reevaluate them
+         std::vector<double> constraints(this->number_constraints);
+         this->model.evaluate_constraints(iterate.primals, constraints);
+         std::copy(constraints.cbegin(), constraints.cend(), iterate.evaluations.constraints.begin());
+         iterate.progress.infeasibility = this->model.constraint_violation(constraints, this->progress_norm);
+         iterate.primal_feasibility = this->model.constraint_violation(constraints, this->residual_norm);
+      }
+      this->model.postprocess_solution(iterate);
+   }
+
+   double ScaledModel::get_objective_scaling() const {
+      return this->objective_scaling;
+   }
+
+   double ScaledModel::get_constraint_scaling(size_t constraint_index) const {
+      return this->constraint_scaling[constraint_index];
+   }
+
+   // compute the scaling factors from the gradients at the (projected) initial point
+   void ScaledModel::compute_scaling() {
+      Vector<double> x(this->number_variables);
+      this->model.initial_primal_point(x);
+      this->model.project_onto_variable_bounds(x);
+
+      try {
+         // objective scaling
+         Vector<double> objective_gradient(this->number_variables);
+         this->model.evaluate_objective_gradient(x, objective_gradient);
+         this->objective_scaling = this->gradient_based_scaling(norm_inf(objective_gradient));
+
+         // constraint scaling: infinity norm of each row of the Jacobian
+         if (this->is_constrained()) {
+            const size_t number_jacobian_nonzeros = this->number_jacobian_nonzeros();
+            std::vector<int> row_indices(number_jacobian_nonzeros);
+            std::vector<int> column_indices(number_jacobian_nonzeros);
+            this->compute_constraint_jacobian_sparsity(row_indices.data(), column_indices.data(), Indexing::C_indexing,
+               MatrixOrder::COLUMN_MAJOR);
+            std::vector<double> jacobian_values(number_jacobian_nonzeros);
+            this->model.evaluate_constraint_jacobian(x, jacobian_values.data());
+
+            Vector<double> constraint_gradient_norms(this->number_constraints, 0.);
+            for (size_t nonzero_index: Range(number_jacobian_nonzeros)) {
+               const size_t constraint_index = this->jacobian_row_indices[nonzero_index];
+               constraint_gradient_norms[constraint_index] = std::max(constraint_gradient_norms[constraint_index],
+                  std::abs(jacobian_values[nonzero_index]));
+            }
+            for (size_t constraint_index: Range(this->number_constraints)) {
+               this->constraint_scaling[constraint_index] = this->gradient_based_scaling(constraint_gradient_norms[constraint_index]);
+            }
+         }
+      }
+      catch (const std::exception& exception) {
+         WARNING << "The gradients could not be evaluated at the initial point (" << exception.what() << "), the model is not scaled\n";
+         this->objective_scaling = 1.;
+         this->constraint_scaling.fill(1.);
+      }
+      DEBUG << "Objective scaling: " << this->objective_scaling << '\n';
+      DEBUG << "Constraint scaling: " << this->constraint_scaling << '\n';
+   }
+
+   // scale a function only if its gradient is larger than the threshold
+   double ScaledModel::gradient_based_scaling(double gradient_norm) const {
+      if (gradient_norm <= this->gradient_threshold || !std::isfinite(gradient_norm)) {
+         return 1.;
+      }
+      return std::max(this->minimum_scaling, this->scaling_factor / gradient_norm);
+   }
+} // namespace
@@ -0,0 +1,90 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_SCALEDMODEL_H
+#define UNO_SCALEDMODEL_H
+
+#include <vector>
+#include "Model.hpp"
+#include "linear_algebra/Vector.hpp"
+
+namespace uno {
+   // forward declaration
+   class Options;
+
+   // gradient-based scaling of the objective and the constraints, computed at the initial point (as in IPOPT):
+   // f~(x) = s_f f(x) and c~_j(x) = s_j c_j(x), where a scaling factor < 1 is applied to each function whose
+   // gradient norm at the initial point exceeds a threshold. The variables are not scaled
+   class ScaledModel: public Model {
+   public:
+      ScaledModel(const Model& original_model, const Options& options);
+
+      // availability of linear operators
+      [[nodiscard]] bool has_jacobian_operator() const override { return this->model.has_jacobian_operator(); }
+      [[nodiscard]] bool has_jacobian_transposed_operator() const override { return this->model.has_jacobian_transposed_operator(); }
+      [[nodiscard]] bool has_hessian_operator() const override { return this->model.has_hessian_operator(); }
+      [[nodiscard]] bool has_hessian_matrix() const override { return this->model.has_hessian_matrix(); }
+      [[nodiscard]] bool has_thread_safe_evaluations() const override { return this->model.has_thread_safe_evaluations(); }
+
+      // function evaluations
+      [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override;
+      void evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override;
+
+      // dense objective gradient
+      void evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const override;
+
+      // sparsity patterns of Jacobian and Hessian
+      void compute_constraint_jacobian_sparsity(int* row_indices, int* column_indices, int solver_indexing,
+         MatrixOrder matrix_order) const override;
+      void compute_hessian_sparsity(int* row_indices, int* column_indices, int solver_indexing) const override {
+         this->model.compute_hessian_sparsity(row_indices, column_indices, solver_indexing);
+      }
+
+      // numerical evaluations of Jacobian and Hessian
+      void evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const override;
+      void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+         double* hessian_values) const override;
+      void compute_hessian_vector_product(const double* x, const double* vector, double objective_multiplier,
+         const Vector<double>& multipliers, double* result) const override;
+
+      // the variable bounds are not affected by the scaling
+      [[nodiscard]] double variable_lower_bound(size_t variable_index) const override { return this->model.variable_lower_bound(variable_index); }
+      [[nodiscard]] double variable_upper_bound(size_t variable_index) const override { return this->model.variable_upper_bound(variable_index); }
+      [[nodiscard]] const SparseVector<size_t>& get_slacks() const override { return this->model.get_slacks(); }
+      [[nodiscard]] const Vector<size_t>& get_fixed_variables() const override { return this->model.get_fixed_variables(); }
+
+      [[nodiscard]] double constraint_lower_bound(size_t constraint_index) const override;
+      [[nodiscard]] double constraint_upper_bound(size_t constraint_index) const override;
+      [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override { return this->model.get_equality_constraints(); }
+      [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override { return this->model.get_inequality_constraints(); }
+      [[nodiscard]] const Collection<size_t>& get_linear_constraints() const override { return this->model.get_linear_constraints(); }
+
+      void initial_primal_point(Vector<double>& x) const override { this->model.initial_primal_point(x); }
+      void initial_dual_point(Vector<double>& multipliers) const override;
+      void postprocess_solution(Iterate& iterate) const override;
+
+      [[nodiscard]] size_t number_jacobian_nonzeros() const override { return this->model.number_jacobian_nonzeros(); }
+      [[nodiscard]] size_t number_hessian_nonzeros() const override { return this->model.number_hessian_nonzeros(); }
+
+      [[nodiscard]] double get_objective_scaling() const;
+      [[nodiscard]] double get_constraint_scaling(size_t constraint_index) const;
+
+   private:
+      const Model& model;
+      const double gradient_threshold;
+      const double scaling_factor;
+      const double minimum_scaling;
+      const Norm progress_norm;
+      const Norm residual_norm;
+      double objective_scaling{1.};
+      Vector<double> constraint_scaling;
+      // constraint index of each Jacobian nonzero, in the order of the last sparsity query
+      mutable std::vector<size_t> jacobian_row_indices;
+      mutable Vector<double> scaled_multipliers;
+
+      void compute_scaling();
+      [[nodiscard]] double gradient_based_scaling(double gradient_norm) const;
+   };
+} // namespace
+
+#endif // UNO_SCALEDMODEL_H
@@ -0,0 +1,80 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include "SynchronizedModel.hpp"
+
+namespace uno {
+   SynchronizedModel::SynchronizedModel(const Model& original_model, Lock& lock):
+         Model(original_model.name, original_model.number_variables, original_model.number_constraints, original_model.objective_sign),
+         model(original_model),
+         lock(lock) {
+   }
+
+   double SynchronizedModel::evaluate_objective(const Vector<double>& x) const {
+      std::lock_guard<std::mutex> guard(this->lock.mutex);
+      return this->model.evaluate_objective(x);
+   }
+
+   void SynchronizedModel::evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const {
+      std::lock_guard<std::mutex> guard(this->lock.mutex);
+      this->model.evaluate_constraints(x, constraints);
+   }
+
+   void SynchronizedModel::evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const {
+      std::lock_guard<std::mutex> guard(this->lock.mutex);
+      this->model.evaluate_objective_gradient(x, gradient);
+   }
+
+   void SynchronizedModel::compute_constraint_jacobian_sparsity(int* row_indices, int* column_indices, int solver_indexing,
+         MatrixOrder matrix_order) const {
+      std::lock_guard<std::mutex> guard(this->lock.mutex);
+      this->model.compute_constraint_jacobian_sparsity(row_indices, column_indices, solver_indexing, matrix_order);
+      this->jacobian_order = matrix_order;
+      this->lock.jacobian_order = matrix_order;
+   }
+
+   void SynchronizedModel::compute_hessian_sparsity(int* row_indices, int* column_indices, int solver_indexing) const {
+      std::lock_guard<std::mutex> guard(this->lock.mutex);
+      this->model.compute_hessian_sparsity(row_indices, column_indices, solver_indexing);
+   }
+
+   void SynchronizedModel::evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const {
+      std::lock_guard<std::mutex> guard(this->lock.mutex);
+      // another wrapper may have changed the order of the nonzeros: restore the order of this wrapper
+      if (this->jacobian_order.has_value() && this->lock.jacobian_order != this->jacobian_order) {
+         this->jacobian_row_indices.resize(this->number_jacobian_nonzeros());
+         this->jacobian_column_indices.resize(this->number_jacobian_nonzeros());
+         this->model.compute_constraint_jacobian_sparsity(this->jacobian_row_indices.data(), this->jacobian_column_indices.data(), 0,
+            *this->jacobian_order);
+         this->lock.jacobian_order = this->jacobian_order;
+      }
+      this->model.evaluate_constraint_jacobian(x, jacobian_values);
+   }
+
+   void SynchronizedModel::evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+         double* hessian_values) const {
+      std::lock_guard<std::mutex> guard(this->lock.mutex);
+      this->model.evaluate_lagrangian_hessian(x, objective_multiplier, multipliers, hessian_values);
+   }
+
+   void SynchronizedModel::compute_hessian_vector_product(const double* x, const double* vector, double objective_multiplier,
+         const Vector<double>& multipliers, double* result) const {
+      std::lock_guard<std::mutex> guard(this->lock.mutex);
+      this->model.compute_hessian_vector_product(x, vector, objective_multiplier, multipliers, result);
+   }
+
+   void SynchronizedModel::initial_primal_point(Vector<double>& x) const {
+      std::lock_guard<std::mutex> guard(this->lock.mutex);
+      this->model.initial_primal_point(x);
+   }
+
+   void SynchronizedModel::initial_dual_point(Vector<double>& multipliers) const {
+      std::lock_guard<std::mutex> guard(this->lock.mutex);
+      this->model.initial_dual_point(multipliers);
+   }
+
+   void SynchronizedModel::postprocess_solution(Iterate& iterate) const {
+      std::lock_guard<std::mutex> guard(this->lock.mutex);
+      this->model.postprocess_solution(iterate);
+   }
+} // namespace
@@ -0,0 +1,86 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_SYNCHRONIZEDMODEL_H
+#define UNO_SYNCHRONIZEDMODEL_H
+
+#include <mutex>
+#include <optional>
+#include <vector>
+#include "Model.hpp"
+#include "linear_algebra/MatrixOrder.hpp"
+#include "linear_algebra/Vector.hpp"
+
+namespace uno {
+   // the original model shared by concurrent solves (e.g. the runs of the multi-start driver or of the strategy portfolio),
+   // with one wrapper per solve. The evaluations of the original model are serialized by a lock common to the wrappers,
+   // since models such as AMPL keep an internal state.
+   // The order of the Jacobian nonzeros follows the last sparsity query of the original model: before evaluating the
+   // Jacobian, a wrapper repeats its own query if another wrapper changed the order
+   class SynchronizedModel: public Model {
+   public:
+      // state common to the wrappers of the same original model
+      struct Lock {
+         std::mutex mutex{};
+         std::optional<MatrixOrder> jacobian_order{};
+      };
+
+      SynchronizedModel(const Model& original_model, Lock& lock);
+
+      // availability of linear operators
+      [[nodiscard]] bool has_jacobian_operator() const override { return this->model.has_jacobian_operator(); }
+      [[nodiscard]] bool has_jacobian_transposed_operator() const override { return this->model.has_jacobian_transposed_operator(); }
+      [[nodiscard]] bool has_hessian_operator() const override { return this->model.has_hessian_operator(); }
+      [[nodiscard]] bool has_hessian_matrix() const override { return this->model.has_hessian_matrix(); }
+      // the evaluations of the original model are serialized
+      [[nodiscard]] bool has_thread_safe_evaluations() const override { return true; }
+
+      // function evaluations
+      [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override;
+      void evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override;
+
+      // dense objective gradient
+      void evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const override;
+
+      // sparsity patterns of Jacobian and Hessian
+      void compute_constraint_jacobian_sparsity(int* row_indices, int* column_indices, int solver_indexing,
+         MatrixOrder matrix_order) const override;
+      void compute_hessian_sparsity(int* row_indices, int* column_indices, int solver_indexing) const override;
+
+      // numerical evaluations of Jacobian and Hessian
+      void evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const override;
+      void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+         double* hessian_values) const override;
+      void compute_hessian_vector_product(const double* x, const double* vector, double objective_multiplier,
+         const Vector<double>& multipliers, double* result) const override;
+
+      [[nodiscard]] double variable_lower_bound(size_t variable_index) const override { return this->model.variable_lower_bound(variable_index); }
+      [[nodiscard]] double variable_upper_bound(size_t variable_index) const override { return this->model.variable_upper_bound(variable_index); }
+      [[nodiscard]] const SparseVector<size_t>& get_slacks() const override { return this->model.get_slacks(); }
+      [[nodiscard]] const Vector<size_t>& get_fixed_variables() const override { return this->model.get_fixed_variables(); }
+
+      [[nodiscard]] double constraint_lower_bound(size_t constraint_index) const override { return this->model.constraint_lower_bound(constraint_index); }
+      [[nodiscard]] double constraint_upper_bound(size_t constraint_index) const override { return this->model.constraint_upper_bound(constraint_index); }
+      [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override { return this->model.get_equality_constraints(); }
+      [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override { return this->model.get_inequality_constraints(); }
+      [[nodiscard]] const Collection<size_t>& get_linear_constraints() const override { return this->model.get_linear_constraints(); }
+
+      void initial_primal_point(Vector<double>& x) const override;
+      void initial_dual_point(Vector<double>& multipliers) const override;
+      void postprocess_solution(Iterate& iterate) const override;
+
+      [[nodiscard]] size_t number_jacobian_nonzeros() const override { return this->model.number_jacobian_nonzeros(); }
+      [[nodiscard]] size_t number_hessian_nonzeros() const override { return this->model.number_hessian_nonzeros(); }
+
+   private:
+      const Model& model;
+      Lock& lock;
+      // order of the last Jacobian sparsity query of this wrapper
+      mutable std::optional<MatrixOrder> jacobian_order{};
+      // sparsity pattern of the repeated queries (discarded)
+      mutable std::vector<int> jacobian_row_indices{};
+      mutable std::vector<int> jacobian_column_indices{};
+   };
+} // namespace
+
+#endif // UNO_SYNCHRONIZEDMODEL_H
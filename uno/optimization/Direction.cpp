@@ -19,6 +19,7 @@ namespace uno {
    void Direction::reset() {
       this->primals.fill(0.);
       this->multipliers.reset();
+      this->primal_step_length = 1.;
    }
 
    std::string status_to_string(SubproblemStatus status) {
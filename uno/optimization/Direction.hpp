@@ -23,6 +23,7 @@ namespace uno {
 
       SubproblemStatus status{SubproblemStatus::OPTIMAL}; /*!< Status of the solution */
 
+      double primal_step_length{1.}; /*!< Fraction-to-boundary step length applied to the primals */
       double norm{INF<double>}; /*!< Norm of \f$x\f$ */
       double subproblem_objective{INF<double>}; /*!< Objective value */
 
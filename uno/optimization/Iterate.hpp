@@ -19,6 +19,7 @@ namespace uno {
       Iterate(size_t number_variables, size_t number_constraints);
       Iterate(const Iterate& other) = default;
       Iterate(Iterate&& other) = default;
+      Iterate& operator=(const Iterate& other) = default;
       Iterate& operator=(Iterate&& other) = default;
 
       size_t number_variables;
@@ -29,10 +30,11 @@ namespace uno {
 
       // evaluations
       Evaluations evaluations;
-      static size_t number_eval_objective;
-      static size_t number_eval_constraints;
-      static size_t number_eval_objective_gradient;
-      static size_t number_eval_jacobian;
+      // evaluation counters of the current solve (one set per thread, so that solves may run concurrently)
+      static thread_local size_t number_eval_objective;
+      static thread_local size_t number_eval_constraints;
+      static thread_local size_t number_eval_objective_gradient;
+      static thread_local size_t number_eval_jacobian;
       // lazy evaluation flags
       bool is_objective_computed{false};
       bool are_constraints_computed{false};
@@ -54,6 +56,7 @@ namespace uno {
       void evaluate_objective_gradient(const Model& model);
 
       void set_number_variables(size_t number_variables);
+      static void reset_evaluation_counters();
 
       friend std::ostream& operator<<(std::ostream& stream, const Iterate& iterate);
    };
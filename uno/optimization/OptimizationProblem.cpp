@@ -96,6 +96,13 @@ namespace uno {
          multipliers.constraints, result);
    }
 
+   void OptimizationProblem::evaluate_barrier_diagonal(const Vector<double>& /*primal_variables*/, const Multipliers& /*multipliers*/,
+         double* diagonal) const {
+      for (size_t variable_index: Range(this->number_variables)) {
+         diagonal[variable_index] = 0.;
+      }
+   }
+
    size_t OptimizationProblem::get_number_original_variables() const {
       return this->model.number_variables;
    }
@@ -59,6 +59,9 @@ namespace uno {
          const Multipliers& multipliers, double* hessian_values) const;
       virtual void compute_hessian_vector_product(HessianModel& hessian_model, const double* x, const double* vector,
          const Multipliers& multipliers, double* result) const;
+      // diagonal Hessian terms introduced by the reformulation (e.g. barrier terms). Zero by default
+      virtual void evaluate_barrier_diagonal(const Vector<double>& primal_variables, const Multipliers& multipliers,
+         double* diagonal) const;
 
       [[nodiscard]] size_t get_number_original_variables() const;
       [[nodiscard]] virtual double variable_lower_bound(size_t variable_index) const;
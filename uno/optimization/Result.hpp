@@ -4,6 +4,7 @@
 #ifndef UNO_RESULT_H
 #define UNO_RESULT_H
 
+#include <string>
 #include "Iterate.hpp"
 #include "OptimizationStatus.hpp"
 
@@ -31,6 +32,7 @@ namespace uno {
       const size_t number_jacobian_evaluations;
       const size_t number_hessian_evaluations;
       const size_t number_subproblems_solved;
+      const std::string strategy_combination;
 
       void print(bool print_primal_dual_solution) const;
    };
@@ -34,12 +34,16 @@ namespace uno {
       options.set("statistics_major_column_order", "1");
       options.set("statistics_minor_column_order", "2");
       options.set("statistics_penalty_parameter_column_order", "5");
+      options.set("statistics_barrier_update_column_order", "7");
       options.set("statistics_barrier_parameter_column_order", "8");
       options.set("statistics_SOC_column_order", "9");
+      options.set("statistics_LS_speculative_column_order", "11");
       options.set("statistics_TR_radius_column_order", "10");
       options.set("statistics_LS_step_length_column_order", "10");
       options.set("statistics_restoration_phase_column_order", "20");
       options.set("statistics_regularization_column_order", "21");
+      options.set("statistics_Krylov_iterations_column_order", "22");
+      options.set("statistics_preconditioner_time_column_order", "23");
       options.set("statistics_funnel_width_column_order", "25");
       options.set("statistics_step_norm_column_order", "31");
       options.set("statistics_objective_column_order", "100");
@@ -55,11 +59,15 @@ namespace uno {
       // Hessian model (exact|zero)
       options.set("hessian_model", "exact");
       options.set("regularization_strategy", "primal");
+      // number of evaluations of each function (at different points) cached at the model boundary (0: no cache)
+      options.set("evaluation_cache_capacity", "0");
       // scale the functions (yes|no)
       options.set("scale_functions", "no");
       options.set("function_scaling_threshold", "100");
       // factor scaling
       options.set("function_scaling_factor", "100");
+      // smallest scaling factor of a function
+      options.set("function_scaling_min_value", "1e-8");
       // scale the errors with respect to the current point (yes|no)
       options.set("scale_residuals", "yes");
       // norm of the progress measures (L1|L2|INF)
@@ -107,6 +115,17 @@ namespace uno {
       options.set("LS_min_step_length", "1e-12");
       // use the primal-dual and dual step lengths to scale the dual directions when assembling the trial iterate
       options.set("LS_scale_duals_with_step_length", "yes");
+      // maximum number of second-order corrections when the full step is rejected (0: no correction)
+      options.set("LS_max_number_SOC", "0");
+      // the corrections stop when the constraint violation is not reduced by this factor
+      options.set("LS_SOC_infeasibility_decrease", "0.99");
+      // watchdog: number of consecutive shortened steps that trigger the watchdog
+      options.set("LS_watchdog_trigger", "10");
+      // watchdog: maximum number of tentatively accepted full steps (0: no watchdog)
+      options.set("LS_watchdog_max_tentative_iterations", "0");
+      // number of step lengths evaluated concurrently when backtracking (0 or 1: sequential backtracking).
+      // The backtracking is sequential if the model evaluations are not thread-safe (e.g. AMPL models)
+      options.set("LS_speculative_step_lengths", "0");
 
       /** regularization options **/
       // regularization failure threshold
@@ -123,6 +142,33 @@ namespace uno {
       options.set("primal_regularization_slow_increase_factor", "8.");
       options.set("threshold_unsuccessful_attempts", "8");
 
+      /** linear solver options **/
+      // equilibrate the augmented matrix (symmetric Ruiz scaling) before its factorization (yes|no)
+      options.set("kkt_matrix_equilibration", "no");
+      options.set("kkt_matrix_equilibration_iterations", "10");
+      options.set("kkt_matrix_equilibration_tolerance", "1e-2");
+      // iterative refinement of the solutions of the KKT system (0 steps: disabled)
+      options.set("kkt_refinement_max_steps", "0");
+      options.set("kkt_refinement_tolerance", "1e-10");
+      options.set("kkt_refinement_stall_factor", "0.999999999");
+      // fill-reducing ordering of MA57 and MA27 (built_in|METIS). The METIS nested dissection orderings are cached by pattern
+      options.set("linear_solver_ordering", "built_in");
+      // matrix-free MINRES solver (linear_solver=MINRES)
+      options.set("MINRES_max_iterations", "1000");
+      options.set("MINRES_tolerance", "1e-10");
+      // forcing term of the inexact steps: relative tolerance min(forcing, sqrt(||KKT residual||)) (0: disabled)
+      options.set("MINRES_inexact_forcing", "0");
+      // inertia-free curvature test dx^T W dx >= threshold ||dx||^2
+      options.set("MINRES_curvature_threshold", "1e-8");
+      // positive definite preconditioner (identity|jacobi|incomplete_LDL|constraint)
+      options.set("MINRES_preconditioner", "jacobi");
+      // pivots of the incomplete LDL^T factorization are kept away from 0 by this tolerance (relative to the largest entry)
+      options.set("MINRES_ILDL_pivot_tolerance", "1e-8");
+      // number of Ritz vectors recycled from the previous Krylov spaces into a limited-memory preconditioner (0: disabled)
+      options.set("MINRES_recycled_vectors", "0");
+      // number of Lanczos vectors kept to compute the recycled Ritz vectors
+      options.set("MINRES_Lanczos_basis_size", "20");
+
       /** trust region options **/
       // initial trust region radius
       options.set("TR_radius", "10.");
@@ -162,10 +208,52 @@ namespace uno {
       options.set("barrier_push_variable_to_interior_k1", "1e-2");
       options.set("barrier_push_variable_to_interior_k2", "1e-2");
       options.set("barrier_damping_factor", "1e-5");
+      // barrier parameter update strategy: monotone or adaptive
+      options.set("barrier_update_strategy", "monotone");
+      // adaptive strategy: oracle (loqo or probing) and safeguard
+      options.set("barrier_adaptive_oracle", "loqo");
+      options.set("barrier_adaptive_maximum_parameter", "1e5");
+      options.set("barrier_adaptive_sufficient_progress", "0.9999");
+      options.set("barrier_adaptive_reference_errors", "4");
+      options.set("barrier_adaptive_monotone_initial_factor", "0.8");
+      // Mehrotra's predictor-corrector (affine-scaling and centering-corrector solves with the same factorization)
+      options.set("barrier_predictor_corrector", "no");
+      options.set("barrier_centering_exponent", "3");
       options.set("least_square_multiplier_max_norm", "1e3");
 
       /** BQPD options **/
       options.set("BQPD_kmax", "500");
+
+      /** finite difference options **/
+      // number of threads that evaluate the perturbed points of the finite-difference model
+      options.set("finite_difference_threads", "1");
+
+      /** truncated CG options **/
+      // maximum number of iterations of the conjugate gradient methods
+      options.set("truncated_CG_max_iterations", "1000");
+      // relative tolerance of the conjugate gradient methods
+      options.set("truncated_CG_tolerance", "1e-10");
+      // fraction of the trust region that the normal step may use
+      options.set("truncated_CG_normal_step_fraction", "0.8");
+
+      /** multi-start options **/
+      // number of starting points, including the user point (1: single start)
+      options.set("multistart_number_points", "1");
+      // generation of the other starting points (latin_hypercube|perturbation)
+      options.set("multistart_sampling", "latin_hypercube");
+      // radius of the sampling around the user point (relative to max(1, |x0|)) along the infinite bounds
+      options.set("multistart_radius", "1");
+      options.set("multistart_seed", "0");
+      // number of starting points solved concurrently. The model evaluations of the runs are serialized
+      options.set("multistart_threads", "1");
+      // a run is terminated when its feasible iterates are worse than the best feasible solution by this relative margin
+      // after multistart_dominance_iterations iterations (inf: no termination)
+      options.set("multistart_dominance_margin", "inf");
+      options.set("multistart_dominance_iterations", "20");
+
+      /** strategy portfolio options **/
+      // comma-separated presets solved concurrently, the first one to find a KKT point wins (none: no portfolio)
+      options.set("portfolio_presets", "none");
    }
 
    // determine default subproblem solvers, based on the available external dependencies
@@ -182,6 +270,8 @@ namespace uno {
       const auto linear_solvers = SymmetricIndefiniteLinearSolverFactory::available_solvers();
       if (!linear_solvers.empty()) {
          options.set("linear_solver", linear_solvers[0], true);
+         // direct solver of the constraint preconditioner of MINRES
+         options.set("MINRES_preconditioner_linear_solver", linear_solvers[0], true);
       }
    }
 } // namespace
\ No newline at end of file
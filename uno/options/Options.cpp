@@ -1,76 +1,120 @@
 // Copyright (c) 2018-2024 Charlie Vanaret
 // Licensed under the MIT license. See LICENSE file in the project directory for details.
 
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
 #include <fstream>
+#include <limits>
 #include <sstream>
 #include "Options.hpp"
+#include "UsedOptions.hpp"
 #include "tools/Logger.hpp"
 
 namespace uno {
+   // the whole value must be parsed, up to trailing whitespace
+   static bool is_parsed(const char* begin, const char* end) {
+      if (end == begin) {
+         return false;
+      }
+      while (std::isspace(static_cast<unsigned char>(*end))) {
+         ++end;
+      }
+      return (*end == '\0');
+   }
+
+   // the value is parsed once: the getters do not need to convert it
+   static Options::Option parse_option(const std::string& option_value, bool overwritten, size_t index) {
+      Options::Option option{option_value, std::nullopt, std::nullopt, overwritten, index};
+      const char* begin = option_value.c_str();
+      char* end = nullptr;
+      errno = 0;
+      const double real = std::strtod(begin, &end);
+      // on underflow, strtod returns a subnormal number or zero: only an overflow is rejected
+      if (is_parsed(begin, end) && (errno != ERANGE || std::abs(real) <= std::numeric_limits<double>::min())) {
+         option.real = real;
+      }
+      errno = 0;
+      const long long integer = std::strtoll(begin, &end, 10);
+      if (is_parsed(begin, end) && errno != ERANGE) {
+         option.integer = integer;
+      }
+      return option;
+   }
+
    // setter
    void Options::set(const std::string& option_name, const std::string& option_value, bool flag_as_overwritten) {
-      this->options[option_name] = option_value;
-      this->overwritten_options[option_name] = flag_as_overwritten;
+      const auto existing_option = this->options.find(option_name);
+      const size_t index = (existing_option != this->options.end()) ? existing_option->second.index : this->options.size();
+      this->options.insert_or_assign(option_name, parse_option(option_value, flag_as_overwritten, index));
    }
 
    void Options::overwrite_with(const Options& overwriting_options) {
-      for (const auto& [option_name, option_value]: overwriting_options) {
+      for (const auto& [option_name, option]: overwriting_options) {
          // if the option already exists and is not the same, flag it as overwritten
-         const auto existing_option_value = this->at_optional(option_name);
-         bool flag_as_overwritten = (existing_option_value.has_value() && *existing_option_value != option_value);
-         this->set(option_name, option_value, flag_as_overwritten);
+         const auto existing_option = this->options.find(option_name);
+         bool flag_as_overwritten = (existing_option != this->options.end() && existing_option->second.value != option.value);
+         this->set(option_name, option.value, flag_as_overwritten);
       }
    }
 
    // getters
-   const std::string& Options::at(const std::string& option_name) const {
-      try {
-         const std::string& option_value = this->options.at(option_name);
-         this->used[option_name] = true;
-         return option_value;
-      }
-      catch(const std::out_of_range&) {
+   const Options::Option& Options::at(const std::string& option_name) const {
+      const Option* option = this->at_optional(option_name);
+      if (option == nullptr) {
          throw std::out_of_range("The option with name " + option_name + " was not found");
       }
+      return *option;
    }
 
-   std::optional<std::string> Options::at_optional(const std::string& option_name) const {
-      try {
-         const std::string& option_value = this->options.at(option_name);
-         this->used[option_name] = true;
-         return option_value;
-      }
-      catch(const std::out_of_range&) {
-         return std::nullopt;
+   const Options::Option* Options::at_optional(const std::string& option_name) const {
+      const auto option = this->options.find(option_name);
+      if (option == this->options.end()) {
+         return nullptr;
       }
+      UsedOptions::notify(option->second.index);
+      return &option->second;
    }
 
    const std::string& Options::get_string(const std::string& option_name) const {
-      return this->at(option_name);
+      return this->at(option_name).value;
    }
 
    std::optional<std::string> Options::get_string_optional(const std::string& option_name) const {
-      return this->at_optional(option_name);
+      const Option* option = this->at_optional(option_name);
+      if (option == nullptr) {
+         return std::nullopt;
+      }
+      return option->value;
    }
 
    double Options::get_double(const std::string& option_name) const {
-      const std::string& entry = this->at(option_name);
-      return std::stod(entry);
+      const Option& option = this->at(option_name);
+      if (!option.real.has_value()) {
+         throw std::invalid_argument("The option " + option_name + " = " + option.value + " is not a number");
+      }
+      return *option.real;
    }
 
    int Options::get_int(const std::string& option_name) const {
-      const std::string& entry = this->at(option_name);
-      return std::stoi(entry);
+      const Option& option = this->at(option_name);
+      if (!option.integer.has_value()) {
+         throw std::invalid_argument("The option " + option_name + " = " + option.value + " is not an integer");
+      }
+      return static_cast<int>(*option.integer);
    }
 
    size_t Options::get_unsigned_int(const std::string& option_name) const {
-      const std::string& entry = this->at(option_name);
-      return std::stoul(entry);
+      const Option& option = this->at(option_name);
+      if (!option.integer.has_value()) {
+         throw std::invalid_argument("The option " + option_name + " = " + option.value + " is not an integer");
+      }
+      return static_cast<size_t>(*option.integer);
    }
 
    bool Options::get_bool(const std::string& option_name) const {
-      const std::string& entry = this->at(option_name);
-      return entry == "yes";
+      return this->at(option_name).value == "yes";
    }
 
    // argv[i] for i = offset..argc-1 are overwriting options
@@ -115,13 +159,13 @@ namespace uno {
       return options;
    }
 
-   void Options::print_used_overwritten() const {
+   void Options::print_used_overwritten(const UsedOptions& used_options) const {
       size_t number_used_options = 0;
       std::string option_list{};
-      for (const auto& [option_name, option_value]: this->options) {
-         if (this->used[option_name] && this->overwritten_options[option_name]) {
+      for (const auto& [option_name, option]: this->options) {
+         if (used_options.is_used(option.index) && option.overwritten) {
             ++number_used_options;
-            option_list.append("- ").append(option_name).append(" = ").append(option_value).append("\n");
+            option_list.append("- ").append(option_name).append(" = ").append(option.value).append("\n");
          }
       }
       // print the overwritten options
@@ -130,11 +174,11 @@ namespace uno {
       }
    }
 
-   std::map<std::string, std::string>::const_iterator Options::begin() const {
+   std::map<std::string, Options::Option>::const_iterator Options::begin() const {
       return this->options.begin();
    }
 
-   std::map<std::string, std::string>::const_iterator Options::end() const {
+   std::map<std::string, Options::Option>::const_iterator Options::end() const {
       return this->options.end();
    }
 } // namespace
\ No newline at end of file
@@ -9,6 +9,11 @@
 #include <optional>
 
 namespace uno {
+   // forward declaration
+   class UsedOptions;
+
+   // the options are parsed once when they are set. The getters do not modify the object: once built, the options can be
+   // read concurrently by several solves. The options read by a solve are recorded by its UsedOptions tracker
    class Options {
    public:
       Options() = default;
@@ -26,18 +31,24 @@ namespace uno {
       [[nodiscard]] static Options get_command_line_options(int argc, char* argv[], size_t offset);
       [[nodiscard]] static Options load_option_file(const std::string& file_name);
       
-      void print_used_overwritten() const;
+      void print_used_overwritten(const UsedOptions& used_options) const;
+
+      struct Option {
+         std::string value;
+         std::optional<double> real; // numerical value, if the value is a number
+         std::optional<long long> integer; // integer value, if the value is an integer
+         bool overwritten;
+         size_t index; // position of the option in the UsedOptions trackers
+      };
 
-      [[nodiscard]] std::map<std::string, std::string>::const_iterator begin() const;
-      [[nodiscard]] std::map<std::string, std::string>::const_iterator end() const;
+      [[nodiscard]] std::map<std::string, Option>::const_iterator begin() const;
+      [[nodiscard]] std::map<std::string, Option>::const_iterator end() const;
 
    private:
-      std::map<std::string, std::string> options{};
-      mutable std::map<std::string, bool> used{};
-      mutable std::map<std::string, bool> overwritten_options{};
+      std::map<std::string, Option> options{};
 
-      [[nodiscard]] const std::string& at(const std::string& option_name) const;
-      [[nodiscard]] std::optional<std::string> at_optional(const std::string& option_name) const;
+      [[nodiscard]] const Option& at(const std::string& option_name) const;
+      [[nodiscard]] const Option* at_optional(const std::string& option_name) const;
    };
 } // namespace
 
@@ -0,0 +1,35 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include "UsedOptions.hpp"
+
+namespace uno {
+   thread_local UsedOptions* UsedOptions::current_used_options = nullptr;
+
+   void UsedOptions::clear() {
+      this->used.clear();
+   }
+
+   bool UsedOptions::is_used(size_t option_index) const {
+      return option_index < this->used.size() && this->used[option_index];
+   }
+
+   void UsedOptions::notify(size_t option_index) {
+      UsedOptions* used_options = UsedOptions::current_used_options;
+      if (used_options != nullptr) {
+         if (used_options->used.size() <= option_index) {
+            used_options->used.resize(option_index + 1, false);
+         }
+         used_options->used[option_index] = true;
+      }
+   }
+
+   // the scopes may be nested (e.g. a solve within a callback)
+   UsedOptions::Scope::Scope(UsedOptions& used_options): previous_used_options(UsedOptions::current_used_options) {
+      UsedOptions::current_used_options = &used_options;
+   }
+
+   UsedOptions::Scope::~Scope() {
+      UsedOptions::current_used_options = this->previous_used_options;
+   }
+} // namespace
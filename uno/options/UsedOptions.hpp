@@ -0,0 +1,41 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_USEDOPTIONS_H
+#define UNO_USEDOPTIONS_H
+
+#include <cstddef>
+#include <vector>
+
+namespace uno {
+   // per-solve record of the options that were read. While a solve runs, its tracker is installed on the thread of the
+   // solve (UsedOptions::Scope), so that the Options getters stay const and a single Options object can be shared by
+   // concurrent solves
+   class UsedOptions {
+   public:
+      UsedOptions() = default;
+
+      void clear();
+      [[nodiscard]] bool is_used(size_t option_index) const;
+
+      // flags the option as used by the solve running on the current thread (if any)
+      static void notify(size_t option_index);
+
+      class Scope {
+      public:
+         explicit Scope(UsedOptions& used_options);
+         Scope(const Scope&) = delete;
+         Scope& operator=(const Scope&) = delete;
+         ~Scope();
+
+      private:
+         UsedOptions* previous_used_options;
+      };
+
+   private:
+      std::vector<char> used{};
+      static thread_local UsedOptions* current_used_options;
+   };
+} // namespace
+
+#endif // UNO_USEDOPTIONS_H
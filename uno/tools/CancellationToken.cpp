@@ -0,0 +1,23 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include "CancellationToken.hpp"
+
+namespace uno {
+   thread_local const CancellationToken* CancellationToken::current_token = nullptr;
+
+   void CancellationToken::check() {
+      if (CancellationToken::current_token != nullptr && CancellationToken::current_token->is_cancelled()) {
+         throw CancellationRequest();
+      }
+   }
+
+   // the scopes may be nested (e.g. a solve within a callback)
+   CancellationToken::Scope::Scope(const CancellationToken& token): previous_token(CancellationToken::current_token) {
+      CancellationToken::current_token = &token;
+   }
+
+   CancellationToken::Scope::~Scope() {
+      CancellationToken::current_token = this->previous_token;
+   }
+} // namespace
@@ -0,0 +1,50 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_CANCELLATIONTOKEN_H
+#define UNO_CANCELLATIONTOKEN_H
+
+#include <atomic>
+#include <exception>
+
+namespace uno {
+   // thrown when the solve running on the current thread was cancelled
+   struct CancellationRequest : public std::exception {
+      [[nodiscard]] const char* what() const noexcept override {
+         return "The solve was cancelled";
+      }
+   };
+
+   // cooperative cancellation of a solve: the token may be cancelled from any thread. While a solve runs, its token is
+   // installed on the thread of the solve (CancellationToken::Scope), so that the outer and inner loops can check it
+   // without threading it through the ingredients
+   class CancellationToken {
+   public:
+      CancellationToken() = default;
+      CancellationToken(const CancellationToken&) = delete;
+      CancellationToken& operator=(const CancellationToken&) = delete;
+
+      void cancel() noexcept { this->cancelled.store(true, std::memory_order_relaxed); }
+      [[nodiscard]] bool is_cancelled() const noexcept { return this->cancelled.load(std::memory_order_relaxed); }
+
+      // throws a CancellationRequest if the token of the current thread was cancelled
+      static void check();
+
+      class Scope {
+      public:
+         explicit Scope(const CancellationToken& token);
+         Scope(const Scope&) = delete;
+         Scope& operator=(const Scope&) = delete;
+         ~Scope();
+
+      private:
+         const CancellationToken* previous_token;
+      };
+
+   private:
+      std::atomic<bool> cancelled{false};
+      static thread_local const CancellationToken* current_token;
+   };
+} // namespace
+
+#endif // UNO_CANCELLATIONTOKEN_H
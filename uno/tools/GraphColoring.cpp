@@ -0,0 +1,129 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <numeric>
+#include "GraphColoring.hpp"
+#include "symbolic/Range.hpp"
+
+namespace uno {
+   static constexpr size_t NO_COLOR = std::numeric_limits<size_t>::max();
+
+   Coloring GraphColoring::column_coloring(size_t number_rows, size_t number_columns, const std::vector<size_t>& row_indices,
+         const std::vector<size_t>& column_indices) {
+      assert(row_indices.size() == column_indices.size() && "The pattern has inconsistent dimensions");
+      std::vector<std::vector<size_t>> row_columns(number_rows);
+      std::vector<std::vector<size_t>> column_rows(number_columns);
+      for (size_t nonzero_index: Range(row_indices.size())) {
+         row_columns[row_indices[nonzero_index]].push_back(column_indices[nonzero_index]);
+         column_rows[column_indices[nonzero_index]].push_back(row_indices[nonzero_index]);
+      }
+      std::vector<size_t> degrees(number_columns);
+      for (size_t column_index: Range(number_columns)) {
+         degrees[column_index] = column_rows[column_index].size();
+      }
+
+      Coloring coloring{std::vector<size_t>(number_columns, NO_COLOR), 0};
+      std::vector<size_t> forbidden_colors(number_columns, NO_COLOR);
+      for (size_t column_index: GraphColoring::largest_first_order(degrees)) {
+         // the colors of the columns that share a row with the current column are forbidden
+         for (size_t row_index: column_rows[column_index]) {
+            for (size_t other_column_index: row_columns[row_index]) {
+               if (coloring.colors[other_column_index] != NO_COLOR) {
+                  forbidden_colors[coloring.colors[other_column_index]] = column_index;
+               }
+            }
+         }
+         const size_t color = GraphColoring::smallest_allowed_color(forbidden_colors, column_index);
+         coloring.colors[column_index] = color;
+         coloring.number_colors = std::max(coloring.number_colors, color + 1);
+      }
+      return coloring;
+   }
+
+   // algorithm 4.1 of Gebremedhin, Manne and Pothen (2005)
+   Coloring GraphColoring::star_coloring(size_t number_vertices, const std::vector<size_t>& row_indices,
+         const std::vector<size_t>& column_indices) {
+      const std::vector<std::vector<size_t>> adjacency = GraphColoring::adjacency_lists(number_vertices, row_indices, column_indices);
+      std::vector<size_t> degrees(number_vertices);
+      for (size_t vertex: Range(number_vertices)) {
+         degrees[vertex] = adjacency[vertex].size();
+      }
+
+      Coloring coloring{std::vector<size_t>(number_vertices, NO_COLOR), 0};
+      std::vector<size_t>& colors = coloring.colors;
+      std::vector<size_t> forbidden_colors(number_vertices, NO_COLOR);
+      for (size_t vertex: GraphColoring::largest_first_order(degrees)) {
+         for (size_t neighbor: adjacency[vertex]) {
+            // distance-1 coloring
+            if (colors[neighbor] != NO_COLOR) {
+               forbidden_colors[colors[neighbor]] = vertex;
+            }
+            for (size_t second_neighbor: adjacency[neighbor]) {
+               if (second_neighbor == vertex || colors[second_neighbor] == NO_COLOR) {
+                  continue;
+               }
+               // the path vertex - neighbor - second_neighbor will be bicolored if the uncolored neighbor gets the color
+               // of the vertex
+               if (colors[neighbor] == NO_COLOR) {
+                  forbidden_colors[colors[second_neighbor]] = vertex;
+               }
+               else {
+                  // the path vertex - neighbor - second_neighbor - third_neighbor must not be bicolored
+                  for (size_t third_neighbor: adjacency[second_neighbor]) {
+                     if (third_neighbor != neighbor && colors[third_neighbor] == colors[neighbor]) {
+                        forbidden_colors[colors[second_neighbor]] = vertex;
+                        break;
+                     }
+                  }
+               }
+            }
+         }
+         const size_t color = GraphColoring::smallest_allowed_color(forbidden_colors, vertex);
+         colors[vertex] = color;
+         coloring.number_colors = std::max(coloring.number_colors, color + 1);
+      }
+      return coloring;
+   }
+
+   std::vector<std::vector<size_t>> GraphColoring::adjacency_lists(size_t number_vertices, const std::vector<size_t>& row_indices,
+         const std::vector<size_t>& column_indices) {
+      assert(row_indices.size() == column_indices.size() && "The pattern has inconsistent dimensions");
+      std::vector<std::vector<size_t>> adjacency(number_vertices);
+      for (size_t nonzero_index: Range(row_indices.size())) {
+         const size_t row_index = row_indices[nonzero_index];
+         const size_t column_index = column_indices[nonzero_index];
+         if (row_index != column_index) {
+            adjacency[row_index].push_back(column_index);
+            adjacency[column_index].push_back(row_index);
+         }
+      }
+      for (std::vector<size_t>& neighbors: adjacency) {
+         std::sort(neighbors.begin(), neighbors.end());
+         neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+      }
+      return adjacency;
+   }
+
+   // protected member functions
+
+   std::vector<size_t> GraphColoring::largest_first_order(const std::vector<size_t>& degrees) {
+      std::vector<size_t> order(degrees.size());
+      std::iota(order.begin(), order.end(), size_t(0));
+      std::stable_sort(order.begin(), order.end(), [&](size_t first_vertex, size_t second_vertex) {
+         return degrees[first_vertex] > degrees[second_vertex];
+      });
+      return order;
+   }
+
+   // the colors forbidden for the vertex are marked with the index of the vertex
+   size_t GraphColoring::smallest_allowed_color(const std::vector<size_t>& forbidden_colors, size_t vertex) {
+      size_t color = 0;
+      while (color < forbidden_colors.size() && forbidden_colors[color] == vertex) {
+         ++color;
+      }
+      return color;
+   }
+} // namespace
@@ -0,0 +1,43 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_GRAPHCOLORING_H
+#define UNO_GRAPHCOLORING_H
+
+#include <cstddef>
+#include <vector>
+
+namespace uno {
+   struct Coloring {
+      std::vector<size_t> colors{}; // color of each column (or vertex), in [0, number_colors)
+      size_t number_colors{0};
+   };
+
+   // colorings of sparsity patterns for compressed finite differences (Gebremedhin, Manne and Pothen, 2005).
+   // The patterns are given in coordinate format (0-based indices). The vertices are colored greedily in decreasing order
+   // of degree (largest first)
+   class GraphColoring {
+   public:
+      // distance-1 coloring of the column intersection graph (Curtis, Powell and Reid, 1974): two columns that have a
+      // nonzero in the same row get different colors. Each nonzero (i, j) is then the only nonzero of the row i among the
+      // columns of color(j)
+      [[nodiscard]] static Coloring column_coloring(size_t number_rows, size_t number_columns, const std::vector<size_t>& row_indices,
+         const std::vector<size_t>& column_indices);
+
+      // star coloring of the adjacency graph of a symmetric pattern (a single triangle is enough, the diagonal is
+      // ignored): distance-1 coloring in which every path on 4 vertices uses at least 3 colors. Each nonzero (i, j) is the
+      // only nonzero of the row i among the columns of color(j) or the only nonzero of the row j among the columns of color(i)
+      [[nodiscard]] static Coloring star_coloring(size_t number_vertices, const std::vector<size_t>& row_indices,
+         const std::vector<size_t>& column_indices);
+
+      // symmetric adjacency lists of a pattern, without the diagonal and without duplicates
+      [[nodiscard]] static std::vector<std::vector<size_t>> adjacency_lists(size_t number_vertices, const std::vector<size_t>& row_indices,
+         const std::vector<size_t>& column_indices);
+
+   protected:
+      [[nodiscard]] static std::vector<size_t> largest_first_order(const std::vector<size_t>& degrees);
+      [[nodiscard]] static size_t smallest_allowed_color(const std::vector<size_t>& forbidden_colors, size_t vertex);
+   };
+} // namespace
+
+#endif // UNO_GRAPHCOLORING_H
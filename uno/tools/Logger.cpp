@@ -4,6 +4,8 @@
 #include "Logger.hpp"
 
 namespace uno {
+   thread_local std::ostream* Logger::current_stream = &std::cout;
+
    void Logger::set_logger(const std::string& logger_level) {
       if (logger_level == "SILENT") {
          Logger::level = SILENT;
@@ -30,4 +32,13 @@ namespace uno {
          throw std::out_of_range("The logger level " + logger_level + " was not found");
       }
    }
+
+   // the redirections may be nested
+   Logger::Redirection::Redirection(std::ostream& stream): previous_stream(Logger::current_stream) {
+      Logger::current_stream = &stream;
+   }
+
+   Logger::Redirection::~Redirection() {
+      Logger::current_stream = this->previous_stream;
+   }
 } // namespace
\ No newline at end of file
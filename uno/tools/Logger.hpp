@@ -16,12 +16,30 @@ namespace uno {
    public:
        static Level level;
        static void set_logger(const std::string& logger_level);
+       // output stream of the current thread (std::cout by default)
+       static std::ostream& stream() { return *Logger::current_stream; }
+
+       // redirects the output of the current thread while the scope is alive (e.g. the output of a concurrent solve is
+       // buffered and printed once the solve is over)
+       class Redirection {
+       public:
+          explicit Redirection(std::ostream& stream);
+          Redirection(const Redirection&) = delete;
+          Redirection& operator=(const Redirection&) = delete;
+          ~Redirection();
+
+       private:
+          std::ostream* previous_stream;
+       };
+
+   private:
+       static thread_local std::ostream* current_stream;
    };
 
    template <typename T>
    const Level& operator<<(const Level& level, T& element) {
       if (level <= Logger::level) {
-         std::cout << element;
+         Logger::stream() << element;
       }
       return level;
    }
@@ -29,7 +47,7 @@ namespace uno {
    template <typename T>
    const Level& operator<<(const Level& level, const T& element) {
       if (level <= Logger::level) {
-         std::cout << element;
+         Logger::stream() << element;
       }
       return level;
    }
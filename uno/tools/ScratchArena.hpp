@@ -0,0 +1,75 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_SCRATCHARENA_H
+#define UNO_SCRATCHARENA_H
+
+#include <cassert>
+#include <cstddef>
+#include <deque>
+
+namespace uno {
+   // ScratchArena is a per-solve pool of temporary buffers (e.g. Vector<double> or std::vector<double>) that are allocated
+   // once and for all. A buffer is leased for the duration of a scope and returned to the pool when the lease goes out
+   // of scope. Leases are released in reverse order (stack discipline).
+   // Once the pool is warm (the buffers have reached their largest size), leasing a buffer does not allocate.
+   // The content of a leased buffer is unspecified
+   template <typename Buffer>
+   class ScratchArena {
+   public:
+      class Lease {
+      public:
+         Lease(ScratchArena& arena, size_t size): arena(arena), buffer(arena.acquire(size)) { }
+         Lease(const Lease&) = delete;
+         Lease& operator=(const Lease&) = delete;
+         ~Lease() { this->arena.release(); }
+
+         [[nodiscard]] Buffer& operator*() { return this->buffer; }
+         [[nodiscard]] Buffer* operator->() { return &this->buffer; }
+
+      protected:
+         ScratchArena& arena;
+         Buffer& buffer;
+      };
+
+      ScratchArena() = default;
+
+      // preallocate a number of buffers of a given size
+      void reserve(size_t number_buffers, size_t buffer_size) {
+         while (this->buffers.size() < number_buffers) {
+            this->buffers.emplace_back();
+         }
+         for (Buffer& buffer: this->buffers) {
+            buffer.reserve(buffer_size);
+         }
+      }
+
+      // guaranteed copy elision: the lease is constructed in place
+      [[nodiscard]] Lease lease(size_t size) { return Lease(*this, size); }
+
+      [[nodiscard]] size_t number_leased_buffers() const { return this->number_leased; }
+      [[nodiscard]] size_t number_buffers() const { return this->buffers.size(); }
+
+   protected:
+      // std::deque does not invalidate the references to its elements when it grows
+      std::deque<Buffer> buffers{};
+      size_t number_leased{0};
+
+      Buffer& acquire(size_t size) {
+         if (this->number_leased == this->buffers.size()) {
+            this->buffers.emplace_back();
+         }
+         Buffer& buffer = this->buffers[this->number_leased];
+         buffer.resize(size);
+         ++this->number_leased;
+         return buffer;
+      }
+
+      void release() {
+         assert(0 < this->number_leased && "ScratchArena: no buffer to release");
+         --this->number_leased;
+      }
+   };
+} // namespace
+
+#endif // UNO_SCRATCHARENA_H
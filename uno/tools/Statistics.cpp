@@ -6,6 +6,7 @@
 #include <iomanip>
 #include "Statistics.hpp"
 #include "options/Options.hpp"
+#include "tools/Logger.hpp"
 
 namespace uno {
    // TODO move this to the option file
@@ -14,57 +15,56 @@ namespace uno {
    int Statistics::string_width = 26;
    int Statistics::numerical_format_size = 4;
 
-   void Statistics::add_column(std::string_view name, int width, int order) {
-      this->columns[order] = name;
-      this->widths[name] = width;
-   }
-   
-   void Statistics::start_new_line() {
-      for (const auto& column: this->columns) {
-         this->current_line[column.second] = "-";
-      }
-   }
-
-   void Statistics::set(std::string_view name, std::string value) {
-      this->current_line[name] = std::move(value);
-   }
+   Statistics::Statistics(bool enabled): enabled(enabled) { }
 
-   void Statistics::set(std::string_view name, int value) {
-      this->set(name, std::to_string(value));
+   size_t Statistics::add_column(std::string_view name, int width, int order) {
+      // a column may be registered several times (e.g. by the optimality and feasibility ingredients)
+      size_t column = 0;
+      while (column < this->names.size() && this->names[column] != name) {
+         ++column;
+      }
+      if (column == this->names.size()) {
+         this->names.emplace_back(name);
+         this->widths.push_back(width);
+         this->slots.emplace_back();
+      }
+      else {
+         this->widths[column] = width;
+      }
+      this->displayed_columns[order] = column;
+      return column;
    }
 
-   void Statistics::set(std::string_view name, size_t value) {
-      this->set(name, std::to_string(value));
+   void Statistics::start_new_line() {
+      for (Slot& slot: this->slots) {
+         slot.type = Slot::Type::EMPTY;
+      }
    }
 
-   void Statistics::set(std::string_view name, double value) {
-      std::ostringstream stream;
-      stream << std::scientific << std::setprecision(Statistics::numerical_format_size) << value;
-      this->set(name, stream.str());
-   }
-   
    void Statistics::print_horizontal_line() {
-      for (const auto& element: this->columns) {
-         std::string header = element.second;
-         for (int j = 0; j < this->widths[header]; j++) {
-            std::cout << Statistics::symbol("top");
+      for (const auto& [order, column]: this->displayed_columns) {
+         for (int j = 0; j < this->widths[column]; j++) {
+            Logger::stream() << Statistics::symbol("top");
          }
       }
-      std::cout << '\n';
+      Logger::stream() << '\n';
    }
 
    void Statistics::print_header() {
+      if (!this->enabled) {
+         return;
+      }
       /* line above */
       this->print_horizontal_line();
       /* headers */
-      for (const auto& element: this->columns) {
-         const std::string& header = element.second;
-         std::cout << " " << header;
-         for (int j = 0; j < this->widths[header] - static_cast<int>(header.size()) - 1; j++) {
-            std::cout << " ";
+      for (const auto& [order, column]: this->displayed_columns) {
+         const std::string& header = this->names[column];
+         Logger::stream() << " " << header;
+         for (int j = 0; j < this->widths[column] - static_cast<int>(header.size()) - 1; j++) {
+            Logger::stream() << " ";
          }
       }
-      std::cout << '\n';
+      Logger::stream() << '\n';
       /* line below */
       this->print_horizontal_line();
    }
@@ -80,25 +80,21 @@ namespace uno {
       return length;
    }
 
+   // the values are formatted here only
    void Statistics::print_current_line() {
-      for (const auto& element: this->columns) {
-         const auto& header = element.second;
-         int length;
-         try {
-            const auto& value = this->current_line.at(header);
-            std::cout << " " << value;
-            length = 1 + static_cast<int>(length_utf8(value));
-         }
-         catch (const std::out_of_range&) {
-            std::cout << " -";
-            length = 2;
-         }
-         int number_spaces = (length <= this->widths[header]) ? this->widths[header] - length : 0;
+      if (!this->enabled) {
+         return;
+      }
+      for (const auto& [order, column]: this->displayed_columns) {
+         this->format(this->slots[column]);
+         Logger::stream() << " " << this->formatted_value;
+         const int length = 1 + static_cast<int>(length_utf8(this->formatted_value));
+         int number_spaces = (length <= this->widths[column]) ? this->widths[column] - length : 0;
          for (int j = 0; j < number_spaces; j++) {
-            std::cout << " ";
+            Logger::stream() << " ";
          }
       }
-      std::cout << '\n';
+      Logger::stream() << '\n';
    }
 
    void Statistics::print_footer() {
@@ -106,14 +102,31 @@ namespace uno {
       for (const auto& element: this->columns) {
          const auto& header = element.second;
          for (int j = 0; j < this->widths[header]; j++) {
-            std::cout << Statistics::symbol("bottom");
+            Logger::stream() << Statistics::symbol("bottom");
          }
       }
-      std::cout << '\n';
+      Logger::stream() << '\n';
       */
       Statistics::print_header();
    }
    
+   void Statistics::format(const Slot& slot) {
+      if (slot.type == Slot::Type::INTEGER) {
+         this->formatted_value = std::to_string(slot.integer);
+      }
+      else if (slot.type == Slot::Type::REAL) {
+         std::ostringstream stream;
+         stream << std::scientific << std::setprecision(Statistics::numerical_format_size) << slot.real;
+         this->formatted_value = stream.str();
+      }
+      else if (slot.type == Slot::Type::STRING) {
+         this->formatted_value = slot.string;
+      }
+      else {
+         this->formatted_value = "-";
+      }
+   }
+
    std::string_view Statistics::symbol(std::string_view value) {
       static std::map<std::string_view, std::string_view> symbols = {
             {"top", "─"},
@@ -4,38 +4,75 @@
 #ifndef UNO_STATISTICS_H
 #define UNO_STATISTICS_H
 
-#include <string_view>
+#include <limits>
 #include <map>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace uno {
    // forward declaration
    class Options;
 
+   // table of statistics, one line per (inner) iteration. add_column returns the handle of the column, with which the
+   // values are set into typed slots; they are formatted only when the line is printed. When the statistics are
+   // disabled (the table is not printed), setting a value has no effect.
+   // The handles of the columns shared by the ingredients are registered once by Uno::create_statistics. The values
+   // set with the handle of an unregistered column are ignored
    class Statistics {
    public:
-      Statistics() = default;
+      explicit Statistics(bool enabled = true);
 
       static int int_width;
       static int double_width;
       static int string_width;
       static int numerical_format_size;
+      static constexpr size_t unregistered_column = std::numeric_limits<size_t>::max();
 
-      void add_column(std::string_view name, int width, int order);
+      // handles of the shared columns
+      size_t iteration_column{unregistered_column};
+      size_t step_norm_column{unregistered_column};
+      size_t objective_column{unregistered_column};
+      size_t primal_feasibility_column{unregistered_column};
+      size_t stationarity_column{unregistered_column};
+      size_t complementarity_column{unregistered_column};
+      size_t status_column{unregistered_column};
+
+      size_t add_column(std::string_view name, int width, int order);
       void start_new_line();
-      void set(std::string_view name, std::string value);
-      void set(std::string_view name, int value);
-      void set(std::string_view name, size_t value);
-      void set(std::string_view name, double value);
-      
+
+      void set(size_t column, std::string_view value) { if (this->is_writable(column)) { this->slots[column].set(value); } }
+      void set(size_t column, int value) { if (this->is_writable(column)) { this->slots[column].set(static_cast<long long>(value)); } }
+      void set(size_t column, size_t value) { if (this->is_writable(column)) { this->slots[column].set(static_cast<long long>(value)); } }
+      void set(size_t column, double value) { if (this->is_writable(column)) { this->slots[column].set(value); } }
+
       void print_horizontal_line();
       void print_header();
       void print_current_line();
       void print_footer();
 
    private:
-      std::map<int, std::string> columns{};
-      std::map<std::string_view, int> widths{};
-      std::map<std::string_view, std::string> current_line{};
+      struct Slot {
+         enum class Type {EMPTY, INTEGER, REAL, STRING};
+         Type type{Type::EMPTY};
+         long long integer{0};
+         double real{0.};
+         std::string string{}; // the buffer is reused from one line to the next
+
+         void set(long long value) { this->type = Type::INTEGER; this->integer = value; }
+         void set(double value) { this->type = Type::REAL; this->real = value; }
+         void set(std::string_view value) { this->type = Type::STRING; this->string.assign(value.data(), value.size()); }
+      };
+
+      const bool enabled;
+      std::vector<std::string> names{};
+      std::vector<int> widths{};
+      std::vector<Slot> slots{};
+      std::map<int, size_t> displayed_columns{}; // handles of the displayed columns, sorted by order
+      std::string formatted_value{};
+
+      [[nodiscard]] bool is_writable(size_t column) const { return this->enabled && column < this->slots.size(); }
+      void format(const Slot& slot);
       static std::string_view symbol(std::string_view value);
    };
 } // namespace
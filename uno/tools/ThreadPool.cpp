@@ -0,0 +1,97 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include "ThreadPool.hpp"
+#include "symbolic/Range.hpp"
+
+namespace uno {
+   ThreadPool::ThreadPool(size_t number_threads) {
+      // the calling thread is the thread 0
+      for (size_t thread_index = 1; thread_index < number_threads; ++thread_index) {
+         this->workers.emplace_back(&ThreadPool::run_worker, this, thread_index);
+      }
+   }
+
+   ThreadPool::~ThreadPool() {
+      {
+         std::lock_guard<std::mutex> lock(this->mutex);
+         this->stopping = true;
+      }
+      this->loop_available.notify_all();
+      for (std::thread& worker: this->workers) {
+         worker.join();
+      }
+   }
+
+   size_t ThreadPool::size() const {
+      return this->workers.size() + 1;
+   }
+
+   void ThreadPool::parallel_for(size_t number_iterations, const Task& task) {
+      if (this->workers.empty() || number_iterations <= 1) {
+         for (size_t iteration: Range(number_iterations)) {
+            task(iteration, 0);
+         }
+         return;
+      }
+
+      std::lock_guard<std::mutex> loop_lock(this->loop_mutex);
+      {
+         std::lock_guard<std::mutex> lock(this->mutex);
+         this->task = &task;
+         this->number_iterations = number_iterations;
+         this->next_iteration = 0;
+         this->number_busy_workers = this->workers.size();
+         this->exception = nullptr;
+         ++this->loop_generation;
+      }
+      this->loop_available.notify_all();
+      this->execute_iterations(0);
+
+      // wait for the workers to finish their iterations
+      std::unique_lock<std::mutex> lock(this->mutex);
+      this->loop_completed.wait(lock, [&] { return this->number_busy_workers == 0; });
+      this->task = nullptr;
+      if (this->exception) {
+         std::rethrow_exception(this->exception);
+      }
+   }
+
+   // protected member functions
+
+   void ThreadPool::run_worker(size_t thread_index) {
+      size_t generation = 0;
+      while (true) {
+         {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->loop_available.wait(lock, [&] { return this->stopping || generation != this->loop_generation; });
+            if (this->stopping) {
+               return;
+            }
+            generation = this->loop_generation;
+         }
+         this->execute_iterations(thread_index);
+         {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            --this->number_busy_workers;
+         }
+         this->loop_completed.notify_one();
+      }
+   }
+
+   // the iterations are distributed dynamically: each thread picks the next available iteration
+   void ThreadPool::execute_iterations(size_t thread_index) {
+      size_t iteration;
+      while ((iteration = this->next_iteration++) < this->number_iterations) {
+         try {
+            (*this->task)(iteration, thread_index);
+         }
+         catch (...) {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (!this->exception) {
+               this->exception = std::current_exception();
+            }
+         }
+      }
+   }
+} // namespace
@@ -0,0 +1,53 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_THREADPOOL_H
+#define UNO_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace uno {
+   // fixed-size pool of worker threads that execute the iterations of a parallel loop. The calling thread takes part in
+   // the loop, so a pool of size 1 has no worker thread and runs the loop sequentially.
+   // The task receives the index of the iteration and the index of the thread (in [0, size)), which can be used to select
+   // a per-thread workspace. Parallel loops issued concurrently are executed one after the other; a task must not issue
+   // a parallel loop on the same pool. The first exception thrown by a task is rethrown by parallel_for
+   class ThreadPool {
+   public:
+      using Task = std::function<void(size_t /*iteration*/, size_t /*thread_index*/)>;
+
+      explicit ThreadPool(size_t number_threads);
+      ThreadPool(const ThreadPool&) = delete;
+      ThreadPool& operator=(const ThreadPool&) = delete;
+      ~ThreadPool();
+
+      [[nodiscard]] size_t size() const;
+      void parallel_for(size_t number_iterations, const Task& task);
+
+   protected:
+      std::vector<std::thread> workers{};
+      std::mutex loop_mutex{}; // serializes the parallel loops
+      std::mutex mutex{};
+      std::condition_variable loop_available{};
+      std::condition_variable loop_completed{};
+      const Task* task{nullptr};
+      size_t number_iterations{0};
+      std::atomic<size_t> next_iteration{0};
+      size_t number_busy_workers{0};
+      size_t loop_generation{0};
+      bool stopping{false};
+      std::exception_ptr exception{};
+
+      void run_worker(size_t thread_index);
+      void execute_iterations(size_t thread_index);
+   };
+} // namespace
+
+#endif // UNO_THREADPOOL_H
@@ -10,23 +10,26 @@ namespace uno {
    template <class ElementType>
    class Vector;
 
+   // the callbacks return true to request the termination of the solve (with the status USER_TERMINATION)
    class UserCallbacks {
    public:
       UserCallbacks() = default;
       virtual ~UserCallbacks() = default;
 
-      virtual void notify_acceptable_iterate(const Vector<double>& primals, const Multipliers& multipliers, double objective_multiplier) = 0;
-      virtual void notify_new_primals(const Vector<double>& primals) = 0;
-      virtual void notify_new_multipliers(const Multipliers& multipliers) = 0;
+      [[nodiscard]] virtual bool notify_acceptable_iterate(const Vector<double>& primals, const Multipliers& multipliers, double objective_multiplier) = 0;
+      [[nodiscard]] virtual bool notify_new_primals(const Vector<double>& primals) = 0;
+      [[nodiscard]] virtual bool notify_new_multipliers(const Multipliers& multipliers) = 0;
    };
 
    class NoUserCallbacks: public UserCallbacks {
    public:
       NoUserCallbacks(): UserCallbacks() { }
 
-      void notify_acceptable_iterate(const Vector<double>& /*primals*/, const Multipliers& /*multipliers*/, double /*objective_multiplier*/) override { }
-      void notify_new_primals(const Vector<double>& /*primals*/) override { }
-      void notify_new_multipliers(const Multipliers& /*multipliers*/) override { }
+      bool notify_acceptable_iterate(const Vector<double>& /*primals*/, const Multipliers& /*multipliers*/, double /*objective_multiplier*/) override {
+         return false;
+      }
+      bool notify_new_primals(const Vector<double>& /*primals*/) override { return false; }
+      bool notify_new_multipliers(const Multipliers& /*multipliers*/) override { return false; }
    };
 } // namespace
 
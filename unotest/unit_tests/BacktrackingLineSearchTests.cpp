@@ -0,0 +1,238 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <functional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "HS071Model.hpp"
+#include "ingredients/constraint_relaxation_strategies/ConstraintRelaxationStrategy.hpp"
+#include "ingredients/globalization_mechanisms/BacktrackingLineSearch.hpp"
+#include "ingredients/globalization_strategies/GlobalizationStrategy.hpp"
+#include "optimization/Direction.hpp"
+#include "optimization/Iterate.hpp"
+#include "optimization/WarmstartInformation.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+#include "tools/Statistics.hpp"
+#include "tools/UserCallbacks.hpp"
+
+using namespace uno;
+
+// the directions along x0 are given in advance. A trial iterate is acceptable if it decreases the measure of the reference
+// iterate. The reference iterates and the measures of the trial iterates are recorded
+class ScriptedStrategy: public ConstraintRelaxationStrategy {
+public:
+   using Measure = std::function<double(const Model& model, Iterate& iterate)>;
+
+   ScriptedStrategy(const Options& options, std::vector<double> directions, Measure measure):
+         ConstraintRelaxationStrategy(options), directions(std::move(directions)), measure(std::move(measure)) { }
+
+   std::vector<double> reference_primals{};
+   std::vector<double> trial_measures{};
+
+   void initialize(Statistics& /*statistics*/, const Model& /*model*/, Iterate& /*initial_iterate*/, Direction& /*direction*/,
+         double /*trust_region_radius*/, const Options& /*options*/) override { }
+
+   void compute_feasible_direction(Statistics& /*statistics*/, GlobalizationStrategy& /*globalization_strategy*/,
+         const Model& /*model*/, Iterate& /*current_iterate*/, Direction& direction, double /*trust_region_radius*/,
+         WarmstartInformation& /*warmstart_information*/) override {
+      direction.primals.fill(0.);
+      direction.primals[0] = this->directions.at(this->direction_index++);
+      direction.norm = std::abs(direction.primals[0]);
+      direction.status = SubproblemStatus::OPTIMAL;
+   }
+
+   [[nodiscard]] bool solving_feasibility_problem() const override { return false; }
+   void switch_to_feasibility_problem(Statistics& /*statistics*/, GlobalizationStrategy& /*globalization_strategy*/,
+         const Model& /*model*/, Iterate& /*current_iterate*/, double /*trust_region_radius*/,
+         WarmstartInformation& /*warmstart_information*/) override { }
+
+   [[nodiscard]] bool compute_second_order_correction(const Model& /*model*/, Iterate& /*current_iterate*/,
+         Iterate& /*trial_iterate*/, double /*step_length*/, Direction& /*correction*/) override {
+      return false;
+   }
+
+   [[nodiscard]] bool is_iterate_acceptable(Statistics& /*statistics*/, GlobalizationStrategy& /*globalization_strategy*/,
+         const Model& model, Iterate& current_iterate, Iterate& trial_iterate, const Direction& /*direction*/,
+         double /*step_length*/, WarmstartInformation& /*warmstart_information*/, UserCallbacks& /*user_callbacks*/) override {
+      this->reference_primals.push_back(current_iterate.primals[0]);
+      this->trial_measures.push_back(this->measure(model, trial_iterate));
+      return this->trial_measures.back() < this->measure(model, current_iterate);
+   }
+
+   [[nodiscard]] SolutionStatus check_termination(const Model& /*model*/, Iterate& /*iterate*/) override {
+      return SolutionStatus::NOT_OPTIMAL;
+   }
+
+   [[nodiscard]] std::string get_name() const override { return "scripted"; }
+   [[nodiscard]] size_t get_hessian_evaluation_count() const override { return 0; }
+   [[nodiscard]] size_t get_number_subproblems_solved() const override { return this->direction_index; }
+
+protected:
+   const std::vector<double> directions;
+   size_t direction_index{0};
+   const Measure measure;
+
+   void evaluate_progress_measures(InequalityHandlingMethod& /*inequality_handling_method*/,
+         const OptimizationProblem& /*problem*/, Iterate& /*iterate*/) const override { }
+};
+
+class StatelessStrategy: public GlobalizationStrategy {
+public:
+   explicit StatelessStrategy(const Options& options): GlobalizationStrategy(options) { }
+
+   void initialize(Statistics& /*statistics*/, const Iterate& /*initial_iterate*/, const Options& /*options*/) override { }
+   [[nodiscard]] bool is_iterate_acceptable(Statistics& /*statistics*/, const ProgressMeasures& /*current_progress*/,
+         const ProgressMeasures& /*trial_progress*/, const ProgressMeasures& /*predicted_reduction*/,
+         double /*objective_multiplier*/) override {
+      return false;
+   }
+   [[nodiscard]] bool is_infeasibility_sufficiently_reduced(const ProgressMeasures& /*reference_progress*/,
+         const ProgressMeasures& /*trial_progress*/) const override {
+      return false;
+   }
+   void reset() override { }
+   void save_checkpoint() override { }
+   void restore_checkpoint() override { }
+   void notify_switch_to_feasibility(const ProgressMeasures& /*current_progress*/) override { }
+   void notify_switch_to_optimality(const ProgressMeasures& /*current_progress*/) override { }
+   [[nodiscard]] std::string get_name() const override { return "stateless"; }
+};
+
+// HS071 whose evaluations are not thread-safe. The points at which the objective is evaluated and the evaluating threads
+// are recorded
+class StatefulHS071Model: public HS071Model {
+public:
+   mutable std::vector<double> evaluation_points{};
+   mutable std::vector<std::thread::id> evaluation_threads{};
+
+   [[nodiscard]] bool has_thread_safe_evaluations() const override { return false; }
+   [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override {
+      this->evaluation_points.push_back(x[0]);
+      this->evaluation_threads.push_back(std::this_thread::get_id());
+      return HS071Model::evaluate_objective(x);
+   }
+};
+
+class BacktrackingLineSearchTests: public ::testing::Test {
+protected:
+   const HS071Model model{};
+   Options options{};
+   Statistics statistics{false};
+   WarmstartInformation warmstart_information{};
+   NoUserCallbacks user_callbacks{};
+
+   void SetUp() override {
+      DefaultOptions::load(this->options);
+      this->options.set("globalization_mechanism", "LS");
+   }
+
+   // takes the step computed by the line search from the current iterate
+   void compute_next_iterate(BacktrackingLineSearch& line_search, ConstraintRelaxationStrategy& constraint_relaxation_strategy,
+         GlobalizationStrategy& globalization_strategy, Iterate& current_iterate, Iterate& trial_iterate, Direction& direction) {
+      line_search.compute_next_iterate(this->statistics, constraint_relaxation_strategy, globalization_strategy, this->model,
+         current_iterate, trial_iterate, direction, this->warmstart_information, this->user_callbacks);
+      std::swap(current_iterate, trial_iterate);
+   }
+};
+
+TEST_F(BacktrackingLineSearchTests, WatchdogMeasuresProgressFromCheckpoint) {
+   // the watchdog is triggered after a shortened step and tentatively accepts two full steps
+   this->options.set("LS_watchdog_trigger", "1");
+   this->options.set("LS_watchdog_max_tentative_iterations", "2");
+   BacktrackingLineSearch line_search(this->options);
+   line_search.initialize(this->statistics, this->options);
+   // from x0 = 4: the full step to 1 is rejected and the half step to 2.5 (the checkpoint) is accepted. The tentative iterates
+   // 4.5 and 4 move away from the checkpoint, although 4 improves on 4.5. The third watchdog step to 4.25 restores the
+   // checkpoint and a new direction is computed there, along which the full step was already rejected
+   ScriptedStrategy constraint_relaxation_strategy(this->options, {-3., 2., -0.5, 0.25, 0.2}, [](const Model& /*model*/,
+         Iterate& iterate) {
+      return (iterate.primals[0] - 3.)*(iterate.primals[0] - 3.);
+   });
+   StatelessStrategy globalization_strategy(this->options);
+   Iterate current_iterate(4, 2), trial_iterate(4, 2);
+   current_iterate.primals = Vector<double>{4., 1., 1., 1.};
+   Direction direction(4, 2);
+
+   this->compute_next_iterate(line_search, constraint_relaxation_strategy, globalization_strategy, current_iterate, trial_iterate,
+      direction);
+   ASSERT_EQ(current_iterate.primals[0], 2.5);
+   this->compute_next_iterate(line_search, constraint_relaxation_strategy, globalization_strategy, current_iterate, trial_iterate,
+      direction);
+   ASSERT_EQ(current_iterate.primals[0], 4.5);
+   this->compute_next_iterate(line_search, constraint_relaxation_strategy, globalization_strategy, current_iterate, trial_iterate,
+      direction);
+   ASSERT_EQ(current_iterate.primals[0], 4.);
+   this->compute_next_iterate(line_search, constraint_relaxation_strategy, globalization_strategy, current_iterate, trial_iterate,
+      direction);
+   // the checkpoint was restored and the half step along the new direction was accepted
+   ASSERT_NEAR(current_iterate.primals[0], 2.6, 1e-15);
+
+   // the watchdog steps were all tested against the checkpoint
+   const std::vector<double> expected_reference_primals{4., 4., 2.5, 2.5, 2.5, 2.5};
+   ASSERT_EQ(constraint_relaxation_strategy.reference_primals, expected_reference_primals);
+}
+
+TEST_F(BacktrackingLineSearchTests, SpeculativeBacktrackingAcceptsSequentialStep) {
+   // along x0 with x1 = x2 = x3 = 1, the objective of HS071 is (x0 + 1)^2. From x0 = 5 (objective 36), the measure
+   // |f(x) - 30| rejects the step lengths 1 and 0.5 and accepts 0.25 (x0 = 4)
+   const auto measure = [](const Model& model, Iterate& iterate) {
+      iterate.evaluate_objective(model);
+      iterate.evaluate_constraints(model);
+      return std::abs(iterate.evaluations.objective - 30.);
+   };
+   std::vector<Iterate> accepted_iterates;
+   std::vector<std::vector<double>> trial_measures;
+   for (const char* number_speculative_step_lengths: {"0", "2", "3"}) {
+      this->options.set("LS_speculative_step_lengths", number_speculative_step_lengths);
+      BacktrackingLineSearch line_search(this->options);
+      line_search.initialize(this->statistics, this->options);
+      ScriptedStrategy constraint_relaxation_strategy(this->options, {-4.}, measure);
+      StatelessStrategy globalization_strategy(this->options);
+      Iterate current_iterate(4, 2), trial_iterate(4, 2);
+      current_iterate.primals = Vector<double>{5., 1., 1., 1.};
+      Direction direction(4, 2);
+
+      this->compute_next_iterate(line_search, constraint_relaxation_strategy, globalization_strategy, current_iterate,
+         trial_iterate, direction);
+      ASSERT_EQ(current_iterate.primals[0], 4.);
+      ASSERT_EQ(current_iterate.evaluations.objective, 25.);
+      accepted_iterates.push_back(current_iterate);
+      trial_measures.push_back(constraint_relaxation_strategy.trial_measures);
+   }
+   // the speculative line searches test the same trial iterates as the sequential line search
+   for (size_t run_index: {1, 2}) {
+      ASSERT_EQ(trial_measures[run_index], trial_measures[0]);
+      for (size_t variable_index = 0; variable_index < 4; ++variable_index) {
+         ASSERT_EQ(accepted_iterates[run_index].primals[variable_index], accepted_iterates[0].primals[variable_index]);
+      }
+      ASSERT_EQ(accepted_iterates[run_index].evaluations.constraints, accepted_iterates[0].evaluations.constraints);
+   }
+}
+
+TEST_F(BacktrackingLineSearchTests, SequentialBacktrackingWithoutThreadSafeEvaluations) {
+   this->options.set("LS_speculative_step_lengths", "3");
+   BacktrackingLineSearch line_search(this->options);
+   line_search.initialize(this->statistics, this->options);
+   ScriptedStrategy constraint_relaxation_strategy(this->options, {-4.}, [](const Model& model, Iterate& iterate) {
+      iterate.evaluate_objective(model);
+      return std::abs(iterate.evaluations.objective - 30.);
+   });
+   StatelessStrategy globalization_strategy(this->options);
+   const StatefulHS071Model stateful_model{};
+   Iterate current_iterate(4, 2), trial_iterate(4, 2);
+   current_iterate.primals = Vector<double>{5., 1., 1., 1.};
+   Direction direction(4, 2);
+
+   line_search.compute_next_iterate(this->statistics, constraint_relaxation_strategy, globalization_strategy, stateful_model,
+      current_iterate, trial_iterate, direction, this->warmstart_information, this->user_callbacks);
+   ASSERT_EQ(trial_iterate.primals[0], 4.);
+   // the trial iterates are evaluated one after the other when they are tested, on the calling thread only
+   const std::vector<double> expected_evaluation_points{1., 5., 3., 4.};
+   ASSERT_EQ(stateful_model.evaluation_points, expected_evaluation_points);
+   ASSERT_EQ(stateful_model.evaluation_threads, std::vector<std::thread::id>(4, std::this_thread::get_id()));
+}
@@ -0,0 +1,103 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include "HS071Model.hpp"
+#include "ingredients/inequality_handling_methods/interior_point_methods/AdaptiveBarrierParameterUpdateStrategy.hpp"
+#include "ingredients/inequality_handling_methods/interior_point_methods/MonotoneBarrierParameterUpdateStrategy.hpp"
+#include "ingredients/inequality_handling_methods/interior_point_methods/PrimalDualInteriorPointProblem.hpp"
+#include "optimization/Direction.hpp"
+#include "optimization/DualResiduals.hpp"
+#include "optimization/Iterate.hpp"
+#include "optimization/OptimizationProblem.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+
+using namespace uno;
+
+// the 8 bounds of HS071 (1 <= x <= 5) at x = (2, 2, 2, 2) with the complementarity products (x - x_L) z_L = (0.5, 1, 1, 1)
+// and (x - x_U) z_U = (1, 1, 1, 1): the average complementarity is 7.5/8 = 0.9375 and the minimum is 0.5
+class BarrierParameterUpdateStrategyTests: public ::testing::Test {
+protected:
+   HS071Model model{};
+   const OptimizationProblem problem{this->model};
+   const InteriorPointParameters parameters{0.99, 1e10, 0.25, 10., 1e-2, 1e-2, 1e-5};
+   const PrimalDualInteriorPointProblem barrier_problem{this->problem, 0.1, this->parameters};
+   Iterate iterate{4, 2};
+   DualResiduals residuals{4};
+   Options options{};
+
+   void SetUp() override {
+      DefaultOptions::load(this->options);
+      this->iterate.primals.fill(2.);
+      this->iterate.multipliers.lower_bounds.fill(1.);
+      this->iterate.multipliers.lower_bounds[0] = 0.5;
+      this->iterate.multipliers.upper_bounds.fill(-1./3.);
+      this->iterate.primal_feasibility = 0.;
+      this->set_primal_dual_error(0.5);
+   }
+
+   void set_primal_dual_error(double primal_dual_error) {
+      this->residuals.stationarity = primal_dual_error;
+      this->residuals.stationarity_scaling = 1.;
+      this->residuals.complementarity = primal_dual_error;
+      this->residuals.complementarity_scaling = 1.;
+   }
+};
+
+TEST_F(BarrierParameterUpdateStrategyTests, Monotone) {
+   MonotoneBarrierParameterUpdateStrategy strategy(this->options);
+   // error 0.5 <= k_epsilon mu = 1: mu = min(k_mu mu, mu^theta_mu) = min(0.02, 0.0316)
+   ASSERT_TRUE(strategy.update_barrier_parameter(this->barrier_problem, this->iterate, this->residuals));
+   ASSERT_DOUBLE_EQ(strategy.get_barrier_parameter(), 0.02);
+   // error 0.5 > k_epsilon mu = 0.2: no update
+   ASSERT_FALSE(strategy.update_barrier_parameter(this->barrier_problem, this->iterate, this->residuals));
+   ASSERT_DOUBLE_EQ(strategy.get_barrier_parameter(), 0.02);
+   ASSERT_FALSE(strategy.is_free_mode());
+}
+
+TEST_F(BarrierParameterUpdateStrategyTests, LOQO) {
+   AdaptiveBarrierParameterUpdateStrategy strategy(this->options);
+   // xi = 0.5/0.9375, sigma = 0.1 (0.05 (1 - xi)/xi)^3 = 0.1 * 0.04375^3, mu = sigma * 0.9375
+   ASSERT_TRUE(strategy.update_barrier_parameter(this->barrier_problem, this->iterate, this->residuals));
+   ASSERT_NEAR(strategy.get_barrier_parameter(), 7.8506469726562e-6, 1e-18);
+   ASSERT_TRUE(strategy.is_free_mode());
+   ASSERT_FALSE(strategy.uses_probing());
+
+   // insufficient progress (1 > 0.9999 * 0.5): switch to the monotone mode with mu = 0.8 * 0.9375
+   this->set_primal_dual_error(1.);
+   ASSERT_TRUE(strategy.update_barrier_parameter(this->barrier_problem, this->iterate, this->residuals));
+   ASSERT_DOUBLE_EQ(strategy.get_barrier_parameter(), 0.75);
+   ASSERT_FALSE(strategy.is_free_mode());
+   ASSERT_EQ(strategy.get_mode(), "monotone");
+}
+
+TEST_F(BarrierParameterUpdateStrategyTests, Probing) {
+   this->options.set("barrier_adaptive_oracle", "probing");
+   AdaptiveBarrierParameterUpdateStrategy strategy(this->options);
+   // the barrier parameter is computed once the augmented system is factorized
+   ASSERT_FALSE(strategy.update_barrier_parameter(this->barrier_problem, this->iterate, this->residuals));
+   ASSERT_DOUBLE_EQ(strategy.get_barrier_parameter(), 0.1);
+   ASSERT_TRUE(strategy.uses_probing());
+   // sigma = (0.1/1)^3, mu = sigma * 1
+   ASSERT_TRUE(strategy.update_barrier_parameter_by_probing(1., 0.1));
+   ASSERT_NEAR(strategy.get_barrier_parameter(), 1e-3, 1e-15);
+   // the affine complementarity is larger than the average complementarity: sigma = 1
+   ASSERT_TRUE(strategy.update_barrier_parameter_by_probing(0.5, 2.));
+   ASSERT_DOUBLE_EQ(strategy.get_barrier_parameter(), 0.5);
+}
+
+TEST_F(BarrierParameterUpdateStrategyTests, AffineScalingComplementarity) {
+   // full affine step: x_0 = 2 - 0.5 = 1.5, z_L0 = 0.5 + 0.5 = 1, the other products are unchanged
+   Direction affine_direction(4, 2);
+   affine_direction.primals.fill(0.);
+   affine_direction.primals[0] = -0.5;
+   affine_direction.multipliers.lower_bounds.fill(0.);
+   affine_direction.multipliers.lower_bounds[0] = 0.5;
+   affine_direction.multipliers.upper_bounds.fill(0.);
+   const auto [average_complementarity, affine_complementarity] =
+      this->barrier_problem.compute_affine_scaling_complementarity(this->iterate, affine_direction);
+   ASSERT_DOUBLE_EQ(average_complementarity, 0.9375);
+   // products (0.5, 1, 1, 1) for the lower bounds and (3.5/3, 1, 1, 1) for the upper bounds
+   ASSERT_DOUBLE_EQ(affine_complementarity, (0.5 + 3. + 3.5/3. + 3.)/8.);
+}
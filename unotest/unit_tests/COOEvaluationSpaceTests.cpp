@@ -0,0 +1,93 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "ingredients/subproblem_solvers/COOEvaluationSpace.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+
+using namespace uno;
+
+// gives access to the symmetric Ruiz equilibration of an assembled matrix (upper triangle, Fortran indexing)
+class EquilibratedEvaluationSpace: public COOEvaluationSpace {
+public:
+   EquilibratedEvaluationSpace(const Options& options, const std::vector<int>& row_indices, const std::vector<int>& column_indices,
+         const std::vector<double>& values, const std::vector<double>& rhs): COOEvaluationSpace(options) {
+      const size_t dimension = rhs.size();
+      this->number_hessian_nonzeros = values.size();
+      this->number_matrix_nonzeros = values.size();
+      this->matrix_row_indices = row_indices;
+      this->matrix_column_indices = column_indices;
+      this->matrix_values = Vector<double>(values.size());
+      std::copy(values.begin(), values.end(), this->matrix_values.begin());
+      this->rhs = Vector<double>(dimension);
+      std::copy(rhs.begin(), rhs.end(), this->rhs.begin());
+      this->solution.resize(dimension);
+      this->equilibration_factors.resize(dimension);
+      this->row_norms.resize(dimension);
+      this->equilibrated_matrix_values.resize(values.size());
+   }
+
+   using COOEvaluationSpace::equilibrate_linear_system;
+   using COOEvaluationSpace::equilibration_factors;
+};
+
+class COOEvaluationSpaceTests: public ::testing::Test {
+protected:
+   Options options{};
+
+   void SetUp() override {
+      DefaultOptions::load(this->options);
+      this->options.set("kkt_matrix_equilibration", "yes");
+   }
+};
+
+TEST_F(COOEvaluationSpaceTests, DiagonalEquilibration) {
+   // K = diag(4, 9): D = diag(1/2, 1/3) and D K D = I after one iteration. D rhs = (1, 1) and x = D (1, 1) solves K x = rhs
+   EquilibratedEvaluationSpace evaluation_space(this->options, {1, 2}, {1, 2}, {4., 9.}, {2., 3.});
+   evaluation_space.equilibrate_linear_system();
+   ASSERT_NEAR(evaluation_space.equilibration_factors[0], 1./2., 1e-15);
+   ASSERT_NEAR(evaluation_space.equilibration_factors[1], 1./3., 1e-15);
+   const Vector<double>& equilibrated_values = evaluation_space.get_factorized_matrix_values();
+   ASSERT_NEAR(equilibrated_values[0], 1., 1e-15);
+   ASSERT_NEAR(equilibrated_values[1], 1., 1e-15);
+   ASSERT_NEAR(evaluation_space.rhs[0], 1., 1e-15);
+   ASSERT_NEAR(evaluation_space.rhs[1], 1., 1e-15);
+
+   evaluation_space.solution[0] = 1.;
+   evaluation_space.solution[1] = 1.;
+   evaluation_space.unscale_solution();
+   ASSERT_NEAR(evaluation_space.solution[0], 1./2., 1e-15);
+   ASSERT_NEAR(evaluation_space.solution[1], 1./3., 1e-15);
+}
+
+TEST_F(COOEvaluationSpaceTests, RowNormsCloseToOne) {
+   // K = [1 4; 4 16] (upper triangle): the rows of D K D have an infinity norm within the tolerance of 1
+   const std::vector<int> row_indices{1, 1, 2};
+   const std::vector<int> column_indices{1, 2, 2};
+   const std::vector<double> values{1., 4., 16.};
+   EquilibratedEvaluationSpace evaluation_space(this->options, row_indices, column_indices, values, {1., 1.});
+   evaluation_space.equilibrate_linear_system();
+
+   const Vector<double>& equilibrated_values = evaluation_space.get_factorized_matrix_values();
+   std::vector<double> row_norms(2, 0.);
+   for (size_t nonzero_index = 0; nonzero_index < values.size(); ++nonzero_index) {
+      const size_t row_index = static_cast<size_t>(row_indices[nonzero_index] - 1);
+      const size_t column_index = static_cast<size_t>(column_indices[nonzero_index] - 1);
+      // D K D
+      ASSERT_NEAR(equilibrated_values[nonzero_index], evaluation_space.equilibration_factors[row_index] * values[nonzero_index] *
+         evaluation_space.equilibration_factors[column_index], 1e-15);
+      row_norms[row_index] = std::max(row_norms[row_index], std::abs(equilibrated_values[nonzero_index]));
+      row_norms[column_index] = std::max(row_norms[column_index], std::abs(equilibrated_values[nonzero_index]));
+   }
+   const double tolerance = this->options.get_double("kkt_matrix_equilibration_tolerance");
+   ASSERT_LE(std::abs(1. - row_norms[0]), tolerance);
+   ASSERT_LE(std::abs(1. - row_norms[1]), tolerance);
+   // D rhs
+   ASSERT_EQ(evaluation_space.rhs[0], evaluation_space.equilibration_factors[0]);
+   ASSERT_EQ(evaluation_space.rhs[1], evaluation_space.equilibration_factors[1]);
+}
@@ -0,0 +1,36 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include "tools/CancellationToken.hpp"
+
+using namespace uno;
+
+TEST(CancellationToken, CheckWithoutScope) {
+   // no token is installed on the current thread
+   ASSERT_NO_THROW(CancellationToken::check());
+}
+
+TEST(CancellationToken, CheckCancelledToken) {
+   CancellationToken token{};
+   const CancellationToken::Scope scope(token);
+   ASSERT_NO_THROW(CancellationToken::check());
+   token.cancel();
+   ASSERT_TRUE(token.is_cancelled());
+   ASSERT_THROW(CancellationToken::check(), CancellationRequest);
+}
+
+TEST(CancellationToken, NestedScopesRestorePreviousToken) {
+   CancellationToken outer_token{};
+   outer_token.cancel();
+   {
+      const CancellationToken::Scope outer_scope(outer_token);
+      {
+         const CancellationToken inner_token{};
+         const CancellationToken::Scope inner_scope(inner_token);
+         ASSERT_NO_THROW(CancellationToken::check());
+      }
+      ASSERT_THROW(CancellationToken::check(), CancellationRequest);
+   }
+   ASSERT_NO_THROW(CancellationToken::check());
+}
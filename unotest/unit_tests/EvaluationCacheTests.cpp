@@ -0,0 +1,69 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "HS071Model.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "model/CachedModel.hpp"
+#include "model/EvaluationCache.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+
+using namespace uno;
+
+TEST(EvaluationCache, HitAndMiss) {
+   EvaluationCache<double> cache(2);
+   const std::vector<double> point{1., 2., 3.};
+   ASSERT_EQ(cache.find(point), nullptr);
+   cache.insert(point) = 14.;
+   const double* value = cache.find(point);
+   ASSERT_NE(value, nullptr);
+   ASSERT_EQ(*value, 14.);
+   // keys are compared exactly
+   ASSERT_EQ(cache.find(std::vector<double>{1., 2., 3. + 1e-15}), nullptr);
+   ASSERT_EQ(cache.hits(), 1);
+   ASSERT_EQ(cache.misses(), 2);
+}
+
+TEST(EvaluationCache, LeastRecentlyUsedEviction) {
+   EvaluationCache<double> cache(2);
+   const std::vector<double> point1{1.}, point2{2.}, point3{3.};
+   cache.insert(point1) = 1.;
+   cache.insert(point2) = 2.;
+   // point1 becomes the most recently used: point2 is evicted
+   ASSERT_NE(cache.find(point1), nullptr);
+   cache.insert(point3) = 3.;
+   ASSERT_EQ(cache.find(point2), nullptr);
+   ASSERT_EQ(*cache.find(point1), 1.);
+   ASSERT_EQ(*cache.find(point3), 3.);
+}
+
+TEST(EvaluationCache, JacobianOrder) {
+   Options options;
+   DefaultOptions::load(options);
+   options.set("evaluation_cache_capacity", "4");
+   const OrderedHS071Model model{};
+   const CachedModel cached_model(model, options);
+   const Vector<double> x{1., 2., 3., 4.};
+   std::vector<int> row_indices(8), column_indices(8);
+   std::vector<double> row_major_jacobian(8), column_major_jacobian(8), jacobian(8);
+
+   cached_model.compute_constraint_jacobian_sparsity(row_indices.data(), column_indices.data(), 0, MatrixOrder::ROW_MAJOR);
+   cached_model.evaluate_constraint_jacobian(x, row_major_jacobian.data());
+   // the values cached row by row are not returned for a column-by-column query
+   cached_model.compute_constraint_jacobian_sparsity(row_indices.data(), column_indices.data(), 0, MatrixOrder::COLUMN_MAJOR);
+   cached_model.evaluate_constraint_jacobian(x, column_major_jacobian.data());
+   ASSERT_EQ(model.number_jacobian_evaluations, 2);
+   ASSERT_EQ(column_major_jacobian[1], row_major_jacobian[4]);
+   ASSERT_EQ(column_major_jacobian[2], row_major_jacobian[1]);
+
+   // both orders remain cached
+   cached_model.compute_constraint_jacobian_sparsity(row_indices.data(), column_indices.data(), 0, MatrixOrder::ROW_MAJOR);
+   cached_model.evaluate_constraint_jacobian(x, jacobian.data());
+   ASSERT_EQ(jacobian, row_major_jacobian);
+   cached_model.compute_constraint_jacobian_sparsity(row_indices.data(), column_indices.data(), 0, MatrixOrder::COLUMN_MAJOR);
+   cached_model.evaluate_constraint_jacobian(x, jacobian.data());
+   ASSERT_EQ(jacobian, column_major_jacobian);
+   ASSERT_EQ(model.number_jacobian_evaluations, 2);
+}
@@ -0,0 +1,102 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <thread>
+#include <vector>
+#include "HS071Model.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "model/FiniteDifferenceModel.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+
+using namespace uno;
+
+// the finite-difference derivatives of HS071 are compared with the analytic derivatives, with one and several threads
+class FiniteDifferenceModelTests: public ::testing::TestWithParam<size_t> {
+protected:
+   const HS071Model model{};
+   Options options{};
+   const Vector<double> x{1.5, 4.2, 3.7, 1.3};
+   const Vector<double> multipliers{0.7, -0.4};
+
+   void SetUp() override {
+      DefaultOptions::load(this->options);
+      this->options.set("finite_difference_threads", std::to_string(GetParam()));
+   }
+
+   // absolute error relative to the magnitude of the exact value
+   static void assert_near(double approximation, double exact_value, double tolerance) {
+      ASSERT_NEAR(approximation, exact_value, tolerance * std::max(1., std::abs(exact_value)));
+   }
+};
+
+TEST_P(FiniteDifferenceModelTests, ObjectiveGradient) {
+   const FiniteDifferenceModel finite_difference_model(this->model, this->options);
+   Vector<double> gradient(4), exact_gradient(4);
+   finite_difference_model.evaluate_objective_gradient(this->x, gradient);
+   this->model.evaluate_objective_gradient(this->x, exact_gradient);
+   for (size_t variable_index = 0; variable_index < 4; ++variable_index) {
+      assert_near(gradient[variable_index], exact_gradient[variable_index], 1e-6);
+   }
+}
+
+TEST_P(FiniteDifferenceModelTests, ConstraintJacobian) {
+   const FiniteDifferenceModel finite_difference_model(this->model, this->options);
+   std::vector<double> jacobian(8), exact_jacobian(8);
+   finite_difference_model.evaluate_constraint_jacobian(this->x, jacobian.data());
+   this->model.evaluate_constraint_jacobian(this->x, exact_jacobian.data());
+   for (size_t nonzero_index = 0; nonzero_index < 8; ++nonzero_index) {
+      assert_near(jacobian[nonzero_index], exact_jacobian[nonzero_index], 1e-6);
+   }
+}
+
+TEST_P(FiniteDifferenceModelTests, LagrangianHessian) {
+   const FiniteDifferenceModel finite_difference_model(this->model, this->options);
+   std::vector<double> hessian(10), exact_hessian(10);
+   finite_difference_model.evaluate_lagrangian_hessian(this->x, 1., this->multipliers, hessian.data());
+   this->model.evaluate_lagrangian_hessian(this->x, 1., this->multipliers, exact_hessian.data());
+   for (size_t nonzero_index = 0; nonzero_index < 10; ++nonzero_index) {
+      assert_near(hessian[nonzero_index], exact_hessian[nonzero_index], 1e-4);
+   }
+}
+
+TEST_P(FiniteDifferenceModelTests, HessianVectorProduct) {
+   const FiniteDifferenceModel finite_difference_model(this->model, this->options);
+   const Vector<double> vector{1., -2., 0.5, 3.};
+   Vector<double> product(4), exact_product(4);
+   finite_difference_model.compute_hessian_vector_product(this->x.data(), vector.data(), 2., this->multipliers, product.data());
+   this->model.compute_hessian_vector_product(this->x.data(), vector.data(), 2., this->multipliers, exact_product.data());
+   for (size_t variable_index = 0; variable_index < 4; ++variable_index) {
+      assert_near(product[variable_index], exact_product[variable_index], 1e-4);
+   }
+}
+
+// the derivative evaluations are serialized: concurrent evaluations give the same values as a sequential one
+TEST_P(FiniteDifferenceModelTests, ConcurrentEvaluations) {
+   const FiniteDifferenceModel finite_difference_model(this->model, this->options);
+   std::vector<double> hessian(10);
+   finite_difference_model.evaluate_lagrangian_hessian(this->x, 1., this->multipliers, hessian.data());
+
+   constexpr size_t number_threads = 4;
+   std::vector<std::vector<double>> concurrent_hessians(number_threads, std::vector<double>(10));
+   std::vector<std::thread> threads;
+   for (size_t thread_index = 0; thread_index < number_threads; ++thread_index) {
+      threads.emplace_back([&, thread_index]() {
+         for (size_t repetition = 0; repetition < 20; ++repetition) {
+            finite_difference_model.evaluate_lagrangian_hessian(this->x, 1., this->multipliers, concurrent_hessians[thread_index].data());
+         }
+      });
+   }
+   for (std::thread& thread: threads) {
+      thread.join();
+   }
+   for (const std::vector<double>& concurrent_hessian: concurrent_hessians) {
+      ASSERT_EQ(concurrent_hessian, hessian);
+   }
+}
+
+INSTANTIATE_TEST_SUITE_P(Threads, FiniteDifferenceModelTests, ::testing::Values(size_t(1), size_t(3)));
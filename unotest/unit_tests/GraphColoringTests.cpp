@@ -0,0 +1,86 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "tools/GraphColoring.hpp"
+
+using namespace uno;
+
+// arrowhead matrix: the first row and column are dense, the rest is diagonal
+TEST(GraphColoring, ArrowheadColumnColoring) {
+   const size_t dimension = 6;
+   std::vector<size_t> row_indices, column_indices;
+   for (size_t index = 0; index < dimension; ++index) {
+      row_indices.push_back(0); column_indices.push_back(index);
+      if (0 < index) {
+         row_indices.push_back(index); column_indices.push_back(index);
+      }
+   }
+   const Coloring coloring = GraphColoring::column_coloring(dimension, dimension, row_indices, column_indices);
+   // the first row is dense: all the columns need a different color
+   ASSERT_EQ(coloring.number_colors, dimension);
+}
+
+TEST(GraphColoring, TridiagonalColumnColoring) {
+   const size_t dimension = 10;
+   std::vector<size_t> row_indices, column_indices;
+   for (size_t index = 0; index < dimension; ++index) {
+      for (size_t column_index = (index == 0 ? 0 : index - 1); column_index <= std::min(index + 1, dimension - 1); ++column_index) {
+         row_indices.push_back(index); column_indices.push_back(column_index);
+      }
+   }
+   const Coloring coloring = GraphColoring::column_coloring(dimension, dimension, row_indices, column_indices);
+   ASSERT_EQ(coloring.number_colors, 3);
+   // two columns with a nonzero in the same row have different colors
+   for (size_t first = 0; first < row_indices.size(); ++first) {
+      for (size_t second = 0; second < row_indices.size(); ++second) {
+         if (row_indices[first] == row_indices[second] && column_indices[first] != column_indices[second]) {
+            ASSERT_NE(coloring.colors[column_indices[first]], coloring.colors[column_indices[second]]);
+         }
+      }
+   }
+}
+
+// symmetric arrowhead matrix (lower triangle): the star coloring needs only 2 colors (the distance-2 coloring needs n)
+TEST(GraphColoring, ArrowheadStarColoring) {
+   const size_t dimension = 6;
+   std::vector<size_t> row_indices, column_indices;
+   for (size_t index = 0; index < dimension; ++index) {
+      row_indices.push_back(index); column_indices.push_back(index);
+      if (0 < index) {
+         row_indices.push_back(index); column_indices.push_back(0);
+      }
+   }
+   const Coloring coloring = GraphColoring::star_coloring(dimension, row_indices, column_indices);
+   ASSERT_EQ(coloring.number_colors, 2);
+}
+
+// every nonzero (i, j) of a star-colored pattern can be recovered directly
+TEST(GraphColoring, TridiagonalStarColoringRecovery) {
+   const size_t dimension = 10;
+   std::vector<size_t> row_indices, column_indices;
+   for (size_t index = 0; index < dimension; ++index) {
+      row_indices.push_back(index); column_indices.push_back(index);
+      if (0 < index) {
+         row_indices.push_back(index); column_indices.push_back(index - 1);
+      }
+   }
+   const Coloring coloring = GraphColoring::star_coloring(dimension, row_indices, column_indices);
+   const std::vector<std::vector<size_t>> adjacency = GraphColoring::adjacency_lists(dimension, row_indices, column_indices);
+   const auto is_only_neighbor_with_color = [&](size_t vertex, size_t neighbor) {
+      return std::count_if(adjacency[vertex].begin(), adjacency[vertex].end(), [&](size_t other_neighbor) {
+         return coloring.colors[other_neighbor] == coloring.colors[neighbor];
+      }) == 1;
+   };
+   for (size_t nonzero_index = 0; nonzero_index < row_indices.size(); ++nonzero_index) {
+      const size_t row_index = row_indices[nonzero_index];
+      const size_t column_index = column_indices[nonzero_index];
+      if (row_index != column_index) {
+         ASSERT_NE(coloring.colors[row_index], coloring.colors[column_index]);
+         ASSERT_TRUE(is_only_neighbor_with_color(row_index, column_index) || is_only_neighbor_with_color(column_index, row_index));
+      }
+   }
+   ASSERT_LE(coloring.number_colors, 3);
+}
@@ -0,0 +1,193 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#ifndef UNO_HS071MODEL_H
+#define UNO_HS071MODEL_H
+
+#include <vector>
+#include "linear_algebra/MatrixOrder.hpp"
+#include "linear_algebra/SparseVector.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "model/Model.hpp"
+#include "symbolic/CollectionAdapter.hpp"
+#include "tools/Infinity.hpp"
+
+namespace uno {
+   // problem 71 of the Hock-Schittkowski collection, with analytic derivatives (test model):
+   // min x0 x3 (x0 + x1 + x2) + x2 s.t. x0 x1 x2 x3 >= 25, x0^2 + x1^2 + x2^2 + x3^2 = 40, 1 <= x <= 5
+   // the Jacobian is dense (row by row) and the Hessian is the upper triangle, column by column
+   class HS071Model: public Model {
+   public:
+      HS071Model(): Model("hs071", 4, 2, 1.) { }
+
+      [[nodiscard]] bool has_jacobian_operator() const override { return true; }
+      [[nodiscard]] bool has_jacobian_transposed_operator() const override { return true; }
+      [[nodiscard]] bool has_hessian_operator() const override { return true; }
+      [[nodiscard]] bool has_hessian_matrix() const override { return true; }
+      [[nodiscard]] bool has_thread_safe_evaluations() const override { return true; }
+
+      [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override {
+         return x[0]*x[3]*(x[0] + x[1] + x[2]) + x[2];
+      }
+
+      void evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override {
+         constraints[0] = x[0]*x[1]*x[2]*x[3];
+         constraints[1] = x[0]*x[0] + x[1]*x[1] + x[2]*x[2] + x[3]*x[3];
+      }
+
+      void evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const override {
+         gradient[0] = x[3]*(2.*x[0] + x[1] + x[2]);
+         gradient[1] = x[0]*x[3];
+         gradient[2] = x[0]*x[3] + 1.;
+         gradient[3] = x[0]*(x[0] + x[1] + x[2]);
+      }
+
+      void compute_constraint_jacobian_sparsity(int* row_indices, int* column_indices, int solver_indexing,
+            MatrixOrder /*matrix_order*/) const override {
+         for (int nonzero_index = 0; nonzero_index < 8; ++nonzero_index) {
+            row_indices[nonzero_index] = nonzero_index/4 + solver_indexing;
+            column_indices[nonzero_index] = nonzero_index%4 + solver_indexing;
+         }
+      }
+
+      void compute_hessian_sparsity(int* row_indices, int* column_indices, int solver_indexing) const override {
+         int nonzero_index = 0;
+         for (int column_index = 0; column_index < 4; ++column_index) {
+            for (int row_index = 0; row_index <= column_index; ++row_index) {
+               row_indices[nonzero_index] = row_index + solver_indexing;
+               column_indices[nonzero_index] = column_index + solver_indexing;
+               ++nonzero_index;
+            }
+         }
+      }
+
+      void evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const override {
+         jacobian_values[0] = x[1]*x[2]*x[3];
+         jacobian_values[1] = x[0]*x[2]*x[3];
+         jacobian_values[2] = x[0]*x[1]*x[3];
+         jacobian_values[3] = x[0]*x[1]*x[2];
+         for (size_t variable_index = 0; variable_index < 4; ++variable_index) {
+            jacobian_values[4 + variable_index] = 2.*x[variable_index];
+         }
+      }
+
+      void evaluate_lagrangian_hessian(const Vector<double>& x, double objective_multiplier, const Vector<double>& multipliers,
+            double* hessian_values) const override {
+         double hessian[4][4];
+         HS071Model::dense_lagrangian_hessian(x.data(), objective_multiplier, multipliers, hessian);
+         size_t nonzero_index = 0;
+         for (size_t column_index = 0; column_index < 4; ++column_index) {
+            for (size_t row_index = 0; row_index <= column_index; ++row_index) {
+               hessian_values[nonzero_index++] = hessian[row_index][column_index];
+            }
+         }
+      }
+
+      void compute_hessian_vector_product(const double* x, const double* vector, double objective_multiplier,
+            const Vector<double>& multipliers, double* result) const override {
+         double hessian[4][4];
+         HS071Model::dense_lagrangian_hessian(x, objective_multiplier, multipliers, hessian);
+         for (size_t row_index = 0; row_index < 4; ++row_index) {
+            result[row_index] = 0.;
+            for (size_t column_index = 0; column_index < 4; ++column_index) {
+               result[row_index] += hessian[row_index][column_index]*vector[column_index];
+            }
+         }
+      }
+
+      [[nodiscard]] double variable_lower_bound(size_t /*variable_index*/) const override { return 1.; }
+      [[nodiscard]] double variable_upper_bound(size_t /*variable_index*/) const override { return 5.; }
+      [[nodiscard]] const SparseVector<size_t>& get_slacks() const override { return this->slacks; }
+      [[nodiscard]] const Vector<size_t>& get_fixed_variables() const override { return this->fixed_variables; }
+
+      [[nodiscard]] double constraint_lower_bound(size_t constraint_index) const override {
+         return (constraint_index == 0) ? 25. : 40.;
+      }
+      [[nodiscard]] double constraint_upper_bound(size_t constraint_index) const override {
+         return (constraint_index == 0) ? INF<double> : 40.;
+      }
+      [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override { return this->equality_constraints; }
+      [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override { return this->inequality_constraints; }
+      [[nodiscard]] const Collection<size_t>& get_linear_constraints() const override { return this->linear_constraints; }
+
+      void initial_primal_point(Vector<double>& x) const override {
+         x[0] = 1.;
+         x[1] = 5.;
+         x[2] = 5.;
+         x[3] = 1.;
+      }
+      void initial_dual_point(Vector<double>& multipliers) const override { multipliers.fill(0.); }
+      void postprocess_solution(Iterate& /*iterate*/) const override { }
+
+      [[nodiscard]] size_t number_jacobian_nonzeros() const override { return 8; }
+      [[nodiscard]] size_t number_hessian_nonzeros() const override { return 10; }
+
+      // dense Hessian of the Lagrangian rho f(x) - y^T c(x)
+      static void dense_lagrangian_hessian(const double* x, double objective_multiplier, const Vector<double>& multipliers,
+            double hessian[4][4]) {
+         const double objective_hessian[4][4] = {
+            {2.*x[3], x[3], x[3], 2.*x[0] + x[1] + x[2]},
+            {x[3], 0., 0., x[0]},
+            {x[3], 0., 0., x[0]},
+            {2.*x[0] + x[1] + x[2], x[0], x[0], 0.}
+         };
+         const double product_hessian[4][4] = {
+            {0., x[2]*x[3], x[1]*x[3], x[1]*x[2]},
+            {x[2]*x[3], 0., x[0]*x[3], x[0]*x[2]},
+            {x[1]*x[3], x[0]*x[3], 0., x[0]*x[1]},
+            {x[1]*x[2], x[0]*x[2], x[0]*x[1], 0.}
+         };
+         for (size_t row_index = 0; row_index < 4; ++row_index) {
+            for (size_t column_index = 0; column_index < 4; ++column_index) {
+               hessian[row_index][column_index] = objective_multiplier*objective_hessian[row_index][column_index] -
+                  multipliers[0]*product_hessian[row_index][column_index] - ((row_index == column_index) ? 2.*multipliers[1] : 0.);
+            }
+         }
+      }
+
+   protected:
+      std::vector<size_t> equality_constraint_indices{1};
+      std::vector<size_t> inequality_constraint_indices{0};
+      std::vector<size_t> linear_constraint_indices{};
+      CollectionAdapter<std::vector<size_t>> equality_constraints{this->equality_constraint_indices};
+      CollectionAdapter<std::vector<size_t>> inequality_constraints{this->inequality_constraint_indices};
+      CollectionAdapter<std::vector<size_t>> linear_constraints{this->linear_constraint_indices};
+      SparseVector<size_t> slacks{};
+      Vector<size_t> fixed_variables{};
+   };
+
+   // HS071 whose Jacobian nonzeros follow the order of the last sparsity query (test model). In column-major order,
+   // the nonzero (i, j) is stored at position 2 j + i
+   class OrderedHS071Model: public HS071Model {
+   public:
+      mutable size_t number_jacobian_evaluations{0};
+
+      void compute_constraint_jacobian_sparsity(int* row_indices, int* column_indices, int solver_indexing,
+            MatrixOrder matrix_order) const override {
+         HS071Model::compute_constraint_jacobian_sparsity(row_indices, column_indices, solver_indexing, matrix_order);
+         if (matrix_order == MatrixOrder::COLUMN_MAJOR) {
+            for (int nonzero_index = 0; nonzero_index < 8; ++nonzero_index) {
+               row_indices[nonzero_index] = nonzero_index%2 + solver_indexing;
+               column_indices[nonzero_index] = nonzero_index/2 + solver_indexing;
+            }
+         }
+         this->matrix_order = matrix_order;
+      }
+
+      void evaluate_constraint_jacobian(const Vector<double>& x, double* jacobian_values) const override {
+         ++this->number_jacobian_evaluations;
+         double row_major_values[8];
+         HS071Model::evaluate_constraint_jacobian(x, row_major_values);
+         for (size_t nonzero_index = 0; nonzero_index < 8; ++nonzero_index) {
+            const size_t position = (this->matrix_order == MatrixOrder::ROW_MAJOR) ? nonzero_index :
+               2*(nonzero_index%4) + nonzero_index/4;
+            jacobian_values[position] = row_major_values[nonzero_index];
+         }
+      }
+
+   protected:
+      mutable MatrixOrder matrix_order{MatrixOrder::ROW_MAJOR};
+   };
+} // namespace
+
+#endif // UNO_HS071MODEL_H
@@ -0,0 +1,94 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "HS071Model.hpp"
+#include "ingredients/hessian_models/IdentityHessian.hpp"
+#include "ingredients/subproblem/Subproblem.hpp"
+#include "ingredients/regularization_strategies/NoRegularization.hpp"
+#include "ingredients/subproblem_solvers/MINRES/MINRESSolver.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "optimization/Iterate.hpp"
+#include "optimization/OptimizationProblem.hpp"
+#include "optimization/WarmstartInformation.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+#include "tools/Infinity.hpp"
+#include "tools/Statistics.hpp"
+
+using namespace uno;
+
+// the systems [I J^T; J 0] of HS071 at the initial point x = (1, 5, 5, 1), where g = (12, 1, 2, 11), c = (25, 52) and
+// J = [25 5 5 25; 2 10 10 2]: J J^T = [1300 200; 200 208]
+class MINRESSolverTests: public ::testing::Test {
+protected:
+   const HS071Model model{};
+   const OptimizationProblem problem{this->model};
+   Iterate iterate{4, 2};
+   Options options{};
+   Statistics statistics{};
+   const std::vector<double> gradient{12., 1., 2., 11.};
+   const std::vector<double> constraints{25., 52.};
+   const double jacobian[2][4] = {{25., 5., 5., 25.}, {2., 10., 10., 2.}};
+
+   void SetUp() override {
+      DefaultOptions::load(this->options);
+      this->model.initial_primal_point(this->iterate.primals);
+   }
+
+   // solution of [I J^T; J 0] [x; y] = [primal_rhs; dual_rhs]: y solves (J J^T) y = J primal_rhs - dual_rhs
+   [[nodiscard]] std::vector<double> solve_exactly(const std::vector<double>& primal_rhs, const std::vector<double>& dual_rhs) const {
+      double reduced_rhs[2];
+      for (size_t constraint_index = 0; constraint_index < 2; ++constraint_index) {
+         reduced_rhs[constraint_index] = -dual_rhs[constraint_index];
+         for (size_t variable_index = 0; variable_index < 4; ++variable_index) {
+            reduced_rhs[constraint_index] += this->jacobian[constraint_index][variable_index]*primal_rhs[variable_index];
+         }
+      }
+      const double determinant = 1300.*208. - 200.*200.;
+      const double y0 = (208.*reduced_rhs[0] - 200.*reduced_rhs[1]) / determinant;
+      const double y1 = (1300.*reduced_rhs[1] - 200.*reduced_rhs[0]) / determinant;
+      std::vector<double> solution(6);
+      for (size_t variable_index = 0; variable_index < 4; ++variable_index) {
+         solution[variable_index] = primal_rhs[variable_index] - this->jacobian[0][variable_index]*y0 - this->jacobian[1][variable_index]*y1;
+      }
+      solution[4] = y0;
+      solution[5] = y1;
+      return solution;
+   }
+};
+
+TEST_F(MINRESSolverTests, LeastSquareSystem) {
+   // RHS [g; 0]: x = (0.5, -0.5, 0.5, -0.5) and y = (7/15, -1/12)
+   MINRESSolver linear_solver(this->options);
+   linear_solver.initialize_least_square_system(this->problem);
+   Vector<double> solution(6);
+   linear_solver.solve_least_square_system(this->problem, this->iterate, solution);
+   ASSERT_FALSE(linear_solver.matrix_is_singular());
+   const std::vector<double> expected_solution{0.5, -0.5, 0.5, -0.5, 7./15., -1./12.};
+   for (size_t index = 0; index < 6; ++index) {
+      ASSERT_NEAR(solution[index], expected_solution[index], 1e-8);
+   }
+}
+
+TEST_F(MINRESSolverTests, AugmentedSystem) {
+   // identity Hessian: RHS [-g; -c] without regularization (the curvature test holds)
+   IdentityHessian hessian_model;
+   NoRegularization<double> regularization_strategy;
+   const Subproblem subproblem{this->problem, this->iterate, hessian_model, regularization_strategy, INF<double>};
+   MINRESSolver linear_solver(this->options);
+   linear_solver.initialize_statistics(this->statistics, this->options);
+   linear_solver.initialize_augmented_system(subproblem);
+
+   // the systems are solved one after the other: both solutions are identical
+   Vector<double> solutions;
+   linear_solver.solve_indefinite_systems(this->statistics, subproblem, subproblem, WarmstartInformation{}, solutions);
+   ASSERT_FALSE(linear_solver.matrix_is_singular());
+   ASSERT_EQ(solutions.size(), 12);
+   const std::vector<double> expected_solution = this->solve_exactly({-12., -1., -2., -11.}, {-25., -52.});
+   for (size_t index = 0; index < 6; ++index) {
+      ASSERT_NEAR(solutions[index], expected_solution[index], 1e-8);
+      ASSERT_NEAR(solutions[6 + index], expected_solution[index], 1e-8);
+   }
+}
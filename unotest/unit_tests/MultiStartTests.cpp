@@ -0,0 +1,65 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <vector>
+#include "HS071Model.hpp"
+#include "MultiStart.hpp"
+#include "Uno.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "model/HomogeneousEqualityConstrainedModel.hpp"
+#include "model/InitialPointModel.hpp"
+#include "optimization/Result.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+#include "options/Presets.hpp"
+#include "tools/Logger.hpp"
+
+using namespace uno;
+
+// HS071 with a slack for the inequality constraint, solved by a line-search SQP method with the truncated CG
+class MultiStartTests: public ::testing::Test {
+protected:
+   const HS071Model hs071_model{};
+   const HomogeneousEqualityConstrainedModel model{hs071_model};
+   Options options{};
+   std::ostringstream output{};
+
+   void SetUp() override {
+      DefaultOptions::load(this->options);
+      Presets::set(this->options, "filtersqp");
+      this->options.set("globalization_mechanism", "LS");
+      this->options.set("QP_solver", "TruncatedCG");
+      this->options.set("multistart_number_points", "4");
+      this->options.set("multistart_threads", "2");
+   }
+};
+
+TEST_F(MultiStartTests, BestRunMappedToOriginalModel) {
+   const Logger::Redirection redirection(this->output);
+   MultiStart multistart(this->options);
+   const Result result = multistart.solve(this->model, this->options);
+   ASSERT_TRUE(MultiStart::is_feasible(result));
+   ASSERT_EQ(result.number_variables, this->model.number_variables);
+   ASSERT_EQ(result.primal_solution.size(), this->model.number_variables);
+
+   // the reported best run is at least as good as each run solved separately
+   const std::vector<Vector<double>> starting_points = multistart.generate_starting_points(this->model);
+   ASSERT_EQ(starting_points.size(), 4);
+   for (const Vector<double>& starting_point: starting_points) {
+      const InitialPointModel start_model(this->model, starting_point);
+      Uno uno{};
+      const Result start_result = uno.solve(start_model, this->options);
+      ASSERT_FALSE(MultiStart::is_better(start_result, result));
+   }
+
+   // the primals of the best run are a solution of the original model
+   ASSERT_NEAR(this->model.evaluate_objective(result.primal_solution), result.solution_objective, 1e-10);
+   std::vector<double> constraints(this->model.number_constraints);
+   this->model.evaluate_constraints(result.primal_solution, constraints);
+   ASSERT_LE(this->model.constraint_violation(constraints, Norm::INF), this->options.get_double("primal_tolerance"));
+   // the original HS071 variables are those of the reformulated model
+   const Vector<double> x{result.primal_solution[0], result.primal_solution[1], result.primal_solution[2], result.primal_solution[3]};
+   ASSERT_NEAR(this->hs071_model.evaluate_objective(x), result.solution_objective, 1e-10);
+}
@@ -0,0 +1,145 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include "HS071Model.hpp"
+#include "ingredients/subproblem_solvers/COOEvaluationSpace.hpp"
+#include "ingredients/subproblem_solvers/DirectSymmetricIndefiniteLinearSolver.hpp"
+#include "ingredients/subproblem_solvers/SymmetricIndefiniteLinearSolverFactory.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "optimization/Iterate.hpp"
+#include "optimization/OptimizationProblem.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+
+using namespace uno;
+
+// dense solver (Gaussian elimination with partial pivoting, the matrix is stored column by column) without a native
+// multiple-RHS solve: the fallback of DirectSymmetricIndefiniteLinearSolver is used
+class DenseTestSolver: public DirectSymmetricIndefiniteLinearSolver<double> {
+public:
+   explicit DenseTestSolver(size_t dimension): dimension(dimension) { }
+
+   void initialize_hessian(const Subproblem& /*subproblem*/) override { }
+   void initialize_augmented_system(const Subproblem& /*subproblem*/) override { }
+   void initialize_least_square_system(const OptimizationProblem& /*problem*/) override { }
+   void do_symbolic_analysis() override { }
+   void do_numerical_factorization(const double* /*matrix_values*/) override { }
+   [[nodiscard]] bool increase_pivot_tolerance() override { return false; }
+
+   using DirectSymmetricIndefiniteLinearSolver<double>::solve_indefinite_system;
+   void solve_indefinite_system(const Vector<double>& matrix_values, const Vector<double>& rhs, Vector<double>& result) override {
+      std::vector<double> matrix(matrix_values.begin(), matrix_values.end());
+      result = rhs;
+      const size_t n = this->dimension;
+      const auto entry = [&](size_t row_index, size_t column_index) -> double& { return matrix[column_index*n + row_index]; };
+      for (size_t column_index = 0; column_index < n; ++column_index) {
+         size_t pivot_index = column_index;
+         for (size_t row_index = column_index + 1; row_index < n; ++row_index) {
+            if (std::abs(entry(pivot_index, column_index)) < std::abs(entry(row_index, column_index))) {
+               pivot_index = row_index;
+            }
+         }
+         for (size_t index = 0; index < n; ++index) {
+            std::swap(entry(column_index, index), entry(pivot_index, index));
+         }
+         std::swap(result[column_index], result[pivot_index]);
+         for (size_t row_index = column_index + 1; row_index < n; ++row_index) {
+            const double factor = entry(row_index, column_index) / entry(column_index, column_index);
+            for (size_t index = column_index; index < n; ++index) {
+               entry(row_index, index) -= factor * entry(column_index, index);
+            }
+            result[row_index] -= factor * result[column_index];
+         }
+      }
+      for (size_t row_index = n; 0 < row_index--;) {
+         for (size_t index = row_index + 1; index < n; ++index) {
+            result[row_index] -= entry(row_index, index) * result[index];
+         }
+         result[row_index] /= entry(row_index, row_index);
+      }
+   }
+   void solve_indefinite_system(Statistics& /*statistics*/, const Subproblem& /*subproblem*/, Direction& /*direction*/,
+         const WarmstartInformation& /*warmstart_information*/) override { }
+   void solve_indefinite_systems(Statistics& /*statistics*/, const Subproblem& /*subproblem*/, const Subproblem& /*second_subproblem*/,
+         const WarmstartInformation& /*warmstart_information*/, Vector<double>& /*solutions*/) override { }
+   void solve_indefinite_system_with_corrected_constraints(const Subproblem& /*subproblem*/,
+         const std::vector<double>& /*corrected_constraints*/, Direction& /*direction*/) override { }
+   void solve_indefinite_system_with_new_objective_gradient(const Subproblem& /*subproblem*/, Vector<double>& /*solution*/) override { }
+   void solve_least_square_system(const OptimizationProblem& /*problem*/, Iterate& /*iterate*/, Vector<double>& /*solution*/) override { }
+
+   [[nodiscard]] Inertia get_inertia() const override { return {0, 0, 0}; }
+   [[nodiscard]] size_t number_negative_eigenvalues() const override { return 0; }
+   [[nodiscard]] size_t rank() const override { return this->dimension; }
+   [[nodiscard]] bool matrix_is_singular() const override { return false; }
+   [[nodiscard]] EvaluationSpace& get_evaluation_space() override { throw std::runtime_error("No evaluation space"); }
+
+protected:
+   const size_t dimension;
+};
+
+// solve the stacked right-hand sides at once, then column by column, and compare the solutions
+static void compare_with_column_solves(DirectSymmetricIndefiniteLinearSolver<double>& linear_solver, const Vector<double>& matrix_values,
+      size_t dimension, size_t number_rhs) {
+   Vector<double> stacked_rhs(dimension * number_rhs);
+   for (size_t index = 0; index < stacked_rhs.size(); ++index) {
+      stacked_rhs[index] = std::cos(static_cast<double>(index + 1));
+   }
+   Vector<double> stacked_solutions(dimension * number_rhs);
+   linear_solver.solve_indefinite_system(matrix_values, stacked_rhs, stacked_solutions, number_rhs);
+
+   Vector<double> rhs(dimension), solution(dimension);
+   for (size_t rhs_index = 0; rhs_index < number_rhs; ++rhs_index) {
+      for (size_t index = 0; index < dimension; ++index) {
+         rhs[index] = stacked_rhs[rhs_index*dimension + index];
+      }
+      linear_solver.solve_indefinite_system(matrix_values, rhs, solution);
+      for (size_t index = 0; index < dimension; ++index) {
+         ASSERT_NEAR(stacked_solutions[rhs_index*dimension + index], solution[index], 1e-12);
+      }
+   }
+}
+
+TEST(MultipleRHS, Fallback) {
+   // symmetric indefinite matrix [2 1 0; 1 -3 1; 0 1 4] (column by column)
+   const Vector<double> matrix_values{2., 1., 0., 1., -3., 1., 0., 1., 4.};
+   DenseTestSolver linear_solver(3);
+   compare_with_column_solves(linear_solver, matrix_values, 3, 3);
+
+   // the solution of the first RHS (1, 0, 0) is the first column of the inverse
+   const Vector<double> rhs{1., 0., 0., 0., 0., 1.};
+   Vector<double> solutions(6);
+   linear_solver.solve_indefinite_system(matrix_values, rhs, solutions, 2);
+   const double determinant = 2.*(-3.*4. - 1.) - 1.*(1.*4.);
+   ASSERT_NEAR(solutions[0], (-3.*4. - 1.) / determinant, 1e-14);
+   ASSERT_NEAR(solutions[1], -4. / determinant, 1e-14);
+   ASSERT_NEAR(solutions[2], 1. / determinant, 1e-14);
+}
+
+// native multiple-RHS solves of the available direct solvers on the least-square system [I J^T; J 0] of HS071
+TEST(MultipleRHS, DirectSolvers) {
+   const std::vector<std::string> solvers = SymmetricIndefiniteLinearSolverFactory::available_solvers();
+   if (solvers.empty()) {
+      GTEST_SKIP() << "No direct linear solver is available";
+   }
+   Options options;
+   DefaultOptions::load(options);
+   const HS071Model model{};
+   const OptimizationProblem problem{model};
+   Iterate iterate(problem.number_variables, problem.number_constraints);
+   model.initial_primal_point(iterate.primals);
+   const size_t dimension = problem.number_variables + problem.number_constraints;
+
+   for (const std::string& solver_name: solvers) {
+      const auto linear_solver = SymmetricIndefiniteLinearSolverFactory::create(solver_name, options);
+      linear_solver->initialize_least_square_system(problem);
+      Vector<double> solution(dimension);
+      linear_solver->solve_least_square_system(problem, iterate, solution);
+      const auto& evaluation_space = dynamic_cast<COOEvaluationSpace&>(linear_solver->get_evaluation_space());
+      compare_with_column_solves(*linear_solver, evaluation_space.get_factorized_matrix_values(), dimension, 3);
+   }
+}
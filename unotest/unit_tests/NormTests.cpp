@@ -0,0 +1,45 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "linear_algebra/Norm.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "symbolic/Expression.hpp"
+
+using namespace uno;
+
+const double tolerance = 1e-12;
+
+TEST(Norm, ContiguousKernels) {
+   // odd size to exercise the remainder loops and the pairwise splitting
+   const size_t size = 1001;
+   Vector<double> x(size);
+   for (size_t index: Range(size)) {
+      x[index] = (index % 2 == 0) ? static_cast<double>(index) : -static_cast<double>(index);
+   }
+   const double n = static_cast<double>(size - 1);
+   ASSERT_NEAR(norm_1(x), n*(n + 1.)/2., tolerance);
+   ASSERT_NEAR(norm_2_squared(x), n*(n + 1.)*(2.*n + 1.)/6., tolerance);
+   ASSERT_EQ(norm_inf(x), n);
+}
+
+TEST(Norm, ContiguousAndGenericAgree) {
+   const std::vector<double> x{1., -2., 3., -4., 5.};
+   const Vector<double> y{-1., 2., -3., 4., -5.};
+   // the expression uses the generic fallback
+   const auto expression = y + 2. * y;
+   ASSERT_EQ(norm_1(x), 15.);
+   ASSERT_EQ(norm_2_squared(x), 55.);
+   ASSERT_EQ(norm_inf(x), 5.);
+   ASSERT_EQ(norm_1(expression), 45.);
+   ASSERT_EQ(norm_inf(expression), 15.);
+   ASSERT_EQ(norm(Norm::L1, x, y), 30.);
+}
+
+// pairwise summation keeps the rounding error small on long arrays
+TEST(Norm, PairwiseSummation) {
+   const size_t size = 1000000;
+   const std::vector<double> x(size, 0.1);
+   ASSERT_NEAR(norm_1(x), 100000., 1e-8);
+}
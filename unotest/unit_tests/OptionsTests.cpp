@@ -0,0 +1,93 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+#include "options/Options.hpp"
+#include "options/UsedOptions.hpp"
+#include "tools/ThreadPool.hpp"
+
+using namespace uno;
+
+TEST(Options, TypedGetters) {
+   Options options;
+   options.set("tolerance", "1e-8");
+   options.set("iterations", "100");
+   options.set("flag", "yes");
+   options.set("name", "ipopt");
+   ASSERT_EQ(options.get_double("tolerance"), 1e-8);
+   ASSERT_EQ(options.get_int("iterations"), 100);
+   ASSERT_EQ(options.get_unsigned_int("iterations"), 100);
+   ASSERT_TRUE(options.get_bool("flag"));
+   ASSERT_EQ(options.get_string("name"), "ipopt");
+   ASSERT_FALSE(options.get_string_optional("unknown").has_value());
+   ASSERT_THROW((void)options.get_double("name"), std::invalid_argument);
+   ASSERT_THROW((void)options.get_double("unknown"), std::out_of_range);
+}
+
+TEST(Options, ValidatedNumbers) {
+   Options options;
+   options.set("partial", "1.5abc");
+   options.set("scientific", "1e-8");
+   options.set("subnormal", "1e-320");
+   options.set("overflow", "1e400");
+   options.set("whitespace", " 42 ");
+   options.set("empty", "");
+   // the whole value must be a number
+   ASSERT_THROW((void)options.get_double("partial"), std::invalid_argument);
+   ASSERT_THROW((void)options.get_int("partial"), std::invalid_argument);
+   ASSERT_EQ(options.get_double("scientific"), 1e-8);
+   ASSERT_THROW((void)options.get_int("scientific"), std::invalid_argument);
+   // an underflow yields a subnormal number, an overflow is rejected
+   ASSERT_EQ(options.get_double("subnormal"), 1e-320);
+   ASSERT_THROW((void)options.get_double("overflow"), std::invalid_argument);
+   ASSERT_EQ(options.get_int("whitespace"), 42);
+   ASSERT_EQ(options.get_double("whitespace"), 42.);
+   ASSERT_THROW((void)options.get_double("empty"), std::invalid_argument);
+}
+
+TEST(Options, UsedOptionsPerScope) {
+   Options options;
+   options.set("a", "1");
+   options.set("b", "2");
+   UsedOptions first_used_options, second_used_options;
+   {
+      const UsedOptions::Scope scope(first_used_options);
+      (void)options.get_int("a");
+   }
+   {
+      const UsedOptions::Scope scope(second_used_options);
+      (void)options.get_int("b");
+   }
+   // reads outside a scope are not recorded
+   (void)options.get_int("a");
+   (void)options.get_int("b");
+   ASSERT_TRUE(first_used_options.is_used(0));
+   ASSERT_FALSE(first_used_options.is_used(1));
+   ASSERT_FALSE(second_used_options.is_used(0));
+   ASSERT_TRUE(second_used_options.is_used(1));
+}
+
+TEST(Options, ConcurrentReads) {
+   Options options;
+   for (size_t option_index = 0; option_index < 100; ++option_index) {
+      options.set("option" + std::to_string(option_index), std::to_string(option_index));
+   }
+   ThreadPool thread_pool(4);
+   std::vector<UsedOptions> used_options(8);
+   std::vector<size_t> sums(used_options.size(), 0);
+   thread_pool.parallel_for(used_options.size(), [&](size_t solve_index, size_t /*thread_index*/) {
+      const UsedOptions::Scope scope(used_options[solve_index]);
+      // each "solve" reads every other option, starting at a different parity
+      for (size_t option_index = solve_index % 2; option_index < 100; option_index += 2) {
+         sums[solve_index] += options.get_unsigned_int("option" + std::to_string(option_index));
+      }
+   });
+   for (size_t solve_index = 0; solve_index < used_options.size(); ++solve_index) {
+      ASSERT_EQ(sums[solve_index], (solve_index % 2 == 0) ? 2450 : 2500);
+      for (size_t option_index = 0; option_index < 100; ++option_index) {
+         ASSERT_EQ(used_options[solve_index].is_used(option_index), option_index % 2 == solve_index % 2);
+      }
+   }
+}
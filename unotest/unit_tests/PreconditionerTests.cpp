@@ -0,0 +1,327 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "HS071Model.hpp"
+#include "ingredients/hessian_models/ExactHessian.hpp"
+#include "ingredients/inequality_handling_methods/interior_point_methods/PrimalDualInteriorPointProblem.hpp"
+#include "ingredients/subproblem/Subproblem.hpp"
+#include "ingredients/regularization_strategies/NoRegularization.hpp"
+#include "ingredients/subproblem_solvers/OperatorEvaluationSpace.hpp"
+#include "ingredients/subproblem_solvers/preconditioners/IdentityPreconditioner.hpp"
+#include "ingredients/subproblem_solvers/preconditioners/IncompleteLDLPreconditioner.hpp"
+#include "ingredients/subproblem_solvers/preconditioners/JacobiPreconditioner.hpp"
+#include "ingredients/subproblem_solvers/preconditioners/LimitedMemoryPreconditioner.hpp"
+#include "linear_algebra/SparseVector.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "model/Model.hpp"
+#include "optimization/Iterate.hpp"
+#include "optimization/OptimizationProblem.hpp"
+#include "optimization/WarmstartInformation.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+#include "symbolic/CollectionAdapter.hpp"
+#include "tools/Infinity.hpp"
+#include "tools/Statistics.hpp"
+
+using namespace uno;
+
+// equality-constrained QP with a tridiagonal Hessian (test model): min 1/2 x^T tridiag(-1, 4, -1) x s.t. x_{n-1} = 0.
+// The augmented matrix [H J^T; J 0] is tridiagonal
+class TridiagonalQPModel: public Model {
+public:
+   explicit TridiagonalQPModel(size_t number_variables): Model("tridiagonal_qp", number_variables, 1, 1.) { }
+
+   [[nodiscard]] bool has_jacobian_operator() const override { return true; }
+   [[nodiscard]] bool has_jacobian_transposed_operator() const override { return true; }
+   [[nodiscard]] bool has_hessian_operator() const override { return true; }
+   [[nodiscard]] bool has_hessian_matrix() const override { return true; }
+
+   [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override {
+      double objective = 0.;
+      for (size_t variable_index = 0; variable_index < this->number_variables; ++variable_index) {
+         objective += 2.*x[variable_index]*x[variable_index];
+         if (0 < variable_index) {
+            objective -= x[variable_index - 1]*x[variable_index];
+         }
+      }
+      return objective;
+   }
+   void evaluate_constraints(const Vector<double>& x, std::vector<double>& constraints) const override {
+      constraints[0] = x[this->number_variables - 1];
+   }
+
+   void evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const override {
+      this->compute_hessian_vector_product(x.data(), x.data(), 1., Vector<double>{}, gradient.data());
+   }
+
+   void compute_constraint_jacobian_sparsity(int* row_indices, int* column_indices, int solver_indexing,
+         MatrixOrder /*matrix_order*/) const override {
+      row_indices[0] = solver_indexing;
+      column_indices[0] = static_cast<int>(this->number_variables - 1) + solver_indexing;
+   }
+
+   // upper triangle, column by column
+   void compute_hessian_sparsity(int* row_indices, int* column_indices, int solver_indexing) const override {
+      size_t nonzero_index = 0;
+      for (size_t column_index = 0; column_index < this->number_variables; ++column_index) {
+         if (0 < column_index) {
+            row_indices[nonzero_index] = static_cast<int>(column_index - 1) + solver_indexing;
+            column_indices[nonzero_index] = static_cast<int>(column_index) + solver_indexing;
+            ++nonzero_index;
+         }
+         row_indices[nonzero_index] = static_cast<int>(column_index) + solver_indexing;
+         column_indices[nonzero_index] = static_cast<int>(column_index) + solver_indexing;
+         ++nonzero_index;
+      }
+   }
+
+   void evaluate_constraint_jacobian(const Vector<double>& /*x*/, double* jacobian_values) const override {
+      jacobian_values[0] = 1.;
+   }
+
+   void evaluate_lagrangian_hessian(const Vector<double>& /*x*/, double objective_multiplier, const Vector<double>& /*multipliers*/,
+         double* hessian_values) const override {
+      size_t nonzero_index = 0;
+      for (size_t column_index = 0; column_index < this->number_variables; ++column_index) {
+         if (0 < column_index) {
+            hessian_values[nonzero_index++] = -objective_multiplier;
+         }
+         hessian_values[nonzero_index++] = 4.*objective_multiplier;
+      }
+   }
+
+   void compute_hessian_vector_product(const double* /*x*/, const double* vector, double objective_multiplier,
+         const Vector<double>& /*multipliers*/, double* result) const override {
+      for (size_t variable_index = 0; variable_index < this->number_variables; ++variable_index) {
+         result[variable_index] = 4.*vector[variable_index];
+         if (0 < variable_index) {
+            result[variable_index] -= vector[variable_index - 1];
+         }
+         if (variable_index + 1 < this->number_variables) {
+            result[variable_index] -= vector[variable_index + 1];
+         }
+         result[variable_index] *= objective_multiplier;
+      }
+   }
+
+   [[nodiscard]] double variable_lower_bound(size_t /*variable_index*/) const override { return -INF<double>; }
+   [[nodiscard]] double variable_upper_bound(size_t /*variable_index*/) const override { return INF<double>; }
+   [[nodiscard]] const SparseVector<size_t>& get_slacks() const override { return this->slacks; }
+   [[nodiscard]] const Vector<size_t>& get_fixed_variables() const override { return this->fixed_variables; }
+
+   [[nodiscard]] double constraint_lower_bound(size_t /*constraint_index*/) const override { return 0.; }
+   [[nodiscard]] double constraint_upper_bound(size_t /*constraint_index*/) const override { return 0.; }
+   [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override { return this->equality_constraints; }
+   [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override { return this->no_constraints; }
+   [[nodiscard]] const Collection<size_t>& get_linear_constraints() const override { return this->equality_constraints; }
+
+   void initial_primal_point(Vector<double>& x) const override { x.fill(1.); }
+   void initial_dual_point(Vector<double>& multipliers) const override { multipliers.fill(0.); }
+   void postprocess_solution(Iterate& /*iterate*/) const override { }
+
+   [[nodiscard]] size_t number_jacobian_nonzeros() const override { return 1; }
+   [[nodiscard]] size_t number_hessian_nonzeros() const override { return 2*this->number_variables - 1; }
+
+protected:
+   std::vector<size_t> equality_constraint_indices{0};
+   std::vector<size_t> constraint_indices{};
+   CollectionAdapter<std::vector<size_t>> equality_constraints{this->equality_constraint_indices};
+   CollectionAdapter<std::vector<size_t>> no_constraints{this->constraint_indices};
+   SparseVector<size_t> slacks{};
+   Vector<size_t> fixed_variables{};
+};
+
+// exposes the Ritz pairs of the limited-memory preconditioner
+class TestLimitedMemoryPreconditioner: public LimitedMemoryPreconditioner {
+public:
+   using LimitedMemoryPreconditioner::LimitedMemoryPreconditioner;
+
+   [[nodiscard]] size_t get_number_ritz_vectors() const { return this->number_ritz_vectors; }
+   [[nodiscard]] const Vector<double>& get_ritz_vector(size_t ritz_index) const { return this->ritz_vectors[ritz_index]; }
+   [[nodiscard]] double get_ritz_coefficient(size_t ritz_index) const { return this->ritz_coefficients[ritz_index]; }
+};
+
+// on a tridiagonal pattern, the factorization without fill-in is exact: the preconditioner is L |D| L^T, where L D L^T is
+// the (dense) factorization of the augmented matrix
+TEST(Preconditioner, IncompleteLDLIsExactOnTridiagonalPattern) {
+   constexpr size_t number_variables = 3;
+   constexpr size_t dimension = number_variables + 1;
+   Options options;
+   DefaultOptions::load(options);
+   const TridiagonalQPModel model(number_variables);
+   const OptimizationProblem problem{model};
+   Iterate iterate(problem.number_variables, problem.number_constraints);
+   model.initial_primal_point(iterate.primals);
+   ExactHessian hessian_model;
+   NoRegularization<double> regularization_strategy;
+   const Subproblem subproblem{problem, iterate, hessian_model, regularization_strategy, INF<double>};
+   OperatorEvaluationSpace evaluation_space;
+   evaluation_space.initialize(problem);
+   evaluation_space.evaluate_functions(problem, iterate, WarmstartInformation{});
+   Statistics statistics(false);
+
+   IncompleteLDLPreconditioner preconditioner(options);
+   preconditioner.initialize(subproblem, evaluation_space);
+   preconditioner.evaluate(statistics, subproblem, evaluation_space);
+   preconditioner.regularize(subproblem, evaluation_space, 0., 0.);
+
+   // dense augmented matrix and its LDL^T factorization (no pivoting)
+   double matrix[dimension][dimension] = {
+      {4., -1., 0., 0.},
+      {-1., 4., -1., 0.},
+      {0., -1., 4., 1.},
+      {0., 0., 1., 0.}
+   };
+   double lower_factor[dimension][dimension] = {};
+   double diagonal[dimension] = {};
+   for (size_t column_index = 0; column_index < dimension; ++column_index) {
+      diagonal[column_index] = matrix[column_index][column_index];
+      for (size_t index = 0; index < column_index; ++index) {
+         diagonal[column_index] -= lower_factor[column_index][index]*lower_factor[column_index][index]*diagonal[index];
+      }
+      lower_factor[column_index][column_index] = 1.;
+      for (size_t row_index = column_index + 1; row_index < dimension; ++row_index) {
+         double entry = matrix[row_index][column_index];
+         for (size_t index = 0; index < column_index; ++index) {
+            entry -= lower_factor[row_index][index]*lower_factor[column_index][index]*diagonal[index];
+         }
+         lower_factor[row_index][column_index] = entry / diagonal[column_index];
+      }
+   }
+   // inertia (3, 1, 0): only the pivot of the constraint is negative
+   ASSERT_LT(diagonal[dimension - 1], 0.);
+
+   // (L |D| L^T) P^{-1} v = v
+   for (size_t unit_index = 0; unit_index < dimension; ++unit_index) {
+      Vector<double> vector(dimension, 0.);
+      vector[unit_index] = 1.;
+      Vector<double> result(dimension);
+      preconditioner.apply(vector, result);
+      for (size_t row_index = 0; row_index < dimension; ++row_index) {
+         double product = 0.;
+         for (size_t column_index = 0; column_index < dimension; ++column_index) {
+            double entry = 0.;
+            for (size_t index = 0; index < dimension; ++index) {
+               entry += lower_factor[row_index][index]*std::abs(diagonal[index])*lower_factor[column_index][index];
+            }
+            product += entry*result[column_index];
+         }
+         ASSERT_NEAR(product, vector[row_index], 1e-12);
+      }
+   }
+}
+
+// HS071 at x = (2, 2, 2, 2) with z_L = (0.2, 2, 1, 1) and z_U = -1.5: the barrier diagonal is Σ = (0.7, 2.5, 1.5, 1.5) and
+// the Jacobian is J = [8 8 8 8; 4 4 4 4]
+TEST(Preconditioner, JacobiDiagonal) {
+   const HS071Model model{};
+   const OptimizationProblem problem{model};
+   const InteriorPointParameters parameters{0.99, 1e10, 0.25, 10., 1e-2, 1e-2, 1e-5};
+   const PrimalDualInteriorPointProblem barrier_problem{problem, 0.1, parameters};
+   Iterate iterate(4, 2);
+   iterate.primals.fill(2.);
+   iterate.multipliers.lower_bounds[0] = 0.2;
+   iterate.multipliers.lower_bounds[1] = 2.;
+   iterate.multipliers.lower_bounds[2] = 1.;
+   iterate.multipliers.lower_bounds[3] = 1.;
+   iterate.multipliers.upper_bounds.fill(-1.5);
+   ExactHessian hessian_model;
+   NoRegularization<double> regularization_strategy;
+   const Subproblem subproblem{barrier_problem, iterate, hessian_model, regularization_strategy, INF<double>};
+   OperatorEvaluationSpace evaluation_space;
+   evaluation_space.initialize(barrier_problem);
+   evaluation_space.evaluate_functions(barrier_problem, iterate, WarmstartInformation{});
+   Statistics statistics(false);
+
+   JacobiPreconditioner preconditioner;
+   preconditioner.initialize(subproblem, evaluation_space);
+   preconditioner.evaluate(statistics, subproblem, evaluation_space);
+   // the dual regularization only applies to the equality constraint (the second one)
+   preconditioner.regularize(subproblem, evaluation_space, 0., 0.5);
+
+   // D = max(1, Σ) and diag(J D^{-1} J^T) + δc
+   const double inverse_diagonal_sum = 1. + 1./2.5 + 2./1.5;
+   const std::vector<double> expected_diagonal{1., 2.5, 1.5, 1.5, 64.*inverse_diagonal_sum, 16.*inverse_diagonal_sum + 0.5};
+   Vector<double> vector(6, 1.);
+   Vector<double> result(6);
+   preconditioner.apply(vector, result);
+   for (size_t index = 0; index < 6; ++index) {
+      ASSERT_NEAR(result[index], 1. / expected_diagonal[index], 1e-14);
+   }
+}
+
+// the Ritz pairs (θ, u) of a Lanczos tridiagonal matrix T with the smallest |θ| are recycled: the update is positive
+// semidefinite and the preconditioned matrix maps u to ±σ u, with σ = max |θ|
+TEST(Preconditioner, LimitedMemoryUpdate) {
+   constexpr size_t dimension = 6;
+   constexpr size_t basis_size = 4;
+   const HS071Model model{};
+   const OptimizationProblem problem{model};
+   Iterate iterate(4, 2);
+   ExactHessian hessian_model;
+   NoRegularization<double> regularization_strategy;
+   const Subproblem subproblem{problem, iterate, hessian_model, regularization_strategy, INF<double>};
+   OperatorEvaluationSpace evaluation_space;
+   TestLimitedMemoryPreconditioner preconditioner(std::make_unique<IdentityPreconditioner>(), 2, basis_size);
+   preconditioner.initialize(subproblem, evaluation_space);
+
+   // Lanczos vectors e_0, ..., e_3 (orthonormal for P = I)
+   const double alphas[basis_size] = {2., -0.5, 4., 0.1};
+   const double betas[basis_size] = {0.3, 0.2, 0.1, 0.};
+   preconditioner.start_krylov_process();
+   for (size_t lanczos_index = 0; lanczos_index < basis_size; ++lanczos_index) {
+      Vector<double> lanczos_vector(dimension, 0.);
+      lanczos_vector[lanczos_index] = 1.;
+      preconditioner.record_lanczos_step(lanczos_vector, alphas[lanczos_index], betas[lanczos_index]);
+   }
+   preconditioner.end_krylov_process();
+   ASSERT_EQ(preconditioner.get_number_ritz_vectors(), 2);
+
+   // product with T (embedded in the dimension of the system)
+   const auto apply_tridiagonal_matrix = [&](const Vector<double>& vector, Vector<double>& result) {
+      result.fill(0.);
+      for (size_t index = 0; index < basis_size; ++index) {
+         result[index] += alphas[index]*vector[index];
+         if (index + 1 < basis_size) {
+            result[index] += betas[index]*vector[index + 1];
+            result[index + 1] += betas[index]*vector[index];
+         }
+      }
+   };
+   Vector<double> product(dimension), result(dimension);
+   double largest_ritz_value = 0.;
+   for (size_t ritz_index = 0; ritz_index < 2; ++ritz_index) {
+      ASSERT_GT(preconditioner.get_ritz_coefficient(ritz_index), 0.);
+      const Vector<double>& ritz_vector = preconditioner.get_ritz_vector(ritz_index);
+      apply_tridiagonal_matrix(ritz_vector, product);
+      const double ritz_value = dot(ritz_vector, product);
+      // σ = |θ| (1 + coefficient)
+      const double sigma = std::abs(ritz_value) * (1. + preconditioner.get_ritz_coefficient(ritz_index));
+      largest_ritz_value = std::max(largest_ritz_value, sigma);
+      preconditioner.apply(product, result);
+      for (size_t index = 0; index < dimension; ++index) {
+         ASSERT_NEAR(result[index], ((0. < ritz_value) ? sigma : -sigma)*ritz_vector[index], 1e-10);
+      }
+   }
+   // σ is the largest eigenvalue magnitude of T, which bounds its diagonal entries
+   for (double alpha: alphas) {
+      ASSERT_GE(largest_ritz_value, std::abs(alpha));
+   }
+
+   // the preconditioner is symmetric positive definite
+   Vector<double> vector1(dimension), vector2(dimension), result1(dimension), result2(dimension);
+   for (size_t index = 0; index < dimension; ++index) {
+      vector1[index] = std::cos(static_cast<double>(index + 1));
+      vector2[index] = std::sin(static_cast<double>(2*index + 1));
+   }
+   preconditioner.apply(vector1, result1);
+   preconditioner.apply(vector2, result2);
+   ASSERT_GT(dot(vector1, result1), 0.);
+   ASSERT_GT(dot(vector2, result2), 0.);
+   ASSERT_NEAR(dot(vector1, result2), dot(vector2, result1), 1e-12);
+}
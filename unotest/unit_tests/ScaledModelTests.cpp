@@ -0,0 +1,101 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "HS071Model.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "model/ScaledModel.hpp"
+#include "optimization/Iterate.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+
+using namespace uno;
+
+// at the initial point x = (1, 5, 5, 1) of HS071, the gradient of the objective is (12, 1, 2, 11) and the rows of the
+// Jacobian are (25, 5, 5, 25) and (2, 10, 10, 2). With a threshold and a factor of 10, the objective is scaled by
+// 10/12, the first constraint by 10/25 and the second constraint is not scaled
+class ScaledModelTests: public ::testing::Test {
+protected:
+   const HS071Model model{};
+   Options options{};
+   const double objective_scaling{10./12.};
+   const std::vector<double> constraint_scaling{0.4, 1.};
+
+   void SetUp() override {
+      DefaultOptions::load(this->options);
+      this->options.set("function_scaling_threshold", "10");
+      this->options.set("function_scaling_factor", "10");
+   }
+};
+
+TEST_F(ScaledModelTests, GradientBasedScaling) {
+   const ScaledModel scaled_model(this->model, this->options);
+   ASSERT_NEAR(scaled_model.get_objective_scaling(), this->objective_scaling, 1e-15);
+   ASSERT_NEAR(scaled_model.get_constraint_scaling(0), this->constraint_scaling[0], 1e-15);
+   ASSERT_EQ(scaled_model.get_constraint_scaling(1), this->constraint_scaling[1]);
+
+   // scaled functions and constraint bounds
+   Vector<double> x(4);
+   scaled_model.initial_primal_point(x);
+   ASSERT_NEAR(scaled_model.evaluate_objective(x), this->objective_scaling * 16., 1e-12);
+   std::vector<double> constraints(2);
+   scaled_model.evaluate_constraints(x, constraints);
+   ASSERT_NEAR(constraints[0], 0.4 * 25., 1e-12);
+   ASSERT_EQ(constraints[1], 52.);
+   ASSERT_NEAR(scaled_model.constraint_lower_bound(0), 0.4 * 25., 1e-12);
+   ASSERT_EQ(scaled_model.constraint_lower_bound(1), 40.);
+
+   // each Jacobian row is scaled by its constraint scaling
+   std::vector<int> row_indices(8), column_indices(8);
+   scaled_model.compute_constraint_jacobian_sparsity(row_indices.data(), column_indices.data(), 0, MatrixOrder::ROW_MAJOR);
+   std::vector<double> jacobian(8);
+   scaled_model.evaluate_constraint_jacobian(x, jacobian.data());
+   const std::vector<double> expected_jacobian{10., 2., 2., 10., 2., 10., 10., 2.};
+   for (size_t nonzero_index = 0; nonzero_index < 8; ++nonzero_index) {
+      ASSERT_NEAR(jacobian[nonzero_index], expected_jacobian[nonzero_index], 1e-12);
+   }
+}
+
+TEST_F(ScaledModelTests, SolutionMappedBack) {
+   const ScaledModel scaled_model(this->model, this->options);
+   Iterate iterate(4, 2);
+   scaled_model.initial_primal_point(iterate.primals);
+   iterate.objective_multiplier = 1.;
+   iterate.multipliers.constraints[0] = 1.;
+   iterate.multipliers.constraints[1] = 2.;
+   iterate.multipliers.lower_bounds[0] = 0.5;
+   iterate.multipliers.upper_bounds[3] = -0.25;
+   iterate.residuals.stationarity = 3.;
+   iterate.residuals.complementarity = 6.;
+   iterate.evaluations.objective = scaled_model.evaluate_objective(iterate.primals);
+   scaled_model.evaluate_objective_gradient(iterate.primals, iterate.evaluations.objective_gradient);
+
+   scaled_model.postprocess_solution(iterate);
+   // the constraint multipliers are multiplied by s_c/s_f, the bound multipliers and the dual residuals are divided by s_f
+   ASSERT_NEAR(iterate.multipliers.constraints[0], 1. * 0.4 / this->objective_scaling, 1e-12);
+   ASSERT_NEAR(iterate.multipliers.constraints[1], 2. / this->objective_scaling, 1e-12);
+   ASSERT_NEAR(iterate.multipliers.lower_bounds[0], 0.5 / this->objective_scaling, 1e-12);
+   ASSERT_NEAR(iterate.multipliers.upper_bounds[3], -0.25 / this->objective_scaling, 1e-12);
+   ASSERT_NEAR(iterate.residuals.stationarity, 3. / this->objective_scaling, 1e-12);
+   ASSERT_NEAR(iterate.residuals.complementarity, 6. / this->objective_scaling, 1e-12);
+   // the objective, its gradient and the constraints are those of the original model
+   ASSERT_NEAR(iterate.evaluations.objective, 16., 1e-12);
+   const std::vector<double> expected_gradient{12., 1., 2., 11.};
+   for (size_t variable_index = 0; variable_index < 4; ++variable_index) {
+      ASSERT_NEAR(iterate.evaluations.objective_gradient[variable_index], expected_gradient[variable_index], 1e-12);
+   }
+   ASSERT_EQ(iterate.evaluations.constraints[0], 25.);
+   ASSERT_EQ(iterate.evaluations.constraints[1], 52.);
+   ASSERT_EQ(iterate.primal_feasibility, 12.);
+}
+
+TEST_F(ScaledModelTests, NoScalingBelowThreshold) {
+   // with the default threshold of 100, no gradient is large enough to be scaled
+   Options default_options;
+   DefaultOptions::load(default_options);
+   const ScaledModel scaled_model(this->model, default_options);
+   ASSERT_EQ(scaled_model.get_objective_scaling(), 1.);
+   ASSERT_EQ(scaled_model.get_constraint_scaling(0), 1.);
+   ASSERT_EQ(scaled_model.get_constraint_scaling(1), 1.);
+}
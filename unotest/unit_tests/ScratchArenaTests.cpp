@@ -0,0 +1,211 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+#include "HS071Model.hpp"
+#include "ingredients/constraint_relaxation_strategies/FeasibilityRestoration.hpp"
+#include "ingredients/globalization_mechanisms/GlobalizationMechanism.hpp"
+#include "ingredients/hessian_models/ExactHessian.hpp"
+#include "ingredients/inequality_handling_methods/InequalityHandlingMethod.hpp"
+#include "ingredients/inequality_handling_methods/InequalityHandlingMethodFactory.hpp"
+#include "ingredients/subproblem/Subproblem.hpp"
+#include "ingredients/regularization_strategies/NoRegularization.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "model/HomogeneousEqualityConstrainedModel.hpp"
+#include "optimization/Direction.hpp"
+#include "optimization/Iterate.hpp"
+#include "optimization/OptimizationProblem.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+#include "options/Presets.hpp"
+#include "symbolic/Expression.hpp"
+#include "tools/Infinity.hpp"
+#include "tools/ScratchArena.hpp"
+
+using namespace uno;
+
+// counter of the heap allocations of the current thread, installed for the lifetime of an AllocationCounter. Outside
+// this scope (and on the other threads), operator new behaves as the default one
+static thread_local size_t* allocation_count = nullptr;
+
+class AllocationCounter {
+public:
+   AllocationCounter() { allocation_count = &this->count; }
+   AllocationCounter(const AllocationCounter&) = delete;
+   AllocationCounter& operator=(const AllocationCounter&) = delete;
+   ~AllocationCounter() { allocation_count = nullptr; }
+
+   [[nodiscard]] size_t number_allocations() const { return this->count; }
+
+protected:
+   size_t count{0};
+};
+
+void* operator new(size_t size) {
+   if (allocation_count != nullptr) {
+      ++(*allocation_count);
+   }
+   while (true) {
+      if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+         return pointer;
+      }
+      const std::new_handler handler = std::get_new_handler();
+      if (handler == nullptr) {
+         throw std::bad_alloc();
+      }
+      handler();
+   }
+}
+
+void operator delete(void* pointer) noexcept {
+   std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t /*size*/) noexcept {
+   std::free(pointer);
+}
+
+TEST(ScratchArena, NestedLeases) {
+   ScratchArena<Vector<double>> arena;
+   {
+      auto first = arena.lease(3);
+      auto second = arena.lease(5);
+      ASSERT_EQ(first->size(), 3);
+      ASSERT_EQ(second->size(), 5);
+      ASSERT_EQ(arena.number_leased_buffers(), 2);
+   }
+   ASSERT_EQ(arena.number_leased_buffers(), 0);
+   ASSERT_EQ(arena.number_buffers(), 2);
+}
+
+TEST(ScratchArena, NoAllocationAfterReserve) {
+   const size_t size = 100;
+   ScratchArena<std::vector<double>> arena;
+   arena.reserve(2, size);
+   size_t number_allocations;
+   {
+      const AllocationCounter allocation_counter;
+      for (size_t iteration = 0; iteration < 10; iteration++) {
+         auto buffer = arena.lease(size);
+         auto nested_buffer = arena.lease(size/2);
+         (*buffer)[0] = static_cast<double>(iteration);
+         (*nested_buffer)[0] = (*buffer)[0];
+      }
+      number_allocations = allocation_counter.number_allocations();
+   }
+   ASSERT_EQ(number_allocations, 0);
+}
+
+// assembling a trial iterate (x + alpha d) into preallocated storage does not allocate
+TEST(ScratchArena, NoAllocationInTrialIterateAssembly) {
+   const size_t size = 100;
+   const Vector<double> current_primals(size, 1.);
+   const Vector<double> direction(size, 2.);
+   Vector<double> trial_primals(size);
+   ScratchArena<Vector<double>> arena;
+   arena.reserve(1, size);
+   size_t number_allocations;
+   {
+      const AllocationCounter allocation_counter;
+      for (size_t iteration = 0; iteration < 10; iteration++) {
+         const double step_length = 1. / static_cast<double>(iteration + 1);
+         trial_primals.resize(size);
+         trial_primals = current_primals + step_length * direction;
+         auto result = arena.lease(size);
+         *result = trial_primals + step_length * direction;
+      }
+      number_allocations = allocation_counter.number_allocations();
+   }
+   ASSERT_EQ(number_allocations, 0);
+   ASSERT_EQ(trial_primals[0], 1. + 2./10.);
+}
+
+// exposes the assembly of the trial iterate of the globalization mechanisms
+class TrialIterateAssembly: public GlobalizationMechanism {
+public:
+   using GlobalizationMechanism::assemble_trial_iterate;
+};
+
+// exposes the predicted reductions of the constraint relaxation strategies
+class PredictedReductions: public FeasibilityRestoration {
+public:
+   using FeasibilityRestoration::FeasibilityRestoration;
+   using ConstraintRelaxationStrategy::compute_predicted_infeasibility_reduction;
+   using ConstraintRelaxationStrategy::reserve_scratch_space;
+};
+
+// backtracking on hs071 (with a slack for the inequality constraint, as required by the truncated CG solver): assemble the
+// trial iterate, evaluate it and compute the predicted infeasibility reduction "‖c(x)‖ - ‖c(x) + ∇c(x)^T (αd)‖" with
+// ConstraintRelaxationStrategy, whose Jacobian-vector product is leased from its arena. Once warm, no allocation
+TEST(ScratchArena, NoAllocationInBacktracking) {
+   Options options;
+   DefaultOptions::load(options);
+   Presets::set(options, "filtersqp");
+   options.set("globalization_mechanism", "LS");
+   options.set("QP_solver", "TruncatedCG");
+   const HS071Model hs071_model;
+   const HomogeneousEqualityConstrainedModel model(hs071_model);
+   const OptimizationProblem problem{model};
+   Iterate current_iterate(model.number_variables, model.number_constraints);
+   Iterate trial_iterate(model.number_variables, model.number_constraints);
+   model.initial_primal_point(current_iterate.primals);
+   // the slack of the inequality constraint x0 x1 x2 x3 >= 25 is at its bound
+   const size_t slack_index = hs071_model.number_variables;
+   current_iterate.primals[slack_index] = 25.;
+   current_iterate.evaluate_objective(model);
+   current_iterate.evaluate_constraints(model);
+
+   // the Jacobian is stored in the evaluation space of the subproblem solver
+   ExactHessian hessian_model;
+   NoRegularization<double> regularization_strategy;
+   const std::unique_ptr<InequalityHandlingMethod> inequality_handling_method = InequalityHandlingMethodFactory::create(options);
+   inequality_handling_method->initialize(problem, current_iterate, hessian_model, regularization_strategy, INF<double>);
+   inequality_handling_method->evaluate_constraint_jacobian(problem, current_iterate);
+   PredictedReductions constraint_relaxation_strategy(options);
+   constraint_relaxation_strategy.reserve_scratch_space(model.number_constraints);
+
+   // d = (0.5, 0.5, 0.5, 0.5) and the slack follows the linearized inequality constraint: ∇c(x0)^T d = (0, 12)
+   Direction direction(model.number_variables, model.number_constraints);
+   for (size_t variable_index = 0; variable_index < hs071_model.number_variables; ++variable_index) {
+      direction.primals[variable_index] = 0.5;
+   }
+   direction.primals[slack_index] = 30.;
+   direction.multipliers.constraints.fill(1.);
+   direction.multipliers.lower_bounds.fill(0.);
+   direction.multipliers.upper_bounds.fill(0.);
+
+   const auto backtracking_iteration = [&](double step_length) {
+      TrialIterateAssembly::assemble_trial_iterate(model, current_iterate, trial_iterate, direction, step_length, step_length);
+      trial_iterate.evaluate_objective(model);
+      trial_iterate.evaluate_constraints(model);
+      return constraint_relaxation_strategy.compute_predicted_infeasibility_reduction(*inequality_handling_method, model,
+         current_iterate, direction.primals, step_length);
+   };
+   // warm-up iteration: the trial iterate and the arena reach their sizes
+   (void)backtracking_iteration(1.);
+
+   double step_length = 1.;
+   double predicted_reduction = 0.;
+   size_t number_allocations;
+   {
+      const AllocationCounter allocation_counter;
+      for (size_t iteration = 0; iteration < 10; iteration++) {
+         predicted_reduction = backtracking_iteration(step_length);
+         step_length /= 2.;
+      }
+      number_allocations = allocation_counter.number_allocations();
+   }
+   ASSERT_EQ(number_allocations, 0);
+   // the last trial iterate is x + alpha d with alpha = 2^-9, projected onto the bounds
+   const double last_step_length = 1./512.;
+   ASSERT_DOUBLE_EQ(trial_iterate.primals[0], 1. + last_step_length * 0.5);
+   ASSERT_DOUBLE_EQ(trial_iterate.primals[slack_index], 25. + last_step_length * 30.);
+   ASSERT_DOUBLE_EQ(trial_iterate.multipliers.constraints[1], last_step_length);
+   ASSERT_DOUBLE_EQ(trial_iterate.evaluations.objective, model.evaluate_objective(trial_iterate.primals));
+   // c(x0) = (25 - s, 52 - 40) = (0, 12): the predicted infeasibility is |0| + |12 + alpha 12|
+   ASSERT_DOUBLE_EQ(predicted_reduction, 12. - (12. + last_step_length * 12.));
+}
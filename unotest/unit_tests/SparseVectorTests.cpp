@@ -3,6 +3,7 @@
 
 #include <gtest/gtest.h>
 #include "linear_algebra/SparseVector.hpp"
+#include "linear_algebra/Vector.hpp"
 
 using namespace uno;
 
@@ -56,3 +57,76 @@ TEST(SparseVector, InsertAfterClear) {
    x.insert(7, 3.);
    ASSERT_EQ(x.size(), 1);
 }
+
+TEST(SparseVector, Finalize) {
+   SparseVector<double> x(4);
+   x.insert(7, 1.);
+   x.insert(3, 2.);
+   x.insert(7, 3.);
+   x.insert(0, 4.);
+   ASSERT_FALSE(x.is_finalized());
+   x.finalize();
+   ASSERT_TRUE(x.is_finalized());
+   ASSERT_EQ(x.size(), 3);
+   const std::vector<std::pair<size_t, double>> reference{{0, 4.}, {3, 2.}, {7, 4.}};
+   size_t position = 0;
+   for (const auto [index, entry]: x) {
+      ASSERT_EQ(index, reference[position].first);
+      ASSERT_EQ(entry, reference[position].second);
+      ++position;
+   }
+}
+
+TEST(SparseVector, Axpy) {
+   SparseVector<double> x(3);
+   x.insert(1, 1.);
+   x.insert(4, 2.);
+   x.insert(6, 3.);
+   SparseVector<double> y(3);
+   y.insert(0, 5.);
+   y.insert(4, 1.);
+   y.insert(9, 2.);
+   // y += 2 x
+   axpy(2., x, y);
+   ASSERT_TRUE(y.is_finalized());
+   ASSERT_EQ(y.size(), 5);
+   const std::vector<std::pair<size_t, double>> reference{{0, 5.}, {1, 2.}, {4, 5.}, {6, 6.}, {9, 2.}};
+   size_t position = 0;
+   for (const auto [index, entry]: y) {
+      ASSERT_EQ(index, reference[position].first);
+      ASSERT_EQ(entry, reference[position].second);
+      ++position;
+   }
+}
+
+TEST(SparseVector, Dot) {
+   SparseVector<double> x(3);
+   x.insert(1, 1.);
+   x.insert(4, 2.);
+   x.insert(6, 3.);
+   SparseVector<double> y(2);
+   y.insert(4, 5.);
+   y.insert(6, -1.);
+   const Vector<double> dense{1., 2., 3., 4., 5., 6., 7.};
+   ASSERT_EQ(dot(dense, x), 2. + 10. + 21.);
+   ASSERT_EQ(dot(x, y), 10. - 3.);
+}
+
+TEST(SparseVector, ScatterGather) {
+   SparseVector<double> x(2);
+   x.insert(1, 1.);
+   x.insert(3, 2.);
+   Vector<double> workspace(5, 0.);
+   x.scatter(workspace, 3.);
+   ASSERT_EQ(workspace[1], 3.);
+   ASSERT_EQ(workspace[3], 6.);
+   workspace[3] += 1.;
+   x.gather(workspace);
+   for (const auto [index, entry]: x) {
+      ASSERT_EQ(entry, (index == 1) ? 3. : 7.);
+   }
+   // the workspace was reset
+   for (size_t index: Range(workspace.size())) {
+      ASSERT_EQ(workspace[index], 0.);
+   }
+}
@@ -0,0 +1,71 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include "HS071Model.hpp"
+#include "StrategyPortfolio.hpp"
+#include "Uno.hpp"
+#include "model/HomogeneousEqualityConstrainedModel.hpp"
+#include "optimization/Result.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+#include "options/Presets.hpp"
+#include "tools/CancellationToken.hpp"
+#include "tools/Logger.hpp"
+#include "tools/UserCallbacks.hpp"
+
+using namespace uno;
+
+// HS071 with a slack for the inequality constraint. The user options select the line search and the truncated CG (the
+// only QP solver available in all the builds)
+class StrategyPortfolioTests: public ::testing::Test {
+protected:
+   const HS071Model hs071_model{};
+   const HomogeneousEqualityConstrainedModel model{hs071_model};
+   Options options{};
+   Options user_options{};
+   std::ostringstream output{};
+
+   void SetUp() override {
+      DefaultOptions::load(this->options);
+      this->options.overwrite_with(Presets::get_preset_options("filtersqp"));
+      this->user_options.set("globalization_mechanism", "LS");
+      this->user_options.set("QP_solver", "TruncatedCG");
+      this->options.overwrite_with(this->user_options);
+   }
+};
+
+TEST_F(StrategyPortfolioTests, UserOptionsOverwritePresets) {
+   // the filtersqp and funnelsqp presets select a trust region: the user options are applied after the presets
+   const Logger::Redirection redirection(this->output);
+   this->options.set("portfolio_presets", "filtersqp,funnelsqp");
+   const StrategyPortfolio portfolio(this->options);
+   const Result result = portfolio.solve(this->model, this->options, this->user_options);
+   ASSERT_EQ(result.optimization_status, OptimizationStatus::SUCCESS);
+   ASSERT_EQ(result.solution_status, SolutionStatus::FEASIBLE_KKT_POINT);
+   ASSERT_EQ(result.strategy_combination.rfind("LS ", 0), 0);
+}
+
+TEST_F(StrategyPortfolioTests, WinnerFindsKKTPoint) {
+   // the ipopt run fails without a direct linear solver: the filtersqp run wins
+   const Logger::Redirection redirection(this->output);
+   this->options.set("portfolio_presets", "ipopt,filtersqp");
+   const StrategyPortfolio portfolio(this->options);
+   const Result result = portfolio.solve(this->model, this->options, this->user_options);
+   ASSERT_EQ(result.solution_status, SolutionStatus::FEASIBLE_KKT_POINT);
+   ASSERT_NEAR(result.solution_objective, 17.0140173, 1e-6);
+   ASSERT_NE(this->output.str().find("Winner: filtersqp"), std::string::npos);
+}
+
+TEST_F(StrategyPortfolioTests, CancelledRunTerminates) {
+   // a run whose token is cancelled (e.g. by the winner of the portfolio) terminates with the status USER_TERMINATION
+   const Logger::Redirection redirection(this->output);
+   CancellationToken cancellation_token{};
+   cancellation_token.cancel();
+   NoUserCallbacks user_callbacks{};
+   Uno uno{};
+   const Result result = uno.solve(this->model, this->options, user_callbacks, cancellation_token);
+   ASSERT_EQ(result.optimization_status, OptimizationStatus::USER_TERMINATION);
+   ASSERT_EQ(result.number_iterations, 0);
+}
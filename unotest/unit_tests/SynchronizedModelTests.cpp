@@ -0,0 +1,76 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "HS071Model.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "model/SynchronizedModel.hpp"
+
+using namespace uno;
+
+// the Jacobian of HS071 at x, row by row or column by column
+static std::vector<double> evaluate_jacobian(const Vector<double>& x, MatrixOrder matrix_order) {
+   const OrderedHS071Model model{};
+   std::vector<int> row_indices(8), column_indices(8);
+   std::vector<double> jacobian(8);
+   model.compute_constraint_jacobian_sparsity(row_indices.data(), column_indices.data(), 0, matrix_order);
+   model.evaluate_constraint_jacobian(x, jacobian.data());
+   return jacobian;
+}
+
+TEST(SynchronizedModel, JacobianOrder) {
+   const OrderedHS071Model model{};
+   SynchronizedModel::Lock lock{};
+   const SynchronizedModel row_major_model(model, lock);
+   const SynchronizedModel column_major_model(model, lock);
+   const Vector<double> x{1., 2., 3., 4.};
+   std::vector<int> row_indices(8), column_indices(8);
+   std::vector<double> jacobian(8);
+
+   row_major_model.compute_constraint_jacobian_sparsity(row_indices.data(), column_indices.data(), 0, MatrixOrder::ROW_MAJOR);
+   column_major_model.compute_constraint_jacobian_sparsity(row_indices.data(), column_indices.data(), 0, MatrixOrder::COLUMN_MAJOR);
+   // the last query was column by column: the row-major wrapper restores its order
+   row_major_model.evaluate_constraint_jacobian(x, jacobian.data());
+   ASSERT_EQ(jacobian, evaluate_jacobian(x, MatrixOrder::ROW_MAJOR));
+   column_major_model.evaluate_constraint_jacobian(x, jacobian.data());
+   ASSERT_EQ(jacobian, evaluate_jacobian(x, MatrixOrder::COLUMN_MAJOR));
+   column_major_model.evaluate_constraint_jacobian(x, jacobian.data());
+   ASSERT_EQ(jacobian, evaluate_jacobian(x, MatrixOrder::COLUMN_MAJOR));
+   ASSERT_EQ(model.number_jacobian_evaluations, 3);
+}
+
+// concurrent wrappers with different orders: each one gets the Jacobian in its own order
+TEST(SynchronizedModel, ConcurrentEvaluations) {
+   const OrderedHS071Model model{};
+   SynchronizedModel::Lock lock{};
+   const Vector<double> x{1., 2., 3., 4.};
+   const std::vector<double> row_major_jacobian = evaluate_jacobian(x, MatrixOrder::ROW_MAJOR);
+   const std::vector<double> column_major_jacobian = evaluate_jacobian(x, MatrixOrder::COLUMN_MAJOR);
+
+   constexpr size_t number_threads = 4;
+   std::vector<char> is_correct(number_threads, true);
+   std::vector<std::thread> threads;
+   for (size_t thread_index = 0; thread_index < number_threads; ++thread_index) {
+      threads.emplace_back([&, thread_index]() {
+         const SynchronizedModel synchronized_model(model, lock);
+         const MatrixOrder matrix_order = (thread_index%2 == 0) ? MatrixOrder::ROW_MAJOR : MatrixOrder::COLUMN_MAJOR;
+         std::vector<int> row_indices(8), column_indices(8);
+         std::vector<double> jacobian(8);
+         synchronized_model.compute_constraint_jacobian_sparsity(row_indices.data(), column_indices.data(), 0, matrix_order);
+         for (size_t repetition = 0; repetition < 100; ++repetition) {
+            synchronized_model.evaluate_constraint_jacobian(x, jacobian.data());
+            if (jacobian != ((matrix_order == MatrixOrder::ROW_MAJOR) ? row_major_jacobian : column_major_jacobian)) {
+               is_correct[thread_index] = false;
+            }
+         }
+      });
+   }
+   for (std::thread& thread: threads) {
+      thread.join();
+   }
+   for (size_t thread_index = 0; thread_index < number_threads; ++thread_index) {
+      ASSERT_TRUE(is_correct[thread_index]);
+   }
+}
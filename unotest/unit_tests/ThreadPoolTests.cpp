@@ -0,0 +1,51 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+#include "tools/ThreadPool.hpp"
+
+using namespace uno;
+
+TEST(ThreadPool, EachIterationExecutedOncePerLoop) {
+   ThreadPool thread_pool(4);
+   ASSERT_EQ(thread_pool.size(), 4);
+   std::vector<size_t> counts(1000, 0);
+   std::vector<size_t> thread_indices(counts.size());
+   // two consecutive loops on the same pool
+   for (size_t loop = 0; loop < 2; ++loop) {
+      thread_pool.parallel_for(counts.size(), [&](size_t iteration, size_t thread_index) {
+         ++counts[iteration];
+         thread_indices[iteration] = thread_index;
+      });
+   }
+   for (size_t iteration = 0; iteration < counts.size(); ++iteration) {
+      ASSERT_EQ(counts[iteration], 2);
+      ASSERT_LT(thread_indices[iteration], 4);
+   }
+}
+
+TEST(ThreadPool, Sequential) {
+   ThreadPool thread_pool(1);
+   std::vector<size_t> iterations;
+   thread_pool.parallel_for(5, [&](size_t iteration, size_t thread_index) {
+      ASSERT_EQ(thread_index, 0);
+      iterations.push_back(iteration);
+   });
+   const std::vector<size_t> reference_iterations{0, 1, 2, 3, 4};
+   ASSERT_EQ(iterations, reference_iterations);
+}
+
+TEST(ThreadPool, ExceptionIsRethrown) {
+   ThreadPool thread_pool(3);
+   ASSERT_THROW(thread_pool.parallel_for(10, [](size_t iteration, size_t /*thread_index*/) {
+      if (iteration == 7) {
+         throw std::runtime_error("iteration 7 failed");
+      }
+   }), std::runtime_error);
+   // the pool remains usable
+   size_t number_iterations = 0;
+   thread_pool.parallel_for(1, [&](size_t /*iteration*/, size_t /*thread_index*/) { ++number_iterations; });
+   ASSERT_EQ(number_iterations, 1);
+}
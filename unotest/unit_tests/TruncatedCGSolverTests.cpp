@@ -0,0 +1,159 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+#include "ingredients/hessian_models/ExactHessian.hpp"
+#include "ingredients/subproblem/Subproblem.hpp"
+#include "ingredients/regularization_strategies/NoRegularization.hpp"
+#include "ingredients/subproblem_solvers/TruncatedCG/TruncatedCGSolver.hpp"
+#include "linear_algebra/SparseVector.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "model/Model.hpp"
+#include "optimization/Direction.hpp"
+#include "optimization/Iterate.hpp"
+#include "optimization/OptimizationProblem.hpp"
+#include "optimization/WarmstartInformation.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+#include "symbolic/CollectionAdapter.hpp"
+#include "tools/Infinity.hpp"
+#include "tools/Statistics.hpp"
+
+using namespace uno;
+
+// box-constrained QP with a diagonal Hessian (test model): min 1/2 x^T diag(h) x + c^T x s.t. l <= x <= u
+class BoxQPModel: public Model {
+public:
+   BoxQPModel(std::vector<double> hessian_diagonal, std::vector<double> linear_term, double lower_bound, double upper_bound):
+         Model("box_qp", hessian_diagonal.size(), 0, 1.),
+         hessian_diagonal(std::move(hessian_diagonal)), linear_term(std::move(linear_term)),
+         lower_bound(lower_bound), upper_bound(upper_bound) { }
+
+   [[nodiscard]] bool has_jacobian_operator() const override { return true; }
+   [[nodiscard]] bool has_jacobian_transposed_operator() const override { return true; }
+   [[nodiscard]] bool has_hessian_operator() const override { return true; }
+   [[nodiscard]] bool has_hessian_matrix() const override { return true; }
+
+   [[nodiscard]] double evaluate_objective(const Vector<double>& x) const override {
+      double objective = 0.;
+      for (size_t variable_index = 0; variable_index < this->number_variables; ++variable_index) {
+         objective += (0.5*this->hessian_diagonal[variable_index]*x[variable_index] + this->linear_term[variable_index])*x[variable_index];
+      }
+      return objective;
+   }
+   void evaluate_constraints(const Vector<double>& /*x*/, std::vector<double>& /*constraints*/) const override { }
+
+   void evaluate_objective_gradient(const Vector<double>& x, Vector<double>& gradient) const override {
+      for (size_t variable_index = 0; variable_index < this->number_variables; ++variable_index) {
+         gradient[variable_index] = this->hessian_diagonal[variable_index]*x[variable_index] + this->linear_term[variable_index];
+      }
+   }
+
+   void compute_constraint_jacobian_sparsity(int* /*row_indices*/, int* /*column_indices*/, int /*solver_indexing*/,
+         MatrixOrder /*matrix_order*/) const override { }
+
+   void compute_hessian_sparsity(int* row_indices, int* column_indices, int solver_indexing) const override {
+      for (size_t variable_index = 0; variable_index < this->number_variables; ++variable_index) {
+         row_indices[variable_index] = static_cast<int>(variable_index) + solver_indexing;
+         column_indices[variable_index] = static_cast<int>(variable_index) + solver_indexing;
+      }
+   }
+
+   void evaluate_constraint_jacobian(const Vector<double>& /*x*/, double* /*jacobian_values*/) const override { }
+
+   void evaluate_lagrangian_hessian(const Vector<double>& /*x*/, double objective_multiplier, const Vector<double>& /*multipliers*/,
+         double* hessian_values) const override {
+      for (size_t variable_index = 0; variable_index < this->number_variables; ++variable_index) {
+         hessian_values[variable_index] = objective_multiplier*this->hessian_diagonal[variable_index];
+      }
+   }
+
+   void compute_hessian_vector_product(const double* /*x*/, const double* vector, double objective_multiplier,
+         const Vector<double>& /*multipliers*/, double* result) const override {
+      for (size_t variable_index = 0; variable_index < this->number_variables; ++variable_index) {
+         result[variable_index] = objective_multiplier*this->hessian_diagonal[variable_index]*vector[variable_index];
+      }
+   }
+
+   [[nodiscard]] double variable_lower_bound(size_t /*variable_index*/) const override { return this->lower_bound; }
+   [[nodiscard]] double variable_upper_bound(size_t /*variable_index*/) const override { return this->upper_bound; }
+   [[nodiscard]] const SparseVector<size_t>& get_slacks() const override { return this->slacks; }
+   [[nodiscard]] const Vector<size_t>& get_fixed_variables() const override { return this->fixed_variables; }
+
+   [[nodiscard]] double constraint_lower_bound(size_t /*constraint_index*/) const override { return -INF<double>; }
+   [[nodiscard]] double constraint_upper_bound(size_t /*constraint_index*/) const override { return INF<double>; }
+   [[nodiscard]] const Collection<size_t>& get_equality_constraints() const override { return this->no_constraints; }
+   [[nodiscard]] const Collection<size_t>& get_inequality_constraints() const override { return this->no_constraints; }
+   [[nodiscard]] const Collection<size_t>& get_linear_constraints() const override { return this->no_constraints; }
+
+   void initial_primal_point(Vector<double>& x) const override { x.fill(0.); }
+   void initial_dual_point(Vector<double>& /*multipliers*/) const override { }
+   void postprocess_solution(Iterate& /*iterate*/) const override { }
+
+   [[nodiscard]] size_t number_jacobian_nonzeros() const override { return 0; }
+   [[nodiscard]] size_t number_hessian_nonzeros() const override { return this->number_variables; }
+
+protected:
+   const std::vector<double> hessian_diagonal;
+   const std::vector<double> linear_term;
+   const double lower_bound, upper_bound;
+   std::vector<size_t> constraint_indices{};
+   CollectionAdapter<std::vector<size_t>> no_constraints{this->constraint_indices};
+   SparseVector<size_t> slacks{};
+   Vector<size_t> fixed_variables{};
+};
+
+// solve the QP at x = 0 (without trust region)
+static Direction solve_box_qp(const BoxQPModel& model) {
+   Options options;
+   DefaultOptions::load(options);
+   const OptimizationProblem problem{model};
+   Iterate iterate(problem.number_variables, problem.number_constraints);
+   model.initial_primal_point(iterate.primals);
+   ExactHessian hessian_model;
+   NoRegularization<double> regularization_strategy;
+   Subproblem subproblem{problem, iterate, hessian_model, regularization_strategy, INF<double>};
+
+   TruncatedCGSolver solver(options);
+   solver.initialize_memory(subproblem);
+   Statistics statistics(false);
+   Direction direction(problem.number_variables, problem.number_constraints);
+   solver.solve(statistics, subproblem, iterate.primals, direction, WarmstartInformation{});
+   return direction;
+}
+
+TEST(TruncatedCGSolver, BoundaryReached) {
+   // the unconstrained minimizer (2, -0.5) lies outside the box [-1, 1]^2. The first CG step reaches x0 = 1, then the CG
+   // is restarted on the face x0 = 1 and converges to x1 = -0.5
+   const BoxQPModel model({1., 1.}, {-2., 0.5}, -1., 1.);
+   const Direction direction = solve_box_qp(model);
+   ASSERT_EQ(direction.status, SubproblemStatus::OPTIMAL);
+   ASSERT_NEAR(direction.primals[0], 1., 1e-12);
+   ASSERT_NEAR(direction.primals[1], -0.5, 1e-12);
+   // g + H d = (-1, 0): the upper bound of x0 is active
+   ASSERT_NEAR(direction.multipliers.upper_bounds[0], -1., 1e-12);
+   ASSERT_EQ(direction.multipliers.upper_bounds[1], 0.);
+   ASSERT_EQ(direction.multipliers.lower_bounds[1], 0.);
+   ASSERT_NEAR(direction.subproblem_objective, -2. + 1./2. - 0.25 + 0.125, 1e-12);
+}
+
+TEST(TruncatedCGSolver, NegativeCurvature) {
+   // the steepest-descent direction (-1, -0.5) has negative curvature (-0.75): the CG goes to the boundary x0 = -1
+   const BoxQPModel model({-1., 1.}, {1., 0.5}, -1., 1.);
+   const Direction direction = solve_box_qp(model);
+   ASSERT_EQ(direction.status, SubproblemStatus::OPTIMAL);
+   ASSERT_NEAR(direction.primals[0], -1., 1e-12);
+   ASSERT_NEAR(direction.primals[1], -0.5, 1e-12);
+   // g + H d = (2, 0): the lower bound of x0 is active
+   ASSERT_NEAR(direction.multipliers.lower_bounds[0], 2., 1e-12);
+   ASSERT_NEAR(direction.subproblem_objective, -1. - 0.25 + 0.5*(-1. + 0.25), 1e-12);
+}
+
+TEST(TruncatedCGSolver, UnboundedNegativeCurvature) {
+   // without bounds, the direction of negative curvature is unbounded
+   const BoxQPModel model({-1., 1.}, {1., 0.5}, -INF<double>, INF<double>);
+   const Direction direction = solve_box_qp(model);
+   ASSERT_EQ(direction.status, SubproblemStatus::UNBOUNDED_PROBLEM);
+}
@@ -0,0 +1,76 @@
+// Copyright (c) 2025 Charlie Vanaret
+// Licensed under the MIT license. See LICENSE file in the project directory for details.
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <vector>
+#include "HS071Model.hpp"
+#include "Uno.hpp"
+#include "linear_algebra/Vector.hpp"
+#include "model/HomogeneousEqualityConstrainedModel.hpp"
+#include "optimization/Result.hpp"
+#include "options/DefaultOptions.hpp"
+#include "options/Options.hpp"
+#include "options/Presets.hpp"
+#include "tools/Logger.hpp"
+#include "tools/UserCallbacks.hpp"
+
+using namespace uno;
+
+// requests the termination at a given acceptable iterate and records its primals
+class TerminatingCallbacks: public UserCallbacks {
+public:
+   explicit TerminatingCallbacks(size_t termination_iterate): UserCallbacks(), termination_iterate(termination_iterate) { }
+
+   bool notify_acceptable_iterate(const Vector<double>& primals, const Multipliers& /*multipliers*/, double /*objective_multiplier*/) override {
+      ++this->number_acceptable_iterates;
+      this->primals.assign(primals.begin(), primals.end());
+      return (this->number_acceptable_iterates == this->termination_iterate);
+   }
+   bool notify_new_primals(const Vector<double>& /*primals*/) override { return false; }
+   bool notify_new_multipliers(const Multipliers& /*multipliers*/) override { return false; }
+
+   const size_t termination_iterate;
+   size_t number_acceptable_iterates{0};
+   std::vector<double> primals{};
+};
+
+// HS071 with a slack for the inequality constraint, solved by a line-search SQP method with the truncated CG
+class UserCallbacksTests: public ::testing::Test {
+protected:
+   const HS071Model hs071_model{};
+   const HomogeneousEqualityConstrainedModel model{hs071_model};
+   Options options{};
+   std::ostringstream output{};
+
+   void SetUp() override {
+      DefaultOptions::load(this->options);
+      Presets::set(this->options, "filtersqp");
+      this->options.set("globalization_mechanism", "LS");
+      this->options.set("QP_solver", "TruncatedCG");
+   }
+};
+
+TEST_F(UserCallbacksTests, TerminationAtAcceptableIterate) {
+   const Logger::Redirection redirection(this->output);
+   TerminatingCallbacks user_callbacks(2);
+   Uno uno{};
+   const Result result = uno.solve(this->model, this->options, user_callbacks);
+   ASSERT_EQ(result.optimization_status, OptimizationStatus::USER_TERMINATION);
+   ASSERT_EQ(user_callbacks.number_acceptable_iterates, 2);
+   ASSERT_EQ(result.number_iterations, 2);
+   // the solve terminates at the accepted iterate
+   for (size_t variable_index = 0; variable_index < this->model.number_variables; ++variable_index) {
+      ASSERT_EQ(result.primal_solution[variable_index], user_callbacks.primals[variable_index]);
+   }
+}
+
+TEST_F(UserCallbacksTests, NoTerminationRequest) {
+   const Logger::Redirection redirection(this->output);
+   TerminatingCallbacks user_callbacks(0);
+   Uno uno{};
+   const Result result = uno.solve(this->model, this->options, user_callbacks);
+   ASSERT_EQ(result.optimization_status, OptimizationStatus::SUCCESS);
+   ASSERT_EQ(result.solution_status, SolutionStatus::FEASIBLE_KKT_POINT);
+   ASSERT_EQ(user_callbacks.number_acceptable_iterates, result.number_iterations);
+}